@@ -1,7 +1,15 @@
 #include "MainQt.h"
 #include "App.h"
+#include "heat/HeatSolverBenchmarkCli.hpp"
+#include "heat/TemperatureRecordCli.hpp"
+#include "mesh/remesher/DelaunayBenchmarkCli.hpp"
 #include "nodegraph/ui/scene/NodeGraphDock.hpp"
+#include "spatial/SDFBenchmarkCli.hpp"
+#include "spatial/TriangleBVHCheckCli.hpp"
+#include "util/ContentHashBenchmarkCli.hpp"
 #include "util/UiTheme.hpp"
+#include "voronoi/NeighborBenchmarkCli.hpp"
+#include "vulkan/TLSFBenchmarkCli.hpp"
 #include "VulkanWindow.hpp"
 
 #include <QAction>
@@ -286,6 +294,31 @@ void MainWindow::onExit() {
 }
 
 int main(int argc, char** argv) {
+    if (isTemperatureRecordCliInvocation(argc, argv)) {
+        return runTemperatureRecordCli(argc, argv);
+    }
+    if (isNeighborBenchmarkCliInvocation(argc, argv)) {
+        return runNeighborBenchmarkCli(argc, argv);
+    }
+    if (isSDFBenchmarkCliInvocation(argc, argv)) {
+        return runSDFBenchmarkCli(argc, argv);
+    }
+    if (isTriangleBVHCheckCliInvocation(argc, argv)) {
+        return runTriangleBVHCheckCli(argc, argv);
+    }
+    if (isHeatSolverBenchmarkCliInvocation(argc, argv)) {
+        return runHeatSolverBenchmarkCli(argc, argv);
+    }
+    if (isContentHashBenchmarkCliInvocation(argc, argv)) {
+        return runContentHashBenchmarkCli(argc, argv);
+    }
+    if (isTLSFBenchmarkCliInvocation(argc, argv)) {
+        return runTLSFBenchmarkCli(argc, argv);
+    }
+    if (isDelaunayBenchmarkCliInvocation(argc, argv)) {
+        return runDelaunayBenchmarkCli(argc, argv);
+    }
+
     QApplication qapp(argc, argv);
 
     MainWindow mainWindow;
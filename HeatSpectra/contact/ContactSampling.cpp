@@ -3,11 +3,12 @@
 
 #include "mesh/remesher/iODT.hpp"
 #include "mesh/remesher/SupportingHalfedge.hpp"
-#include "spatial/TriangleHashGrid.hpp"
+#include "spatial/TriangleBVH.hpp"
 
 #include <cmath>
 #include <limits>
 #include <algorithm>
+#include <omp.h>
 
 namespace {
 
@@ -42,6 +43,285 @@ glm::mat4 toMat4(const std::array<float, 16>& values) {
 
 }
 
+void sampleContactPairs(
+    const TriangleBVH& sourceBvh,
+    const SupportingHalfedge::IntrinsicMesh& sourceMesh,
+    const std::array<float, 16>& sourceLocalToWorld,
+    const std::vector<glm::vec3>& sourceWorldNormals,
+    const SupportingHalfedge::IntrinsicMesh& receiverMesh,
+    const std::array<float, 16>& receiverLocalToWorld,
+    const uint32_t* triangleIndices,
+    uint32_t triangleIndexCount,
+    std::vector<ContactPair>& contactPairs,
+    float contactRadius,
+    float minNormalDot) {
+    if (contactPairs.size() < receiverMesh.triangles.size()) {
+        contactPairs.resize(receiverMesh.triangles.size(), ContactPair{});
+    }
+
+    glm::mat4 invSrcModelMat = glm::inverse(toMat4(sourceLocalToWorld));
+	glm::mat4 recvModelMat = toMat4(receiverLocalToWorld);
+	glm::mat3 recvNormalMat = glm::transpose(glm::inverse(glm::mat3(recvModelMat)));
+
+	const int evaluateCount = triangleIndices
+		? static_cast<int>(triangleIndexCount)
+		: static_cast<int>(receiverMesh.triangles.size());
+
+	// Each receiver triangle casts its quadrature samples as one packet into the source BVH
+	#pragma omp parallel for schedule(dynamic, 64)
+	for (int evaluateIdx = 0; evaluateIdx < evaluateCount; evaluateIdx++) {
+		const uint32_t triIdx = triangleIndices ? triangleIndices[evaluateIdx] : static_cast<uint32_t>(evaluateIdx);
+		if (triIdx >= receiverMesh.triangles.size()) {
+			continue;
+		}
+
+		const auto& rTri = receiverMesh.triangles[triIdx];
+		uint32_t rv0 = rTri.vertexIndices[0];
+		uint32_t rv1 = rTri.vertexIndices[1];
+		uint32_t rv2 = rTri.vertexIndices[2];
+		if (rv0 >= receiverMesh.vertices.size() || rv1 >= receiverMesh.vertices.size() || rv2 >= receiverMesh.vertices.size()) {
+			continue;
+		}
+
+		const glm::vec3 p0 = receiverMesh.vertices[rv0].position;
+		const glm::vec3 p1 = receiverMesh.vertices[rv1].position;
+		const glm::vec3 p2 = receiverMesh.vertices[rv2].position;
+
+		const glm::vec3 n0 = receiverMesh.vertices[rv0].normal;
+		const glm::vec3 n1 = receiverMesh.vertices[rv1].normal;
+		const glm::vec3 n2 = receiverMesh.vertices[rv2].normal;
+
+		ContactPair pair{};
+		for (uint32_t si = 0; si < Quadrature::count; ++si) {
+			pair.samples[si].sourceTriangleIndex = iODT::INVALID_INDEX;
+			pair.samples[si].u = 0.0f;
+			pair.samples[si].v = 0.0f;
+			pair.samples[si].wArea = 0.0f;
+		}
+		pair.contactArea = 0.0f;
+
+		const float recvArea = rTri.area;
+		if (recvArea <= 0.0f) {
+			contactPairs[triIdx] = pair;
+			continue;
+		}
+
+		TriangleBVH::RayPacket packet{};
+		glm::vec3 packetNormals[Quadrature::count];
+		uint32_t packetSamples[Quadrature::count];
+		for (uint32_t si = 0; si < Quadrature::count; ++si) {
+			const glm::vec3 barycentricCoord = Quadrature::bary[si];
+			glm::vec3 localPos = p0 * barycentricCoord.x + p1 * barycentricCoord.y + p2 * barycentricCoord.z;
+			glm::vec3 localN = n0 * barycentricCoord.x + n1 * barycentricCoord.y + n2 * barycentricCoord.z;
+			float localNLen2 = glm::dot(localN, localN);
+			if (localNLen2 < 1e-12f) {
+				continue;
+			}
+			localN *= (1.0f / std::sqrt(localNLen2));
+
+			glm::vec3 worldPos = glm::vec3(recvModelMat * glm::vec4(localPos, 1.0f));
+			glm::vec3 worldN = normalizedOrZero(glm::vec3(recvNormalMat * localN));
+			if (glm::dot(worldN, worldN) < 1e-12f) {
+				continue;
+			}
+
+			glm::vec3 srcPos = glm::vec3(invSrcModelMat * glm::vec4(worldPos, 1.0f));
+			glm::vec3 srcDirPlus = normalizedOrZero(glm::vec3(invSrcModelMat * glm::vec4(worldN, 0.0f)));
+			if (glm::dot(srcDirPlus, srcDirPlus) < 1e-12f) {
+				continue;
+			}
+
+			const uint32_t rayIndex = packet.rayCount++;
+			packet.origins[rayIndex] = srcPos;
+			packet.directions[rayIndex] = srcDirPlus;
+			packet.maxDistances[rayIndex] = contactRadius;
+			packetNormals[rayIndex] = worldN;
+			packetSamples[rayIndex] = si;
+		}
+
+		TriangleBVH::RayHit hits[Quadrature::count];
+		sourceBvh.intersectPacket(packet, hits, [&](uint32_t rayIndex, uint32_t sTriIdx) {
+			if (sTriIdx >= sourceMesh.triangles.size()) {
+				return false;
+			}
+			const float nd = glm::dot(packetNormals[rayIndex], sourceWorldNormals[sTriIdx]);
+			return minNormalDot < 0.0f ? nd <= minNormalDot : nd >= minNormalDot;
+		});
+
+		for (uint32_t rayIndex = 0; rayIndex < packet.rayCount; ++rayIndex) {
+			const TriangleBVH::RayHit& hit = hits[rayIndex];
+			if (hit.triangleIndex == TriangleBVH::INVALID_TRIANGLE) {
+				continue;
+			}
+
+			const uint32_t si = packetSamples[rayIndex];
+			pair.samples[si].sourceTriangleIndex = hit.triangleIndex;
+			pair.samples[si].u = hit.u;
+			pair.samples[si].v = hit.v;
+			float weightedArea = Quadrature::weights[si] * recvArea;
+			pair.samples[si].wArea = weightedArea;
+			pair.contactArea += weightedArea;
+		}
+
+		contactPairs[triIdx] = pair;
+	}
+}
+
+void computeSourceWorldNormals(
+    const SupportingHalfedge::IntrinsicMesh& sourceMesh,
+    const std::array<float, 16>& sourceLocalToWorld,
+    std::vector<glm::vec3>& outNormals) {
+	glm::mat4 srcModelMat = toMat4(sourceLocalToWorld);
+	glm::mat3 srcNormalMat = glm::transpose(glm::inverse(glm::mat3(srcModelMat)));
+
+    const int sourceTriangleCount = static_cast<int>(sourceMesh.triangles.size());
+    outNormals.resize(sourceMesh.triangles.size());
+
+    #pragma omp parallel for
+    for (int sTriIdx = 0; sTriIdx < sourceTriangleCount; ++sTriIdx) {
+        outNormals[sTriIdx] = normalizedOrZero(glm::vec3(srcNormalMat * sourceMesh.triangles[sTriIdx].normal));
+    }
+}
+
+void appendContactLines(
+    const SupportingHalfedge::IntrinsicMesh& sourceMesh,
+    const std::array<float, 16>& sourceLocalToWorld,
+    const SupportingHalfedge::IntrinsicMesh& receiverMesh,
+    const std::array<float, 16>& receiverLocalToWorld,
+    const std::vector<ContactPair>& contactPairs,
+    std::vector<ContactLineVertex>& outOutlineVertices,
+    std::vector<ContactLineVertex>& outCorrespondenceVertices) {
+	glm::mat4 recvModel = toMat4(receiverLocalToWorld);
+	glm::mat4 srcModelMat2 = toMat4(sourceLocalToWorld);
+
+	const size_t triangleCount = std::min(receiverMesh.triangles.size(), contactPairs.size());
+	for (size_t triIdx = 0; triIdx < triangleCount; triIdx++) {
+		const ContactPair& pair = contactPairs[triIdx];
+		if (pair.contactArea <= 0.0f) {
+			continue;
+		}
+
+		const auto& rTri = receiverMesh.triangles[triIdx];
+		uint32_t rv0 = rTri.vertexIndices[0];
+		uint32_t rv1 = rTri.vertexIndices[1];
+		uint32_t rv2 = rTri.vertexIndices[2];
+		if (rv0 >= receiverMesh.vertices.size() || rv1 >= receiverMesh.vertices.size() || rv2 >= receiverMesh.vertices.size()) {
+			continue;
+		}
+
+		glm::vec3 r0 = glm::vec3(recvModel * glm::vec4(receiverMesh.vertices[rv0].position, 1.0f));
+		glm::vec3 r1 = glm::vec3(recvModel * glm::vec4(receiverMesh.vertices[rv1].position, 1.0f));
+		glm::vec3 r2 = glm::vec3(recvModel * glm::vec4(receiverMesh.vertices[rv2].position, 1.0f));
+
+		float contactRatio = 0.0f;
+		if (rTri.area > 0.0f) {
+			contactRatio = pair.contactArea / rTri.area;
+		}
+
+		glm::vec3 patchColor = glm::vec3(0.1f, 0.4f, 1.0f);
+		if (contactRatio > 0.95f) {
+			patchColor = glm::vec3(1.0f, 0.2f, 0.1f);
+		}
+		ContactLineVertex l0{};
+		l0.position = r0;
+		l0.color = patchColor;
+		ContactLineVertex l1{};
+		l1.position = r1;
+		l1.color = patchColor;
+		outOutlineVertices.push_back(l0);
+		outOutlineVertices.push_back(l1);
+
+		ContactLineVertex l2{};
+		l2.position = r1;
+		l2.color = patchColor;
+		ContactLineVertex l3{};
+		l3.position = r2;
+		l3.color = patchColor;
+		outOutlineVertices.push_back(l2);
+		outOutlineVertices.push_back(l3);
+
+		ContactLineVertex l4{};
+		l4.position = r2;
+		l4.color = patchColor;
+		ContactLineVertex l5{};
+		l5.position = r0;
+		l5.color = patchColor;
+		outOutlineVertices.push_back(l4);
+		outOutlineVertices.push_back(l5);
+
+		glm::vec3 triN = glm::cross(r1 - r0, r2 - r0);
+		float triNLen2 = glm::dot(triN, triN);
+		if (triNLen2 > 1e-12f) {
+			triN *= (1.0f / std::sqrt(triNLen2));
+		}
+		glm::vec3 uDir = r1 - r0;
+		float uLen2 = glm::dot(uDir, uDir);
+		if (uLen2 > 1e-12f) {
+			uDir *= (1.0f / std::sqrt(uLen2));
+		}
+		glm::vec3 vDir = glm::cross(triN, uDir);
+		float vLen2 = glm::dot(vDir, vDir);
+		if (vLen2 > 1e-12f) {
+			vDir *= (1.0f / std::sqrt(vLen2));
+		}
+		float crossLen = std::sqrt(std::max(1e-12f, rTri.area)) * 0.1f;
+
+		for (uint32_t si = 0; si < Quadrature::count; ++si) {
+			const contact::Sample& s = pair.samples[si];
+			if (s.sourceTriangleIndex == iODT::INVALID_INDEX || s.wArea <= 0.0f) {
+				continue;
+			}
+			if (s.sourceTriangleIndex >= sourceMesh.triangles.size()) {
+				continue;
+			}
+
+			const glm::vec3 barycentricCoord = Quadrature::bary[si];
+			glm::vec3 recvSampleP = r0 * barycentricCoord.x + r1 * barycentricCoord.y + r2 * barycentricCoord.z;
+
+			const auto& sTri = sourceMesh.triangles[s.sourceTriangleIndex];
+			uint32_t si0 = sTri.vertexIndices[0];
+			uint32_t si1 = sTri.vertexIndices[1];
+			uint32_t si2 = sTri.vertexIndices[2];
+			if (si0 >= sourceMesh.vertices.size() || si1 >= sourceMesh.vertices.size() || si2 >= sourceMesh.vertices.size()) {
+				continue;
+			}
+
+			glm::vec3 sv0 = glm::vec3(srcModelMat2 * glm::vec4(sourceMesh.vertices[si0].position, 1.0f));
+			glm::vec3 sv1 = glm::vec3(srcModelMat2 * glm::vec4(sourceMesh.vertices[si1].position, 1.0f));
+			glm::vec3 sv2 = glm::vec3(srcModelMat2 * glm::vec4(sourceMesh.vertices[si2].position, 1.0f));
+			glm::vec3 sb = glm::vec3(1.0f - s.u - s.v, s.u, s.v);
+			glm::vec3 srcHitP = sv0 * sb.x + sv1 * sb.y + sv2 * sb.z;
+
+			ContactLineVertex a{};
+			a.position = recvSampleP;
+			a.color = glm::vec3(0.9f, 0.9f, 0.2f);
+			ContactLineVertex b0{};
+			b0.position = srcHitP;
+			b0.color = glm::vec3(1.0f, 0.1f, 0.2f);
+			outCorrespondenceVertices.push_back(a);
+			outCorrespondenceVertices.push_back(b0);
+
+			ContactLineVertex c0{};
+			c0.position = recvSampleP - uDir * crossLen;
+			c0.color = glm::vec3(0.9f, 0.9f, 0.2f);
+			ContactLineVertex c1{};
+			c1.position = recvSampleP + uDir * crossLen;
+			c1.color = glm::vec3(0.9f, 0.9f, 0.2f);
+			outCorrespondenceVertices.push_back(c0);
+			outCorrespondenceVertices.push_back(c1);
+
+			ContactLineVertex d0{};
+			d0.position = recvSampleP - vDir * crossLen;
+			d0.color = glm::vec3(0.9f, 0.9f, 0.2f);
+			ContactLineVertex d1{};
+			d1.position = recvSampleP + vDir * crossLen;
+			d1.color = glm::vec3(0.9f, 0.9f, 0.2f);
+			outCorrespondenceVertices.push_back(d0);
+			outCorrespondenceVertices.push_back(d1);
+		}
+	}
+}
+
 void mapSurfacePoints(
     const SupportingHalfedge::IntrinsicMesh& sourceMesh,
     const std::array<float, 16>& sourceLocalToWorld,
@@ -62,29 +342,15 @@ void mapSurfacePoints(
 
     std::vector<glm::vec3> sourcePositions;
     sourcePositions.reserve(sourceMesh.vertices.size());
-    glm::vec3 sourceBoundsMin(std::numeric_limits<float>::infinity());
-    glm::vec3 sourceBoundsMax(-std::numeric_limits<float>::infinity());
     for (const SupportingHalfedge::IntrinsicVertex& vertex : sourceMesh.vertices) {
         sourcePositions.push_back(vertex.position);
-        sourceBoundsMin = glm::min(sourceBoundsMin, vertex.position);
-        sourceBoundsMax = glm::max(sourceBoundsMax, vertex.position);
     }
 
-    const float contactPadding = std::max(contactRadius, 1e-4f);
-    const glm::vec3 contactPaddingVec(contactPadding);
-    TriangleHashGrid sourceTriangleGrid;
-    sourceTriangleGrid.build(
-        sourcePositions,
-        sourceMesh.indices,
-        sourceBoundsMin - contactPaddingVec,
-        sourceBoundsMax + contactPaddingVec,
-        contactPadding);
-
-    std::vector<size_t> candidateTriangles;
+    TriangleBVH sourceBvh;
+    sourceBvh.build(sourcePositions, sourceMesh.indices);
 
-    glm::mat4 srcModelMat = toMat4(sourceLocalToWorld);
-    glm::mat4 invSrcModelMat = glm::inverse(srcModelMat);
-	glm::mat3 srcNormalMat = glm::transpose(glm::inverse(glm::mat3(srcModelMat)));
+    std::vector<glm::vec3> sourceWorldNormals;
+    computeSourceWorldNormals(sourceMesh, sourceLocalToWorld, sourceWorldNormals);
 
 	receiverContactPairs.resize(receiverIntrinsicMeshes.size());
 
@@ -99,134 +365,18 @@ void mapSurfacePoints(
 		}
 		receiverContactPairs[receiverIdx].assign(receiverMesh->triangles.size(), ContactPair{});
 
-		glm::mat4 recvModelMat = toMat4(receiverLocalToWorld[receiverIdx]);
-		glm::mat3 recvNormalMat = glm::transpose(glm::inverse(glm::mat3(recvModelMat)));
-
-		for (size_t triIdx = 0; triIdx < receiverMesh->triangles.size(); triIdx++) {
-			const auto& rTri = receiverMesh->triangles[triIdx];
-			uint32_t rv0 = rTri.vertexIndices[0];
-			uint32_t rv1 = rTri.vertexIndices[1];
-			uint32_t rv2 = rTri.vertexIndices[2];
-			if (rv0 >= receiverMesh->vertices.size() || rv1 >= receiverMesh->vertices.size() || rv2 >= receiverMesh->vertices.size()) {
-				continue;
-			}
-
-			const glm::vec3 p0 = receiverMesh->vertices[rv0].position;
-			const glm::vec3 p1 = receiverMesh->vertices[rv1].position;
-			const glm::vec3 p2 = receiverMesh->vertices[rv2].position;
-
-			const glm::vec3 n0 = receiverMesh->vertices[rv0].normal;
-			const glm::vec3 n1 = receiverMesh->vertices[rv1].normal;
-			const glm::vec3 n2 = receiverMesh->vertices[rv2].normal;
-
-			ContactPair pair{};
-			for (uint32_t si = 0; si < Quadrature::count; ++si) {
-				pair.samples[si].sourceTriangleIndex = iODT::INVALID_INDEX;
-				pair.samples[si].u = 0.0f;
-				pair.samples[si].v = 0.0f;
-				pair.samples[si].wArea = 0.0f;
-			}
-			pair.contactArea = 0.0f;
-
-			const float recvArea = rTri.area;
-			if (recvArea <= 0.0f) {
-				receiverContactPairs[receiverIdx][triIdx] = pair;
-				continue;
-			}
-
-			for (uint32_t si = 0; si < Quadrature::count; ++si) {
-				const glm::vec3 barycentricCoord = Quadrature::bary[si];
-				glm::vec3 localPos = p0 * barycentricCoord.x + p1 * barycentricCoord.y + p2 * barycentricCoord.z;
-				glm::vec3 localN = n0 * barycentricCoord.x + n1 * barycentricCoord.y + n2 * barycentricCoord.z;
-				float localNLen2 = glm::dot(localN, localN);
-				if (localNLen2 < 1e-12f) {
-					continue;
-				}
-				localN *= (1.0f / std::sqrt(localNLen2));
-
-				glm::vec3 worldPos = glm::vec3(recvModelMat * glm::vec4(localPos, 1.0f));
-				glm::vec3 worldN = normalizedOrZero(glm::vec3(recvNormalMat * localN));
-				if (glm::dot(worldN, worldN) < 1e-12f) {
-					continue;
-				}
-
-				glm::vec3 srcPos = glm::vec3(invSrcModelMat * glm::vec4(worldPos, 1.0f));
-				glm::vec3 srcDirPlus = normalizedOrZero(glm::vec3(invSrcModelMat * glm::vec4(worldN, 0.0f)));
-				if (glm::dot(srcDirPlus, srcDirPlus) < 1e-12f) {
-					continue;
-				}
-
-				uint32_t bestTriIdx = iODT::INVALID_INDEX;
-				float bestT = std::numeric_limits<float>::infinity();
-				float bestU = 0.0f;
-				float bestV = 0.0f;
-
-                candidateTriangles.clear();
-                sourceTriangleGrid.getTrianglesAlongRay(
-                    srcPos,
-                    srcDirPlus,
-                    contactRadius,
-                    candidateTriangles);
-
-				for (size_t candidateTriIdx : candidateTriangles) {
-                    const uint32_t sTriIdx = static_cast<uint32_t>(candidateTriIdx);
-                    if (sTriIdx >= sourceMesh.triangles.size()) {
-                        continue;
-                    }
-					const auto& sTri = sourceMesh.triangles[sTriIdx];
-					uint32_t i0 = sTri.vertexIndices[0];
-					uint32_t i1 = sTri.vertexIndices[1];
-					uint32_t i2 = sTri.vertexIndices[2];
-					if (i0 >= sourceMesh.vertices.size() || i1 >= sourceMesh.vertices.size() || i2 >= sourceMesh.vertices.size()) {
-						continue;
-					}
-
-					glm::vec3 sNWorld = normalizedOrZero(glm::vec3(srcNormalMat * sTri.normal));
-					float nd = glm::dot(worldN, sNWorld);
-					if (minNormalDot < 0.0f) {
-						if (nd > minNormalDot) {
-							continue;
-						}
-					} else {
-						if (nd < minNormalDot) {
-							continue;
-						}
-					}
-
-					const glm::vec3& v0 = sourceMesh.vertices[i0].position;
-					const glm::vec3& v1 = sourceMesh.vertices[i1].position;
-					const glm::vec3& v2 = sourceMesh.vertices[i2].position;
-
-					float t = 0.0f;
-					float u = 0.0f;
-					float v = 0.0f;
-					if (!intersectRayTriangle(srcPos, srcDirPlus, v0, v1, v2, t, u, v)) {
-						continue;
-					}
-					if (t > contactRadius) {
-						continue;
-					}
-					if (t < bestT) {
-						bestT = t;
-						bestTriIdx = sTriIdx;
-						bestU = u;
-						bestV = v;
-					}
-				}
-
-				if (bestTriIdx != iODT::INVALID_INDEX) {
-					pair.samples[si].sourceTriangleIndex = bestTriIdx;
-					pair.samples[si].u = bestU;
-					pair.samples[si].v = bestV;
-					float weightedArea = Quadrature::weights[si] * recvArea;
-					pair.samples[si].wArea = weightedArea;
-					pair.contactArea += weightedArea;
-				}
-			}
-
-			receiverContactPairs[receiverIdx][triIdx] = pair;
-		}
-
+		sampleContactPairs(
+			sourceBvh,
+			sourceMesh,
+			sourceLocalToWorld,
+			sourceWorldNormals,
+			*receiverMesh,
+			receiverLocalToWorld[receiverIdx],
+			nullptr,
+			0,
+			receiverContactPairs[receiverIdx],
+			contactRadius,
+			minNormalDot);
 	}
 
 	outOutlineVertices.reserve(receiverIntrinsicMeshes.size() * 256);
@@ -241,142 +391,15 @@ void mapSurfacePoints(
 		if (!receiverMesh) {
 			continue;
 		}
-		if (receiverIdx >= receiverContactPairs.size()) {
-			continue;
-		}
-		const auto& contactPairs = receiverContactPairs[receiverIdx];
-
-		glm::mat4 recvModel = toMat4(receiverLocalToWorld[receiverIdx]);
-		glm::mat4 srcModelMat2 = toMat4(sourceLocalToWorld);
 
-		for (size_t triIdx = 0; triIdx < receiverMesh->triangles.size(); triIdx++) {
-			if (triIdx >= contactPairs.size()) {
-				continue;
-			}
-			const ContactPair& pair = contactPairs[triIdx];
-			if (pair.contactArea <= 0.0f) {
-				continue;
-			}
-
-			const auto& rTri = receiverMesh->triangles[triIdx];
-			uint32_t rv0 = rTri.vertexIndices[0];
-			uint32_t rv1 = rTri.vertexIndices[1];
-			uint32_t rv2 = rTri.vertexIndices[2];
-			if (rv0 >= receiverMesh->vertices.size() || rv1 >= receiverMesh->vertices.size() || rv2 >= receiverMesh->vertices.size()) {
-				continue;
-			}
-
-			glm::vec3 r0 = glm::vec3(recvModel * glm::vec4(receiverMesh->vertices[rv0].position, 1.0f));
-			glm::vec3 r1 = glm::vec3(recvModel * glm::vec4(receiverMesh->vertices[rv1].position, 1.0f));
-			glm::vec3 r2 = glm::vec3(recvModel * glm::vec4(receiverMesh->vertices[rv2].position, 1.0f));
-
-			float contactRatio = 0.0f;
-			if (rTri.area > 0.0f) {
-				contactRatio = pair.contactArea / rTri.area;
-			}
-
-			glm::vec3 patchColor = glm::vec3(0.1f, 0.4f, 1.0f);
-			if (contactRatio > 0.95f) {
-				patchColor = glm::vec3(1.0f, 0.2f, 0.1f);
-			}
-			ContactLineVertex l0{};
-			l0.position = r0;
-			l0.color = patchColor;
-			ContactLineVertex l1{};
-			l1.position = r1;
-			l1.color = patchColor;
-			outOutlineVertices.push_back(l0);
-			outOutlineVertices.push_back(l1);
-
-			ContactLineVertex l2{};
-			l2.position = r1;
-			l2.color = patchColor;
-			ContactLineVertex l3{};
-			l3.position = r2;
-			l3.color = patchColor;
-			outOutlineVertices.push_back(l2);
-			outOutlineVertices.push_back(l3);
-
-			ContactLineVertex l4{};
-			l4.position = r2;
-			l4.color = patchColor;
-			ContactLineVertex l5{};
-			l5.position = r0;
-			l5.color = patchColor;
-			outOutlineVertices.push_back(l4);
-			outOutlineVertices.push_back(l5);
-
-			glm::vec3 triN = glm::cross(r1 - r0, r2 - r0);
-			float triNLen2 = glm::dot(triN, triN);
-			if (triNLen2 > 1e-12f) {
-				triN *= (1.0f / std::sqrt(triNLen2));
-			}
-			glm::vec3 uDir = r1 - r0;
-			float uLen2 = glm::dot(uDir, uDir);
-			if (uLen2 > 1e-12f) {
-				uDir *= (1.0f / std::sqrt(uLen2));
-			}
-			glm::vec3 vDir = glm::cross(triN, uDir);
-			float vLen2 = glm::dot(vDir, vDir);
-			if (vLen2 > 1e-12f) {
-				vDir *= (1.0f / std::sqrt(vLen2));
-			}
-			float crossLen = std::sqrt(std::max(1e-12f, rTri.area)) * 0.1f;
-
-			for (uint32_t si = 0; si < Quadrature::count; ++si) {
-				const contact::Sample& s = pair.samples[si];
-				if (s.sourceTriangleIndex == iODT::INVALID_INDEX || s.wArea <= 0.0f) {
-					continue;
-				}
-				if (s.sourceTriangleIndex >= sourceMesh.triangles.size()) {
-					continue;
-				}
-
-				const glm::vec3 barycentricCoord = Quadrature::bary[si];
-				glm::vec3 recvSampleP = r0 * barycentricCoord.x + r1 * barycentricCoord.y + r2 * barycentricCoord.z;
-
-				const auto& sTri = sourceMesh.triangles[s.sourceTriangleIndex];
-				uint32_t si0 = sTri.vertexIndices[0];
-				uint32_t si1 = sTri.vertexIndices[1];
-				uint32_t si2 = sTri.vertexIndices[2];
-				if (si0 >= sourceMesh.vertices.size() || si1 >= sourceMesh.vertices.size() || si2 >= sourceMesh.vertices.size()) {
-					continue;
-				}
-
-				glm::vec3 sv0 = glm::vec3(srcModelMat2 * glm::vec4(sourceMesh.vertices[si0].position, 1.0f));
-				glm::vec3 sv1 = glm::vec3(srcModelMat2 * glm::vec4(sourceMesh.vertices[si1].position, 1.0f));
-				glm::vec3 sv2 = glm::vec3(srcModelMat2 * glm::vec4(sourceMesh.vertices[si2].position, 1.0f));
-				glm::vec3 sb = glm::vec3(1.0f - s.u - s.v, s.u, s.v);
-				glm::vec3 srcHitP = sv0 * sb.x + sv1 * sb.y + sv2 * sb.z;
-
-				ContactLineVertex a{};
-				a.position = recvSampleP;
-				a.color = glm::vec3(0.9f, 0.9f, 0.2f);
-				ContactLineVertex b0{};
-				b0.position = srcHitP;
-				b0.color = glm::vec3(1.0f, 0.1f, 0.2f);
-				outCorrespondenceVertices.push_back(a);
-				outCorrespondenceVertices.push_back(b0);
-
-				ContactLineVertex c0{};
-				c0.position = recvSampleP - uDir * crossLen;
-				c0.color = glm::vec3(0.9f, 0.9f, 0.2f);
-				ContactLineVertex c1{};
-				c1.position = recvSampleP + uDir * crossLen;
-				c1.color = glm::vec3(0.9f, 0.9f, 0.2f);
-				outCorrespondenceVertices.push_back(c0);
-				outCorrespondenceVertices.push_back(c1);
-
-				ContactLineVertex d0{};
-				d0.position = recvSampleP - vDir * crossLen;
-				d0.color = glm::vec3(0.9f, 0.9f, 0.2f);
-				ContactLineVertex d1{};
-				d1.position = recvSampleP + vDir * crossLen;
-				d1.color = glm::vec3(0.9f, 0.9f, 0.2f);
-				outCorrespondenceVertices.push_back(d0);
-				outCorrespondenceVertices.push_back(d1);
-			}
-		}
+		appendContactLines(
+			sourceMesh,
+			sourceLocalToWorld,
+			*receiverMesh,
+			receiverLocalToWorld[receiverIdx],
+			receiverContactPairs[receiverIdx],
+			outOutlineVertices,
+			outCorrespondenceVertices);
 	}
 
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <glm/glm.hpp>
 #include <vector>
@@ -7,6 +8,8 @@
 #include "contact/ContactTypes.hpp"
 #include "mesh/remesher/SupportingHalfedge.hpp"
 
+class TriangleBVH;
+
 struct Quadrature {
     static constexpr uint32_t count = 7u;
     static constexpr glm::vec3 bary[count] = {
@@ -35,6 +38,35 @@ struct ContactCellWeight {
     float weight = 0.0f;
 };
 
+// Samples the given receiver triangles (all of them when triangleIndices is null)
+// against a source BVH built in source local space, writing into contactPairs.
+void sampleContactPairs(
+    const TriangleBVH& sourceBvh,
+    const SupportingHalfedge::IntrinsicMesh& sourceMesh,
+    const std::array<float, 16>& sourceLocalToWorld,
+    const std::vector<glm::vec3>& sourceWorldNormals,
+    const SupportingHalfedge::IntrinsicMesh& receiverMesh,
+    const std::array<float, 16>& receiverLocalToWorld,
+    const uint32_t* triangleIndices,
+    uint32_t triangleIndexCount,
+    std::vector<ContactPair>& contactPairs,
+    float contactRadius,
+    float minNormalDot);
+
+void computeSourceWorldNormals(
+    const SupportingHalfedge::IntrinsicMesh& sourceMesh,
+    const std::array<float, 16>& sourceLocalToWorld,
+    std::vector<glm::vec3>& outNormals);
+
+void appendContactLines(
+    const SupportingHalfedge::IntrinsicMesh& sourceMesh,
+    const std::array<float, 16>& sourceLocalToWorld,
+    const SupportingHalfedge::IntrinsicMesh& receiverMesh,
+    const std::array<float, 16>& receiverLocalToWorld,
+    const std::vector<ContactPair>& contactPairs,
+    std::vector<ContactLineVertex>& outOutlineVertices,
+    std::vector<ContactLineVertex>& outCorrespondenceVertices);
+
 void mapSurfacePoints(
     const SupportingHalfedge::IntrinsicMesh& sourceIntrinsicMesh,
     const std::array<float, 16>& sourceLocalToWorld,
@@ -5,6 +5,7 @@
 #include "vulkan/VulkanBuffer.hpp"
 #include "vulkan/VulkanDevice.hpp"
 
+#include <cstring>
 #include <vector>
 
 namespace {
@@ -19,12 +20,28 @@ bool hasUsableContactPairs(const std::vector<ContactPair>& pairs) {
     return false;
 }
 
+template <typename T>
+bool samePodVector(const std::vector<T>& lhs, const std::vector<T>& rhs) {
+    return lhs.size() == rhs.size() &&
+        (lhs.empty() || std::memcmp(lhs.data(), rhs.data(), sizeof(T) * lhs.size()) == 0);
+}
+
+bool sameIntrinsicMesh(const SupportingHalfedge::IntrinsicMesh& lhs, const SupportingHalfedge::IntrinsicMesh& rhs) {
+    return samePodVector(lhs.vertices, rhs.vertices) &&
+        samePodVector(lhs.indices, rhs.indices) &&
+        samePodVector(lhs.faceIds, rhs.faceIds) &&
+        samePodVector(lhs.triangles, rhs.triangles);
+}
+
 }
 
 void ContactSystemRuntime::setParams(
     ContactCouplingType updatedCouplingType,
     float updatedMinNormalDot,
     float updatedContactRadius) {
+    if (updatedMinNormalDot != minNormalDot || updatedContactRadius != contactRadius) {
+        contactMapper.invalidate();
+    }
     couplingType = updatedCouplingType;
     minNormalDot = updatedMinNormalDot;
     contactRadius = updatedContactRadius;
@@ -36,9 +53,13 @@ void ContactSystemRuntime::setEmitterState(
     const std::array<float, 16>& localToWorld,
     const SupportingHalfedge::IntrinsicMesh& intrinsicMesh,
     uint32_t runtimeModelId) {
+    // A pure transform change keeps the cached BVH and contact band
+    if (modelId != emitterModelId || !sameIntrinsicMesh(intrinsicMesh, emitterIntrinsicMesh)) {
+        emitterIntrinsicMesh = intrinsicMesh;
+        contactMapper.invalidate();
+    }
     emitterModelId = modelId;
     emitterLocalToWorld = localToWorld;
-    emitterIntrinsicMesh = intrinsicMesh;
     emitterRuntimeModelId = runtimeModelId;
     bindingDirty = true;
 }
@@ -48,9 +69,12 @@ void ContactSystemRuntime::setReceiverState(
     const std::array<float, 16>& localToWorld,
     const SupportingHalfedge::IntrinsicMesh& intrinsicMesh,
     uint32_t runtimeModelId) {
+    if (modelId != receiverModelId || !sameIntrinsicMesh(intrinsicMesh, receiverIntrinsicMesh)) {
+        receiverIntrinsicMesh = intrinsicMesh;
+        contactMapper.invalidate();
+    }
     receiverModelId = modelId;
     receiverLocalToWorld = localToWorld;
-    receiverIntrinsicMesh = intrinsicMesh;
     receiverRuntimeModelId = runtimeModelId;
     bindingDirty = true;
 }
@@ -136,6 +160,7 @@ void ContactSystemRuntime::clear(MemoryAllocator& memoryAllocator) {
     receiverIntrinsicMesh = {};
     receiverRuntimeModelId = 0;
     receiverTriangleIndices.clear();
+    contactMapper.invalidate();
     bindingDirty = false;
 }
 
@@ -159,49 +184,51 @@ bool ContactSystemRuntime::computeContactPairs(std::vector<ContactPair>& outPair
         return false;
     }
 
-    std::vector<std::vector<ContactPair>> receiverContactPairs;
-    std::vector<const SupportingHalfedge::IntrinsicMesh*> receiverIntrinsicMeshes;
-    std::vector<std::array<float, 16>> receiverLocalToWorlds;
-    receiverIntrinsicMeshes.push_back(&receiverIntrinsicMesh);
-    receiverLocalToWorlds.push_back(receiverLocalToWorld);
-
-    std::vector<ContactLineVertex> computedOutlineVertices;
-    std::vector<ContactLineVertex> computedCorrespondenceVertices;
-
-    mapSurfacePoints(
+    contactMapper.map(
         emitterIntrinsicMesh,
         emitterLocalToWorld,
-        receiverIntrinsicMeshes,
-        receiverLocalToWorlds,
-        receiverContactPairs,
-        computedOutlineVertices,
-        computedCorrespondenceVertices,
+        receiverIntrinsicMesh,
+        receiverLocalToWorld,
         contactRadius,
         minNormalDot);
 
-    outlineVertices = std::move(computedOutlineVertices);
-    correspondenceVertices = std::move(computedCorrespondenceVertices);
-
-    if (!receiverContactPairs.empty()) {
-        outPairs = std::move(receiverContactPairs.front());
-    }
+    outPairs = contactMapper.getContactPairs();
+    outlineVertices = contactMapper.getOutlineVertices();
+    correspondenceVertices = contactMapper.getCorrespondenceVertices();
     return hasUsableContactPairs(outPairs);
 }
 
 bool ContactSystemRuntime::buildCoupling(
     VulkanDevice& vulkanDevice,
     MemoryAllocator& memoryAllocator) {
-    clearComputedState(memoryAllocator);
-
     if (!hasValidBinding()) {
+        clearComputedState(memoryAllocator);
         return false;
     }
 
     std::vector<ContactPair> pairs;
     if (!computeContactPairs(pairs) || pairs.empty()) {
+        clearComputedState(memoryAllocator);
         return false;
     }
 
+    // Small nudges often leave the sampled pairs untouched; keep the uploaded buffer then
+    if (couplingValid &&
+        coupling.couplingType == couplingType &&
+        coupling.emitterRuntimeModelId == emitterRuntimeModelId &&
+        coupling.receiverRuntimeModelId == receiverRuntimeModelId &&
+        coupling.receiverTriangleIndices == receiverTriangleIndices &&
+        coupling.contactPairCount == pairs.size() &&
+        std::memcmp(coupling.mappedContactPairs, pairs.data(), sizeof(ContactPair) * pairs.size()) == 0) {
+        bindingDirty = false;
+        return true;
+    }
+
+    clearPairBuffer(memoryAllocator);
+    coupling = {};
+    couplingValid = false;
+    hasContactFlag = false;
+
     coupling.couplingType = couplingType;
     coupling.emitterRuntimeModelId = emitterRuntimeModelId;
     coupling.receiverRuntimeModelId = receiverRuntimeModelId;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "contact/ContactTypes.hpp"
+#include "contact/IncrementalContactMapper.hpp"
 #include "runtime/RuntimeProducts.hpp"
 
 #include <vector>
@@ -37,6 +38,7 @@ public:
     const std::vector<ContactLineVertex>& getOutlineVertices() const { return outlineVertices; }
     const std::vector<ContactLineVertex>& getCorrespondenceVertices() const { return correspondenceVertices; }
     bool hasContact() const { return hasContactFlag; }
+    const IncrementalContactMapper::Stats& getMappingStats() const { return contactMapper.getLastStats(); }
 
 private:
     void clearPairBuffer(MemoryAllocator& memoryAllocator);
@@ -73,6 +75,7 @@ private:
     SupportingHalfedge::IntrinsicMesh receiverIntrinsicMesh;
     uint32_t receiverRuntimeModelId = 0;
     std::vector<uint32_t> receiverTriangleIndices;
+    IncrementalContactMapper contactMapper;
     ContactCoupling coupling{};
     VkBuffer contactPairBuffer = VK_NULL_HANDLE;
     VkDeviceSize contactPairBufferOffset = 0;
@@ -0,0 +1,176 @@
+#include "IncrementalContactMapper.hpp"
+
+#include "contact/ContactSampling.hpp"
+#include "nodegraph/NodeModelTransform.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <omp.h>
+
+namespace {
+
+ContactPair makeEmptyContactPair() {
+    ContactPair pair{};
+    for (contact::Sample& sample : pair.samples) {
+        sample.sourceTriangleIndex = SupportingHalfedge::INVALID_INDEX;
+    }
+    return pair;
+}
+
+}
+
+void IncrementalContactMapper::invalidate() {
+    sourceBvh.clear();
+    sourceWorldNormals.clear();
+    sourceValid = false;
+    normalsValid = false;
+    bandTriangles.clear();
+    bandValid = false;
+    contactPairs.clear();
+    outlineVertices.clear();
+    correspondenceVertices.clear();
+}
+
+void IncrementalContactMapper::map(
+    const SupportingHalfedge::IntrinsicMesh& sourceMesh,
+    const std::array<float, 16>& sourceLocalToWorld,
+    const SupportingHalfedge::IntrinsicMesh& receiverMesh,
+    const std::array<float, 16>& receiverLocalToWorld,
+    float contactRadius,
+    float minNormalDot) {
+    lastStats = {};
+    outlineVertices.clear();
+    correspondenceVertices.clear();
+
+    if (sourceMesh.triangles.empty()) {
+        contactPairs.assign(receiverMesh.triangles.size(), makeEmptyContactPair());
+        bandValid = false;
+        return;
+    }
+
+    if (!sourceValid) {
+        rebuildSource(sourceMesh);
+    }
+    if (!normalsValid || normalsSourceLocalToWorld != sourceLocalToWorld) {
+        computeSourceWorldNormals(sourceMesh, sourceLocalToWorld, sourceWorldNormals);
+        normalsSourceLocalToWorld = sourceLocalToWorld;
+        normalsValid = true;
+    }
+
+    const glm::mat4 receiverToSource =
+        glm::inverse(NodeModelTransform::toMat4(sourceLocalToWorld)) * NodeModelTransform::toMat4(receiverLocalToWorld);
+
+    const bool pairsMatchReceiver = contactPairs.size() == receiverMesh.triangles.size();
+    if (bandValid && pairsMatchReceiver && receiverToSource == lastReceiverToSource) {
+        // Only the shared world placement moved; samples are unchanged
+        lastStats.updateKind = UpdateKind::Unchanged;
+    } else if (bandValid && pairsMatchReceiver && maxDisplacement(bandReceiverToSource, receiverToSource) <= bandMargin) {
+        lastStats.updateKind = UpdateKind::Incremental;
+    } else {
+        lastStats.updateKind = UpdateKind::Rebuild;
+        bandMargin = BAND_MARGIN_SCALE * std::max(contactRadius, 0.0f);
+        rebuildBand(receiverMesh, receiverToSource, std::max(contactRadius, 0.0f) + bandMargin);
+        contactPairs.assign(receiverMesh.triangles.size(), makeEmptyContactPair());
+    }
+
+    if (lastStats.updateKind != UpdateKind::Unchanged && !bandTriangles.empty()) {
+        sampleContactPairs(
+            sourceBvh,
+            sourceMesh,
+            sourceLocalToWorld,
+            sourceWorldNormals,
+            receiverMesh,
+            receiverLocalToWorld,
+            bandTriangles.data(),
+            static_cast<uint32_t>(bandTriangles.size()),
+            contactPairs,
+            contactRadius,
+            minNormalDot);
+        lastStats.evaluatedTriangleCount = static_cast<uint32_t>(bandTriangles.size());
+    }
+    lastReceiverToSource = receiverToSource;
+    lastStats.bandTriangleCount = static_cast<uint32_t>(bandTriangles.size());
+
+    appendContactLines(
+        sourceMesh,
+        sourceLocalToWorld,
+        receiverMesh,
+        receiverLocalToWorld,
+        contactPairs,
+        outlineVertices,
+        correspondenceVertices);
+}
+
+void IncrementalContactMapper::rebuildSource(const SupportingHalfedge::IntrinsicMesh& sourceMesh) {
+    std::vector<glm::vec3> sourcePositions;
+    sourcePositions.reserve(sourceMesh.vertices.size());
+    for (const SupportingHalfedge::IntrinsicVertex& vertex : sourceMesh.vertices) {
+        sourcePositions.push_back(vertex.position);
+    }
+
+    sourceBvh.build(sourcePositions, sourceMesh.indices);
+    sourceValid = true;
+}
+
+void IncrementalContactMapper::rebuildBand(
+    const SupportingHalfedge::IntrinsicMesh& receiverMesh,
+    const glm::mat4& receiverToSource,
+    float bandRadius) {
+    receiverBoundsMin = glm::vec3(std::numeric_limits<float>::infinity());
+    receiverBoundsMax = glm::vec3(-std::numeric_limits<float>::infinity());
+    for (const SupportingHalfedge::IntrinsicVertex& vertex : receiverMesh.vertices) {
+        receiverBoundsMin = glm::min(receiverBoundsMin, vertex.position);
+        receiverBoundsMax = glm::max(receiverBoundsMax, vertex.position);
+    }
+
+    const int triangleCount = static_cast<int>(receiverMesh.triangles.size());
+    std::vector<uint8_t> inBand(receiverMesh.triangles.size(), 0u);
+
+    #pragma omp parallel for schedule(dynamic, 256)
+    for (int triIdx = 0; triIdx < triangleCount; ++triIdx) {
+        const auto& tri = receiverMesh.triangles[triIdx];
+        const uint32_t v0 = tri.vertexIndices[0];
+        const uint32_t v1 = tri.vertexIndices[1];
+        const uint32_t v2 = tri.vertexIndices[2];
+        if (v0 >= receiverMesh.vertices.size() || v1 >= receiverMesh.vertices.size() || v2 >= receiverMesh.vertices.size()) {
+            continue;
+        }
+
+        const glm::vec3 p0 = glm::vec3(receiverToSource * glm::vec4(receiverMesh.vertices[v0].position, 1.0f));
+        const glm::vec3 p1 = glm::vec3(receiverToSource * glm::vec4(receiverMesh.vertices[v1].position, 1.0f));
+        const glm::vec3 p2 = glm::vec3(receiverToSource * glm::vec4(receiverMesh.vertices[v2].position, 1.0f));
+        const glm::vec3 centroid = (p0 + p1 + p2) * (1.0f / 3.0f);
+        const float triangleRadius = std::sqrt(std::max(
+            glm::dot(p0 - centroid, p0 - centroid),
+            std::max(glm::dot(p1 - centroid, p1 - centroid), glm::dot(p2 - centroid, p2 - centroid))));
+
+        if (sourceBvh.hasTriangleWithin(centroid, bandRadius + triangleRadius)) {
+            inBand[triIdx] = 1u;
+        }
+    }
+
+    bandTriangles.clear();
+    for (int triIdx = 0; triIdx < triangleCount; ++triIdx) {
+        if (inBand[triIdx] != 0u) {
+            bandTriangles.push_back(static_cast<uint32_t>(triIdx));
+        }
+    }
+
+    bandReceiverToSource = receiverToSource;
+    bandValid = true;
+}
+
+float IncrementalContactMapper::maxDisplacement(const glm::mat4& fromReceiverToSource, const glm::mat4& toReceiverToSource) const {
+    // Displacement is affine in the receiver point, so its maximum over the bounds is at a corner
+    const glm::mat4 delta = toReceiverToSource - fromReceiverToSource;
+    float maxDistance = 0.0f;
+    for (int corner = 0; corner < 8; ++corner) {
+        const glm::vec3 point(
+            (corner & 1) ? receiverBoundsMax.x : receiverBoundsMin.x,
+            (corner & 2) ? receiverBoundsMax.y : receiverBoundsMin.y,
+            (corner & 4) ? receiverBoundsMax.z : receiverBoundsMin.z);
+        maxDistance = std::max(maxDistance, glm::length(glm::vec3(delta * glm::vec4(point, 1.0f))));
+    }
+    return maxDistance;
+}
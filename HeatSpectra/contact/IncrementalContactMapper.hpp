@@ -0,0 +1,72 @@
+#pragma once
+
+#include "contact/ContactTypes.hpp"
+#include "mesh/remesher/SupportingHalfedge.hpp"
+#include "spatial/TriangleBVH.hpp"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// Keeps the source BVH and the receiver contact band between updates so a rigid
+// nudge only re-samples receiver triangles that can still reach the source.
+// The band holds every receiver triangle whose centroid was within
+// contactRadius + margin + triangle radius of the source; while the receiver has
+// moved less than margin relative to the source since then, triangles outside
+// the band cannot produce a hit within contactRadius.
+class IncrementalContactMapper {
+public:
+    enum class UpdateKind : uint32_t {
+        Unchanged,
+        Incremental,
+        Rebuild
+    };
+
+    struct Stats {
+        UpdateKind updateKind = UpdateKind::Rebuild;
+        uint32_t bandTriangleCount = 0;
+        uint32_t evaluatedTriangleCount = 0;
+    };
+
+    // Call when either mesh or the contact parameters change.
+    void invalidate();
+
+    void map(
+        const SupportingHalfedge::IntrinsicMesh& sourceMesh,
+        const std::array<float, 16>& sourceLocalToWorld,
+        const SupportingHalfedge::IntrinsicMesh& receiverMesh,
+        const std::array<float, 16>& receiverLocalToWorld,
+        float contactRadius,
+        float minNormalDot);
+
+    const std::vector<ContactPair>& getContactPairs() const { return contactPairs; }
+    const std::vector<ContactLineVertex>& getOutlineVertices() const { return outlineVertices; }
+    const std::vector<ContactLineVertex>& getCorrespondenceVertices() const { return correspondenceVertices; }
+    const Stats& getLastStats() const { return lastStats; }
+
+private:
+    static constexpr float BAND_MARGIN_SCALE = 1.0f;
+
+    void rebuildSource(const SupportingHalfedge::IntrinsicMesh& sourceMesh);
+    void rebuildBand(const SupportingHalfedge::IntrinsicMesh& receiverMesh, const glm::mat4& receiverToSource, float bandRadius);
+    float maxDisplacement(const glm::mat4& fromReceiverToSource, const glm::mat4& toReceiverToSource) const;
+
+    TriangleBVH sourceBvh;
+    std::vector<glm::vec3> sourceWorldNormals;
+    std::array<float, 16> normalsSourceLocalToWorld{};
+    bool sourceValid = false;
+    bool normalsValid = false;
+
+    glm::vec3 receiverBoundsMin = glm::vec3(0.0f);
+    glm::vec3 receiverBoundsMax = glm::vec3(0.0f);
+    std::vector<uint32_t> bandTriangles;
+    glm::mat4 bandReceiverToSource = glm::mat4(1.0f);
+    glm::mat4 lastReceiverToSource = glm::mat4(1.0f);
+    float bandMargin = 0.0f;
+    bool bandValid = false;
+
+    std::vector<ContactPair> contactPairs;
+    std::vector<ContactLineVertex> outlineVertices;
+    std::vector<ContactLineVertex> correspondenceVertices;
+    Stats lastStats{};
+};
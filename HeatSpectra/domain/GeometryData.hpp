@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -21,8 +22,19 @@ struct GeometryGroup {
     std::string source;
 };
 
+// Mesh arrays shared by every payload derived from the same geometry. Treat a
+// block as immutable once it is reachable from more than one GeometryData.
+struct GeometryMesh {
+    std::vector<float> pointPositions;
+    std::vector<uint32_t> triangleIndices;
+    std::vector<uint32_t> triangleGroupIds;
+};
+
 struct GeometryData {
     uint64_t payloadHash = 0;
+    // Block hash of mesh, 0 until computed. It is carried along with the shared
+    // block and cleared by editMesh().
+    uint64_t contentHash = 0;
     std::string baseModelPath;
     std::array<float, 16> localToWorld{
         1.0f, 0.0f, 0.0f, 0.0f,
@@ -30,10 +42,22 @@ struct GeometryData {
         0.0f, 0.0f, 1.0f, 0.0f,
         0.0f, 0.0f, 0.0f, 1.0f
     };
-    std::vector<float> pointPositions;
-    std::vector<uint32_t> triangleIndices;
-    std::vector<uint32_t> triangleGroupIds;
+    std::shared_ptr<const GeometryMesh> mesh;
     std::vector<GeometryGroup> groups;
 
+    const std::vector<float>& pointPositions() const { return meshOrEmpty().pointPositions; }
+    const std::vector<uint32_t>& triangleIndices() const { return meshOrEmpty().triangleIndices; }
+    const std::vector<uint32_t>& triangleGroupIds() const { return meshOrEmpty().triangleGroupIds; }
+
+    // Copy-on-write access: clones the block first when another payload shares it.
+    GeometryMesh& editMesh();
+
     void sealPayload();
+    void ensureContentHash();
+
+private:
+    const GeometryMesh& meshOrEmpty() const {
+        static const GeometryMesh emptyMesh;
+        return mesh ? *mesh : emptyMesh;
+    }
 };
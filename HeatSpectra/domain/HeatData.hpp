@@ -1,7 +1,10 @@
 #pragma once
 
 #include "nodegraph/NodeGraphCoreTypes.hpp"
+#include "heat/HeatCpuSolver.hpp"
 #include "heat/HeatSystemPresets.hpp"
+#include "heat/SimulationClock.hpp"
+#include "heat/TemperatureRecordFormat.hpp"
 
 #include <vector>
 
@@ -42,6 +45,9 @@ struct HeatData {
     std::vector<NodeDataHandle> receiverMeshHandles;
     std::vector<HeatMaterialBinding> materialBindings;
     float contactThermalConductance = 16000.0f;
+    SimulationClockSettings clockSettings{};
+    TemperatureRecordSettings recordSettings{};
+    HeatSolverSettings solverSettings{};
     bool active = false;
     bool paused = false;
     bool resetRequested = false;
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "voronoi/VoronoiGpuStructs.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+enum class HeatSolverMode : uint8_t {
+    GpuSubsteps = 0,
+    CpuJacobi = 1,
+    CpuGaussSeidel = 2,
+    CpuBiCGStab = 3,
+};
+
+struct HeatSolverSettings {
+    HeatSolverMode mode = HeatSolverMode::GpuSubsteps;
+    float residualTolerance = 1e-4f;
+    uint32_t maxIterations = 500;
+};
+
+// Host-side reference of the heat_voronoi.comp diffusion step. Consumes the same
+// node/interface/material/contact arrays the GPU path binds, so a simulation can
+// run headless and be compared against GPU readbacks. HeatSystem runs its
+// implicit solves in place of the GPU substeps when HeatSolverSettings picks a
+// CPU mode.
+class HeatCpuSolver {
+public:
+    enum class ImplicitSolver {
+        Jacobi,
+        GaussSeidel,
+        BiCGStab
+    };
+
+    struct SolveResult {
+        uint32_t iterations = 0;
+        float residual = 0.0f;
+        bool converged = false;
+    };
+
+    struct Inputs {
+        uint32_t nodeCount = 0;
+        const voronoi::Node* nodes = nullptr;
+        const voronoi::GMLSInterface* interfaces = nullptr;
+        size_t interfaceCount = 0;
+        const voronoi::MaterialNode* materialNodes = nullptr;
+        const uint32_t* seedFlags = nullptr;
+        const float* contactConductance = nullptr;
+        uint32_t contactConductanceNodeCount = 0;
+    };
+
+    bool initialize(const Inputs& inputs);
+    void reset(float ambientTemperature = AMBIENT_TEMPERATURE);
+    void cleanup();
+
+    bool isInitialized() const { return nodeCount != 0; }
+    uint32_t getNodeCount() const { return nodeCount; }
+
+    // Advances one frame of deltaTime split into numSubsteps implicit updates,
+    // matching HeatSystem::update + HeatSystemSimStage::recordComputeCommands.
+    void step(float deltaTime, float heatSourceTemperature, uint32_t numSubsteps);
+    void run(uint32_t stepCount, float deltaTime, float heatSourceTemperature, uint32_t numSubsteps);
+    // Picks the substep count from heat::chooseSubstepCount. After each substep it
+    // takes the current field as the solution of one implicit step over the
+    // remaining time. Once that step's scaled residual (as in stepImplicit) drops
+    // below residualTolerance, the remaining substeps are merged into one. The GPU
+    // substeps in HeatSystem always run the full count, so results can differ from
+    // the GPU's by about residualTolerance per frame. Returns the substeps taken.
+    uint32_t stepAdaptive(float deltaTime, float heatSourceTemperature, float residualTolerance);
+    // Solves one backward-Euler step of deltaTime until the largest residual,
+    // scaled by its diagonal so it reads in temperature units, drops below
+    // residualTolerance. All three solve the system heat_voronoi.comp relaxes:
+    // Jacobi iterates its update, GaussSeidel does so in place one color class at
+    // a time, and BiCGStab runs Jacobi-preconditioned BiCGSTAB, since the
+    // conductivity per mass differs across an interface and the system is not
+    // symmetric. The solution is clamped at zero like the shader.
+    SolveResult stepImplicit(
+        ImplicitSolver solver,
+        float deltaTime,
+        float heatSourceTemperature,
+        float residualTolerance,
+        uint32_t maxIterations);
+
+    const std::vector<float>& getTemperatures() const { return readsBufferA ? temperaturesA : temperaturesB; }
+    bool setTemperatures(const float* temperatures, uint32_t count);
+    float getTotalTime() const { return totalTime; }
+    float getMaxDiffusionRate() const { return maxDiffusionRate; }
+    uint32_t getColorCount() const { return colorOffsets.empty() ? 0u : static_cast<uint32_t>(colorOffsets.size() - 1); }
+
+    static float maxAbsDifference(const float* lhs, const float* rhs, uint32_t count);
+
+private:
+    static constexpr float AMBIENT_TEMPERATURE = 1.0f;
+
+    void substep(const float* readTemperatures, float* writeTemperatures, float dt, float heatSourceTemperature) const;
+    void buildColoring();
+
+    float implicitDiagonal(uint32_t node, float dt) const;
+    float relaxedTemperature(uint32_t node, const float* temperatures, float dt, float heatSourceTemperature) const;
+    float relaxationResidual(const float* temperatures, float dt, float heatSourceTemperature) const;
+    void applyImplicitOperator(const float* temperatures, float* product, float dt) const;
+    SolveResult solveRelaxation(bool inPlace, float dt, float heatSourceTemperature, float residualTolerance, uint32_t maxIterations);
+    SolveResult solveBiCGStab(float dt, float heatSourceTemperature, float residualTolerance, uint32_t maxIterations);
+
+    uint32_t nodeCount = 0;
+
+    // Per-node SoA streams
+    std::vector<uint32_t> neighborOffsets;
+    std::vector<float> conductanceSums;
+    std::vector<float> conductivityPerMass;
+    std::vector<float> inverseThermalMass;
+    std::vector<float> contactConductances;
+    std::vector<uint8_t> fixedFlags;
+
+    // Flattened interface streams
+    std::vector<uint32_t> neighborIndices;
+    std::vector<float> neighborConductances;
+
+    // Free nodes grouped so no two nodes of a class share an interface
+    std::vector<uint32_t> colorOffsets;
+    std::vector<uint32_t> colorNodes;
+
+    // Implicit step scratch
+    std::vector<float> previousTemperatures;
+    std::vector<float> krylovDiagonal;
+    std::vector<float> krylovResidual;
+    std::vector<float> krylovShadowResidual;
+    std::vector<float> krylovDirection;
+    std::vector<float> krylovPreconditionedDirection;
+    std::vector<float> krylovDirectionProduct;
+    std::vector<float> krylovPartialResidual;
+    std::vector<float> krylovPreconditionedPartial;
+    std::vector<float> krylovPartialProduct;
+
+    std::vector<float> temperaturesA;
+    std::vector<float> temperaturesB;
+    bool readsBufferA = true;
+    float totalTime = 0.0f;
+    float maxDiffusionRate = 0.0f;
+};
@@ -0,0 +1,363 @@
+#include "HeatSolverBenchmarkCli.hpp"
+
+#include "HeatCpuSolver.hpp"
+#include "HeatDefaults.hpp"
+#include "runtime/RuntimeThermalTypes.hpp"
+#include "spatial/VoxelGrid.hpp"
+#include "util/ObjMeshLoader.hpp"
+#include "voronoi/VoronoiCellClipper.hpp"
+#include "voronoi/VoronoiGpuStructs.hpp"
+#include "voronoi/VoronoiIntegrator.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr const char* BENCH_COMMAND = "--bench-heat-solvers";
+constexpr int VOXEL_RESOLUTION = 128;
+constexpr uint32_t MAX_NEIGHBORS = 50;
+constexpr float SOURCE_FRACTION = 0.1f;
+constexpr double MIN_RELATIVE_VOLUME = 0.01;
+
+struct BenchmarkOptions {
+    std::vector<std::string> modelPaths;
+    uint32_t cellCount = 20000;
+    float deltaTime = 1.0f;
+    float residualTolerance = 1e-4f;
+    uint32_t maxIterations = 20000;
+};
+
+struct HeatProblem {
+    std::vector<voronoi::Node> nodes;
+    std::vector<voronoi::GMLSInterface> interfaces;
+    std::vector<voronoi::MaterialNode> materialNodes;
+    std::vector<uint32_t> seedFlags;
+    std::vector<float> contactConductance;
+};
+
+void printUsage() {
+    std::cerr << "Usage:\n"
+              << "  HeatSpectra " << BENCH_COMMAND << " [--model <file.obj>]... [--cells <count>] [--dt <seconds>] "
+              << "[--tolerance <kelvin>] [--max-iterations <count>]" << std::endl;
+}
+
+bool parsePositive(const char* text, uint32_t& outValue) {
+    if (!text || *text == '\0') {
+        return false;
+    }
+    char* end = nullptr;
+    const unsigned long long value = std::strtoull(text, &end, 10);
+    if (*end != '\0' || value == 0 || value > UINT32_MAX) {
+        return false;
+    }
+    outValue = static_cast<uint32_t>(value);
+    return true;
+}
+
+bool parsePositive(const char* text, float& outValue) {
+    if (!text || *text == '\0') {
+        return false;
+    }
+    char* end = nullptr;
+    const float value = std::strtof(text, &end);
+    if (*end != '\0' || !(value > 0.0f) || !std::isfinite(value)) {
+        return false;
+    }
+    outValue = value;
+    return true;
+}
+
+// Jittered lattice seeds inside the voxelised mesh, then the same clipping and
+// FTPA conductances VoronoiBuilder produces. The lowest tenth of the cells touches
+// a heat source so the step has something to solve.
+bool buildProblem(const std::string& path, uint32_t cellCount, HeatProblem& problem) {
+    std::vector<glm::vec3> positions;
+    std::vector<uint32_t> indices;
+    if (!loadObjTriangles(path, positions, indices)) {
+        return false;
+    }
+
+    glm::vec3 minBounds(FLT_MAX);
+    glm::vec3 maxBounds(-FLT_MAX);
+    double meshVolume = 0.0;
+    for (const glm::vec3& position : positions) {
+        minBounds = glm::min(minBounds, position);
+        maxBounds = glm::max(maxBounds, position);
+    }
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        const glm::dvec3 a(positions[indices[i]]);
+        const glm::dvec3 b(positions[indices[i + 1]]);
+        const glm::dvec3 c(positions[indices[i + 2]]);
+        meshVolume += glm::dot(a, glm::cross(b, c)) / 6.0;
+    }
+    meshVolume = std::abs(meshVolume);
+    if (meshVolume <= 0.0) {
+        std::cerr << "[HeatSolverBenchmark] Model encloses no volume: " << path << std::endl;
+        return false;
+    }
+
+    VoxelGrid voxelGrid;
+    voxelGrid.build(positions, indices, VOXEL_RESOLUTION);
+
+    const float spacing = static_cast<float>(std::cbrt(meshVolume / cellCount));
+    const glm::ivec3 latticeDim = glm::max(glm::ivec3(glm::ceil((maxBounds - minBounds) / spacing)), glm::ivec3(1));
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> jitter(-0.25f, 0.25f);
+    std::vector<glm::dvec3> seedPositions;
+    for (int z = 0; z < latticeDim.z; ++z) {
+        for (int y = 0; y < latticeDim.y; ++y) {
+            for (int x = 0; x < latticeDim.x; ++x) {
+                const glm::vec3 offset(x + 0.5f + jitter(generator), y + 0.5f + jitter(generator), z + 0.5f + jitter(generator));
+                const glm::vec3 seed = minBounds + offset * spacing;
+                const glm::ivec3 voxel = voxelGrid.worldToVoxel(seed);
+                if (voxelGrid.getOccupancy(voxel.x, voxel.y, voxel.z) != 0) {
+                    seedPositions.push_back(glm::dvec3(seed));
+                }
+            }
+        }
+    }
+    if (seedPositions.size() < 2) {
+        std::cerr << "[HeatSolverBenchmark] Too few interior seeds for " << path << std::endl;
+        return false;
+    }
+
+    VoronoiIntegrator integrator;
+    integrator.computeNeighbors(seedPositions, static_cast<int>(MAX_NEIGHBORS));
+    integrator.extractMeshTriangles(positions, indices);
+
+    const uint32_t nodeCount = static_cast<uint32_t>(seedPositions.size());
+    problem.seedFlags.assign(nodeCount, 0u);
+
+    VoronoiCellClipper::Inputs clipperInputs;
+    clipperInputs.seedPositions = integrator.getSeedPositions().data();
+    clipperInputs.seedFlags = problem.seedFlags.data();
+    clipperInputs.neighborIndices = integrator.getNeighborIndices().data();
+    clipperInputs.maxNeighbors = MAX_NEIGHBORS;
+    clipperInputs.meshTriangles = &integrator.getMeshTriangles();
+    clipperInputs.voxelGrid = &voxelGrid;
+    clipperInputs.nodeOffset = 0;
+    clipperInputs.nodeCount = nodeCount;
+    VoronoiCellClipper::HostCells cells;
+    if (!VoronoiCellClipper(clipperInputs).clipCells(cells)) {
+        return false;
+    }
+    problem.nodes = std::move(cells.nodes);
+    const std::vector<float>& areas = cells.interfaceAreas;
+    const std::vector<uint32_t>& neighborIds = cells.interfaceNeighborIds;
+
+    // Lattice points the voxel test let through from just outside the surface
+    // clip to slivers; they become ghost nodes like VoronoiBuilder's
+    double totalVolume = 0.0;
+    for (const voronoi::Node& node : problem.nodes) {
+        totalVolume += std::abs(node.volume);
+    }
+    const float minVolume = static_cast<float>(MIN_RELATIVE_VOLUME * totalVolume / nodeCount);
+    std::vector<float> heights;
+    heights.reserve(nodeCount);
+    for (uint32_t cellIdx = 0; cellIdx < nodeCount; ++cellIdx) {
+        if (std::abs(problem.nodes[cellIdx].volume) < minVolume) {
+            problem.seedFlags[cellIdx] = 1u;
+        } else {
+            heights.push_back(static_cast<float>(seedPositions[cellIdx].y));
+        }
+    }
+    if (heights.empty()) {
+        std::cerr << "[HeatSolverBenchmark] No cell of " << path << " kept its volume" << std::endl;
+        return false;
+    }
+    const size_t sourceRank = static_cast<size_t>(SOURCE_FRACTION * (heights.size() - 1));
+    std::nth_element(heights.begin(), heights.begin() + sourceRank, heights.end());
+    const float sourceHeight = heights[sourceRank];
+
+    const RuntimeThermalMaterial material{};
+    problem.interfaces.clear();
+    problem.materialNodes.assign(nodeCount, voronoi::MaterialNode{});
+    problem.contactConductance.assign(nodeCount, 0.0f);
+    for (uint32_t cellIdx = 0; cellIdx < nodeCount; ++cellIdx) {
+        voronoi::Node& node = problem.nodes[cellIdx];
+        voronoi::MaterialNode& materialNode = problem.materialNodes[cellIdx];
+        materialNode.temperature = 1.0f;
+        node.neighborOffset = static_cast<uint32_t>(problem.interfaces.size());
+        node.neighborCount = 0;
+        if (problem.seedFlags[cellIdx] != 0u) {
+            continue;
+        }
+
+        const glm::vec3 cellPosition(seedPositions[cellIdx]);
+        const uint32_t interfaceCount = std::min(node.interfaceNeighborCount, MAX_NEIGHBORS);
+        for (uint32_t k = 0; k < interfaceCount; ++k) {
+            const size_t slot = static_cast<size_t>(cellIdx) * MAX_NEIGHBORS + k;
+            const uint32_t neighborIdx = neighborIds[slot];
+            if (neighborIdx >= nodeCount || problem.seedFlags[neighborIdx] != 0u || areas[slot] <= 1e-8f) {
+                continue;
+            }
+            const float distance = glm::length(glm::vec3(seedPositions[neighborIdx]) - cellPosition);
+            if (distance <= 1e-12f) {
+                continue;
+            }
+            voronoi::GMLSInterface interfaceSample{};
+            interfaceSample.neighborIdx = neighborIdx;
+            interfaceSample.conductance = areas[slot] / distance;
+            problem.interfaces.push_back(interfaceSample);
+        }
+        node.neighborCount = static_cast<uint32_t>(problem.interfaces.size()) - node.neighborOffset;
+
+        materialNode.density = material.density;
+        materialNode.specificHeat = material.specificHeat;
+        materialNode.conductivity = material.conductivity;
+        materialNode.thermalMass = material.density * material.specificHeat * std::abs(node.volume);
+        materialNode.conductivityPerMass = material.conductivity / materialNode.thermalMass;
+        if (cellPosition.y <= sourceHeight) {
+            // About one interface worth of conductance into the source
+            problem.contactConductance[cellIdx] = material.conductivity * spacing;
+        }
+    }
+    return true;
+}
+
+}
+
+bool isHeatSolverBenchmarkCliInvocation(int argc, char** argv) {
+    return argc > 1 && argv[1] && std::strcmp(argv[1], BENCH_COMMAND) == 0;
+}
+
+int runHeatSolverBenchmarkCli(int argc, char** argv) {
+    BenchmarkOptions options;
+    for (int argIndex = 2; argIndex < argc; argIndex += 2) {
+        const char* option = argv[argIndex];
+        const char* value = argIndex + 1 < argc ? argv[argIndex + 1] : nullptr;
+        bool parsed = false;
+        if (std::strcmp(option, "--model") == 0 && value) {
+            options.modelPaths.push_back(value);
+            parsed = true;
+        } else if (std::strcmp(option, "--cells") == 0) {
+            parsed = parsePositive(value, options.cellCount);
+        } else if (std::strcmp(option, "--dt") == 0) {
+            parsed = parsePositive(value, options.deltaTime);
+        } else if (std::strcmp(option, "--tolerance") == 0) {
+            parsed = parsePositive(value, options.residualTolerance);
+        } else if (std::strcmp(option, "--max-iterations") == 0) {
+            parsed = parsePositive(value, options.maxIterations);
+        }
+        if (!parsed) {
+            printUsage();
+            return 1;
+        }
+    }
+    if (options.modelPaths.empty()) {
+        options.modelPaths = { "models/heatsink.obj", "models/channel_tube.obj", "models/cube.obj" };
+    }
+
+    struct SolverEntry {
+        HeatCpuSolver::ImplicitSolver solver;
+        const char* name;
+    };
+    const SolverEntry solvers[] = {
+        { HeatCpuSolver::ImplicitSolver::Jacobi, "jacobi" },
+        { HeatCpuSolver::ImplicitSolver::GaussSeidel, "gauss-seidel" },
+        { HeatCpuSolver::ImplicitSolver::BiCGStab, "bicgstab" },
+    };
+
+    using Clock = std::chrono::steady_clock;
+    bool allConverged = true;
+    for (const std::string& modelPath : options.modelPaths) {
+        HeatProblem problem;
+        if (!buildProblem(modelPath, options.cellCount, problem)) {
+            return 1;
+        }
+
+        HeatCpuSolver::Inputs inputs;
+        inputs.nodeCount = static_cast<uint32_t>(problem.nodes.size());
+        inputs.nodes = problem.nodes.data();
+        inputs.interfaces = problem.interfaces.data();
+        inputs.interfaceCount = problem.interfaces.size();
+        inputs.materialNodes = problem.materialNodes.data();
+        inputs.seedFlags = problem.seedFlags.data();
+        inputs.contactConductance = problem.contactConductance.data();
+        inputs.contactConductanceNodeCount = inputs.nodeCount;
+        HeatCpuSolver solver;
+        if (!solver.initialize(inputs)) {
+            return 1;
+        }
+
+        const size_t ghostCount = static_cast<size_t>(std::count(problem.seedFlags.begin(), problem.seedFlags.end(), 1u));
+        std::cout << modelPath << ": " << inputs.nodeCount << " nodes (" << ghostCount << " ghosts), " << inputs.interfaceCount
+                  << " interfaces, " << solver.getColorCount() << " colors, dt " << options.deltaTime
+                  << " s, dt * max rate " << options.deltaTime * solver.getMaxDiffusionRate()
+                  << ", tolerance " << options.residualTolerance << "\n";
+
+        // Heat stored over heat drawn from the source; 1 when the step conserves energy
+        const auto energyRatio = [&](const std::vector<float>& temperatures) {
+            double storedHeat = 0.0;
+            double injectedHeat = 0.0;
+            for (uint32_t node = 0; node < inputs.nodeCount; ++node) {
+                if (problem.seedFlags[node] != 0u) {
+                    continue;
+                }
+                storedHeat += static_cast<double>(problem.materialNodes[node].thermalMass) *
+                    (temperatures[node] - problem.materialNodes[node].temperature);
+                injectedHeat += static_cast<double>(options.deltaTime) * problem.contactConductance[node] *
+                    (defaultSourceTemperature - temperatures[node]);
+            }
+            return storedHeat / injectedHeat;
+        };
+
+        std::vector<float> referenceTemperatures;
+        for (const SolverEntry& entry : solvers) {
+            solver.reset();
+            const Clock::time_point start = Clock::now();
+            const HeatCpuSolver::SolveResult result = solver.stepImplicit(
+                entry.solver,
+                options.deltaTime,
+                defaultSourceTemperature,
+                options.residualTolerance,
+                options.maxIterations);
+            const double milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+            const std::vector<float>& temperatures = solver.getTemperatures();
+            if (referenceTemperatures.empty()) {
+                referenceTemperatures = temperatures;
+            }
+            const float difference = HeatCpuSolver::maxAbsDifference(
+                referenceTemperatures.data(), temperatures.data(), inputs.nodeCount);
+
+            std::cout << "  " << std::left << std::setw(13) << entry.name << std::right
+                      << std::setw(7) << result.iterations << " iterations "
+                      << std::setw(10) << std::fixed << std::setprecision(1) << milliseconds << " ms  residual "
+                      << std::scientific << std::setprecision(2) << result.residual
+                      << "  max |dT| vs jacobi " << difference
+                      << "  stored/injected " << std::fixed << std::setprecision(3) << energyRatio(temperatures)
+                      << (result.converged ? "" : "  (not converged)") << std::defaultfloat << "\n";
+            allConverged = allConverged && result.converged;
+        }
+
+        // The lagged substeps HeatSystem runs on the GPU, merged early by stepAdaptive
+        solver.reset();
+        const Clock::time_point adaptiveStart = Clock::now();
+        const uint32_t substepCount = solver.stepAdaptive(options.deltaTime, defaultSourceTemperature, options.residualTolerance);
+        const double adaptiveMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - adaptiveStart).count();
+        const std::vector<float>& adaptiveTemperatures = solver.getTemperatures();
+        std::cout << "  " << std::left << std::setw(13) << "substeps" << std::right
+                  << std::setw(7) << substepCount << " substeps   "
+                  << std::setw(10) << std::fixed << std::setprecision(1) << adaptiveMilliseconds << " ms"
+                  << std::string(21, ' ') << std::scientific << std::setprecision(2)
+                  << "max |dT| vs jacobi "
+                  << HeatCpuSolver::maxAbsDifference(referenceTemperatures.data(), adaptiveTemperatures.data(), inputs.nodeCount)
+                  << "  stored/injected " << std::fixed << std::setprecision(3) << energyRatio(adaptiveTemperatures)
+                  << std::defaultfloat << "\n";
+    }
+    std::cout << std::flush;
+    return allConverged ? 0 : 1;
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+// Builds a Voronoi heat problem from each model on the CPU and reports the
+// iterations and wall time HeatCpuSolver's implicit solvers need to bring one
+// backward-Euler step below a residual, next to the adaptive lagged substeps,
+// handled before the UI starts:
+//   --bench-heat-solvers [--model <file.obj>]... [--cells <count>] [--dt <seconds>]
+//                        [--tolerance <kelvin>] [--max-iterations <count>]
+bool isHeatSolverBenchmarkCliInvocation(int argc, char** argv);
+int runHeatSolverBenchmarkCli(int argc, char** argv);
@@ -0,0 +1,57 @@
+#include "HeatSubstepPolicy.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace heat {
+
+float computeMaxDiffusionRate(
+    const voronoi::Node* nodes,
+    uint32_t nodeCount,
+    const voronoi::GMLSInterface* interfaces,
+    size_t interfaceCount,
+    const voronoi::MaterialNode* materialNodes) {
+    if (!nodes || !interfaces || !materialNodes) {
+        return 0.0f;
+    }
+
+    float maxRate = 0.0f;
+    for (uint32_t nodeIndex = 0; nodeIndex < nodeCount; ++nodeIndex) {
+        const voronoi::Node& node = nodes[nodeIndex];
+        const float kappa = materialNodes[nodeIndex].conductivityPerMass;
+        if (!(kappa > 0.0f)) {
+            continue;
+        }
+
+        const size_t rangeEnd = static_cast<size_t>(node.neighborOffset) + node.neighborCount;
+        if (rangeEnd > interfaceCount) {
+            continue;
+        }
+
+        float totalConductance = 0.0f;
+        for (uint32_t i = 0; i < node.neighborCount; ++i) {
+            const voronoi::GMLSInterface& iface = interfaces[node.neighborOffset + i];
+            if (iface.neighborIdx < nodeCount) {
+                totalConductance += iface.conductance;
+            }
+        }
+        maxRate = std::max(maxRate, kappa * totalConductance);
+    }
+
+    return std::isfinite(maxRate) ? maxRate : 0.0f;
+}
+
+uint32_t chooseSubstepCount(float deltaTime, float maxDiffusionRate) {
+    if (!(deltaTime > 0.0f) || !(maxDiffusionRate > 0.0f)) {
+        return MIN_SUBSTEPS;
+    }
+
+    const float required = std::ceil(deltaTime * maxDiffusionRate / TARGET_SUBSTEP_STIFFNESS);
+    uint32_t substepCount = required >= static_cast<float>(MAX_SUBSTEPS)
+        ? MAX_SUBSTEPS
+        : std::max(static_cast<uint32_t>(required), MIN_SUBSTEPS);
+    substepCount += substepCount & 1u;
+    return std::min(substepCount, MAX_SUBSTEPS);
+}
+
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "voronoi/VoronoiGpuStructs.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace heat {
+
+// The diffusion update treats each node implicitly but reads its neighbours from
+// the previous substep, so it lags by dt * kappa * sum(g) per substep. Keeping
+// that product below the target bounds the lag; stiff materials and small cells
+// get more substeps, easy scenes get fewer.
+constexpr uint32_t MIN_SUBSTEPS = 2;
+constexpr uint32_t MAX_SUBSTEPS = 64;
+constexpr float TARGET_SUBSTEP_STIFFNESS = 0.5f;
+
+// Largest kappa * sum(conductance) over the free nodes, in 1/s.
+float computeMaxDiffusionRate(
+    const voronoi::Node* nodes,
+    uint32_t nodeCount,
+    const voronoi::GMLSInterface* interfaces,
+    size_t interfaceCount,
+    const voronoi::MaterialNode* materialNodes);
+
+// Always even so the ping-pong temperature buffers end where they started.
+uint32_t chooseSubstepCount(float deltaTime, float maxDiffusionRate);
+
+}
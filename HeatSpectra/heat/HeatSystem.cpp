@@ -16,8 +16,9 @@
 #include "vulkan/VulkanDevice.hpp"
 #include "voronoi/VoronoiGpuStructs.hpp"
 
-#include <cmath>
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <iostream>
 
 HeatSystem::HeatSystem(
@@ -34,7 +35,9 @@ HeatSystem::HeatSystem(
       renderCommandPool(renderCommandPool),
       runtime(),
       heatSources(runtime.getSourceBindingsMutable()),
+      temperatureRecorder(vulkanDevice, memoryAllocator, maxFramesInFlight),
       maxFramesInFlight(maxFramesInFlight) {
+    cpuUploadSlots.resize(maxFramesInFlight);
 
     HeatSystemStageContext stageContext{
         vulkanDevice,
@@ -211,20 +214,214 @@ void HeatSystem::update() {
         return;
     }
 
-    static auto lastTime = std::chrono::steady_clock::now();
-    const auto currentTime = std::chrono::steady_clock::now();
-    float deltaTime = std::chrono::duration<float>(currentTime - lastTime).count();
-    lastTime = currentTime;
-    if (deltaTime > (1.0f / 30.0f)) {
-        deltaTime = 1.0f / 30.0f;
-    }
+    const SimulationClock::Advance advance = simulationClock.advance();
+    pendingStepCount = advance.stepCount;
+    pendingSubstepCount = heat::chooseSubstepCount(advance.stepDeltaTime, maxDiffusionRate);
 
     auto* timeData = simRuntime.getMappedTimeData();
     if (timeData) {
-        timeData->deltaTime = deltaTime / static_cast<float>(NUM_SUBSTEPS);
-        timeData->totalTime += deltaTime;
+        timeData->deltaTime = advance.stepDeltaTime / static_cast<float>(pendingSubstepCount);
+        timeData->totalTime = static_cast<float>(simulationClock.getSimulatedTime());
+    }
+
+    if (usesCpuSolver()) {
+        stepCpuSolver(advance);
     }
+}
 
+void HeatSystem::setSolverSettings(const HeatSolverSettings& settings) {
+    const bool wasUsingCpuSolver = usesCpuSolver();
+    solverSettings = settings;
+    if (usesCpuSolver() && !wasUsingCpuSolver) {
+        // Continue from the temperatures the GPU substeps left in buffer A; the solver is
+        // reseeded at the next ensureConfigured
+        cpuSolverDirty = true;
+    }
+}
+
+float HeatSystem::getBaseSourceTemperature() const {
+    if (const SourceBinding* baseSource = runtime.findBaseSourceBinding();
+        baseSource && baseSource->heatSource) {
+        return baseSource->heatSource->getUniformTemperature();
+    }
+    return 0.0f;
+}
+
+// Reads buffer A from the host, so the device must be idle
+bool HeatSystem::initializeCpuSolver() {
+    cpuSolverDirty = false;
+    cpuSolver.cleanup();
+    cpuSolveResult = {};
+    cpuStepBacklog = 0;
+    cpuDroppedStepCount = 0;
+    cpuSolverBehind = false;
+    cpuTemperaturesPending = false;
+
+    HeatCpuSolver::Inputs inputs{};
+    inputs.nodeCount = resources.voronoiNodeCount;
+    inputs.nodes = static_cast<const voronoi::Node*>(resources.mappedVoronoiNodeData);
+    inputs.materialNodes = static_cast<const voronoi::MaterialNode*>(resources.mappedVoronoiMaterialNodeData);
+    if (resources.gmlsInterfaceBuffer != VK_NULL_HANDLE) {
+        inputs.interfaces = static_cast<const voronoi::GMLSInterface*>(
+            memoryAllocator.getMappedPointer(resources.gmlsInterfaceBuffer, resources.gmlsInterfaceBufferOffset));
+        inputs.interfaceCount = inputs.interfaces ? gmlsInterfaceCount : 0;
+    }
+    if (resources.seedFlagsBuffer != VK_NULL_HANDLE) {
+        inputs.seedFlags = static_cast<const uint32_t*>(
+            memoryAllocator.getMappedPointer(resources.seedFlagsBuffer, resources.seedFlagsBufferOffset));
+    }
+    if (resources.hasContact) {
+        inputs.contactConductance = static_cast<const float*>(
+            memoryAllocator.getMappedPointer(resources.contactConductanceBuffer, resources.contactConductanceBufferOffset));
+        inputs.contactConductanceNodeCount = inputs.contactConductance ? resources.contactConductanceNodeCount : 0;
+    }
+
+    if (!cpuSolver.initialize(inputs) ||
+        !cpuSolver.setTemperatures(static_cast<const float*>(simRuntime.getMappedTempBufferA()), simRuntime.getNodeCount())) {
+        std::cerr << "[HeatSystem] Failed to initialize the CPU heat solver" << std::endl;
+        cpuSolver.cleanup();
+        return false;
+    }
+    return true;
+}
+
+void HeatSystem::stepCpuSolver(const SimulationClock::Advance& advance) {
+    if (advance.stepCount == 0 || !hasDispatchableComputeWork() || cpuSolverDirty || !cpuSolver.isInitialized()) {
+        return;
+    }
+
+    HeatCpuSolver::ImplicitSolver solver = HeatCpuSolver::ImplicitSolver::BiCGStab;
+    if (solverSettings.mode == HeatSolverMode::CpuJacobi) {
+        solver = HeatCpuSolver::ImplicitSolver::Jacobi;
+    } else if (solverSettings.mode == HeatSolverMode::CpuGaussSeidel) {
+        solver = HeatCpuSolver::ImplicitSolver::GaussSeidel;
+    }
+
+    cpuStepBacklog += advance.stepCount;
+    if (cpuStepBacklog > MAX_CPU_STEP_BACKLOG) {
+        cpuDroppedStepCount += cpuStepBacklog - MAX_CPU_STEP_BACKLOG;
+        cpuStepBacklog = MAX_CPU_STEP_BACKLOG;
+    }
+
+    // At least one step per frame; whatever does not fit the budget carries over
+    const float heatSourceTemperature = getBaseSourceTemperature();
+    const auto start = std::chrono::steady_clock::now();
+    while (cpuStepBacklog > 0) {
+        cpuSolveResult = cpuSolver.stepImplicit(
+            solver,
+            advance.stepDeltaTime,
+            heatSourceTemperature,
+            solverSettings.residualTolerance,
+            solverSettings.maxIterations);
+        --cpuStepBacklog;
+        cpuTemperaturesPending = true;
+
+        const double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if (elapsedMs >= CPU_SOLVE_BUDGET_MS) {
+            break;
+        }
+    }
+
+    if (cpuStepBacklog > 0 && !cpuSolverBehind) {
+        std::cerr << "[HeatSystem] CPU solver is falling behind the simulation clock, "
+                  << cpuStepBacklog << " steps deferred" << std::endl;
+        cpuSolverBehind = true;
+    } else if (cpuStepBacklog == 0 && cpuSolverBehind) {
+        std::cerr << "[HeatSystem] CPU solver caught up with the simulation clock";
+        if (cpuDroppedStepCount > 0) {
+            std::cerr << ", " << cpuDroppedStepCount << " steps were dropped";
+        }
+        std::cerr << std::endl;
+        cpuSolverBehind = false;
+        cpuDroppedStepCount = 0;
+    }
+}
+
+void HeatSystem::recordCpuTemperatureUpload(VkCommandBuffer commandBuffer, uint32_t currentFrame) {
+    if (!cpuTemperaturesPending || cpuUploadSlots.empty()) {
+        return;
+    }
+
+    const uint32_t nodeCount = simRuntime.getNodeCount();
+    const std::vector<float>& temperatures = cpuSolver.getTemperatures();
+    if (nodeCount == 0 || temperatures.size() != nodeCount) {
+        cpuTemperaturesPending = false;
+        return;
+    }
+
+    CpuUploadSlot& slot = cpuUploadSlots[currentFrame % cpuUploadSlots.size()];
+    const VkDeviceSize size = sizeof(float) * static_cast<VkDeviceSize>(nodeCount);
+    if (slot.size != size) {
+        if (slot.buffer != VK_NULL_HANDLE) {
+            memoryAllocator.free(slot.buffer, slot.offset);
+            slot = {};
+        }
+
+        void* mapped = nullptr;
+        if (createStagingBuffer(memoryAllocator, size, slot.buffer, slot.offset, &mapped) != VK_SUCCESS || !mapped) {
+            std::cerr << "[HeatSystem] Failed to allocate the CPU solver staging buffer" << std::endl;
+            if (slot.buffer != VK_NULL_HANDLE) {
+                memoryAllocator.free(slot.buffer, slot.offset);
+            }
+            slot = {};
+            return;
+        }
+        slot.size = size;
+        slot.mapped = static_cast<float*>(mapped);
+    }
+
+    std::copy(temperatures.begin(), temperatures.end(), slot.mapped);
+    cpuTemperaturesPending = false;
+
+    // Earlier frames may still read buffer A in the surface pass or the recorder copy
+    VkBufferMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    barrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_TRANSFER_READ_BIT;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.buffer = simRuntime.getTempBufferA();
+    barrier.offset = simRuntime.getTempBufferAOffset();
+    barrier.size = size;
+    vkCmdPipelineBarrier(
+        commandBuffer,
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        0,
+        0,
+        nullptr,
+        1,
+        &barrier,
+        0,
+        nullptr);
+
+    VkBufferCopy region{};
+    region.srcOffset = slot.offset;
+    region.dstOffset = simRuntime.getTempBufferAOffset();
+    region.size = size;
+    vkCmdCopyBuffer(commandBuffer, slot.buffer, simRuntime.getTempBufferA(), 1, &region);
+
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_TRANSFER_READ_BIT;
+    vkCmdPipelineBarrier(
+        commandBuffer,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+        0,
+        0,
+        nullptr,
+        1,
+        &barrier,
+        0,
+        nullptr);
+}
+
+void HeatSystem::freeCpuUploadSlots() {
+    for (CpuUploadSlot& slot : cpuUploadSlots) {
+        if (slot.buffer != VK_NULL_HANDLE) {
+            memoryAllocator.free(slot.buffer, slot.offset);
+        }
+        slot = {};
+    }
+    cpuTemperaturesPending = false;
 }
 
 void HeatSystem::ensureConfigured() {
@@ -236,16 +433,24 @@ void HeatSystem::ensureConfigured() {
         thermalMaterialsDirty ||
         heatParamsDirty;
 
-    if (!needsHardRebuild) {
+    // Switching to a host solver seeds it from buffer A, which needs the same idle device
+    const bool needsCpuSolverSeed = usesCpuSolver() && cpuSolverDirty && voronoiReady();
+    if (!needsHardRebuild && !needsCpuSolverSeed) {
         return;
     }
 
     vkDeviceWaitIdle(vulkanDevice.getDevice());
-    rebuildHeatStateRuntimes(true);
-    resetHeatState();
+    if (needsHardRebuild) {
+        rebuildHeatStateRuntimes(true);
+        resetHeatState();
+    }
+    if (usesCpuSolver() && cpuSolverDirty && voronoiReady()) {
+        initializeCpuSolver();
+    }
 }
 
 bool HeatSystem::rebuildHeatStateRuntimes(bool forceDescriptorReallocate) {
+    cpuSolverDirty = true;
     const bool sourcesReady = runtime.ensureModelBindings(
         vulkanDevice,
         memoryAllocator,
@@ -360,7 +565,18 @@ void HeatSystem::setActive(bool active) {
 
 void HeatSystem::resetHeatState() {
     simRuntime.reset();
+    if (cpuSolver.isInitialized()) {
+        cpuSolver.reset();
+    }
+    cpuSolveResult = {};
+    cpuStepBacklog = 0;
+    cpuDroppedStepCount = 0;
+    cpuSolverBehind = false;
+    cpuTemperaturesPending = false;
+    // A restarted simulation continues in a new file beside the previous recording
+    temperatureRecorder.stop();
     surfaceRuntime.resetSurfaceTemperatures(renderCommandPool);
+    simulationClock.reset();
 }
 
 bool HeatSystem::createComputeCommandBuffers(uint32_t maxFramesInFlight) {
@@ -408,18 +624,20 @@ void HeatSystem::recordComputeCommands(VkCommandBuffer commandBuffer, uint32_t c
         basePushConstant.maxNodeNeighbors = MAX_NODE_NEIGHBORS;
         basePushConstant.substepIndex = 0;
         basePushConstant.hasContact = resources.hasContact ? 1u : 0u;
-        basePushConstant.heatSourceTemperature = 0.0f;
+        basePushConstant.heatSourceTemperature = getBaseSourceTemperature();
 
-        if (const SourceBinding* baseSource = runtime.findBaseSourceBinding();
-            baseSource && baseSource->heatSource) {
-            basePushConstant.heatSourceTemperature = baseSource->heatSource->getUniformTemperature();
-        }
+        // Host-solved temperatures are copied into buffer A; only the surfaces are refreshed
+        const uint32_t totalSubsteps = usesCpuSolver()
+            ? 0u
+            : pendingSubstepCount * std::max(pendingStepCount, 1u);
 
         if (timingQueryPool != VK_NULL_HANDLE) {
             vkCmdResetQueryPool(commandBuffer, timingQueryPool, timingQueryBase, 2);
             vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, timingQueryPool, timingQueryBase);
         }
 
+        recordCpuTemperatureUpload(commandBuffer, currentFrame);
+
         simStage->recordComputeCommands(
             commandBuffer,
             currentFrame,
@@ -429,7 +647,19 @@ void HeatSystem::recordComputeCommands(VkCommandBuffer commandBuffer, uint32_t c
             *voronoiStage,
             *surfaceStage,
             MAX_NODE_NEIGHBORS,
-            NUM_SUBSTEPS);
+            totalSubsteps);
+
+        const bool finalInBufferB = voronoiStage->finalSubstepWritesBufferB(totalSubsteps);
+        temperatureRecorder.recordSnapshot(
+            commandBuffer,
+            currentFrame,
+            finalInBufferB ? simRuntime.getTempBufferB() : simRuntime.getTempBufferA(),
+            finalInBufferB ? simRuntime.getTempBufferBOffset() : simRuntime.getTempBufferAOffset(),
+            simRuntime.getNodeCount(),
+            surfaceRuntime.getReceivers(),
+            simulationClock.getStepCount(),
+            std::max(pendingStepCount, 1u),
+            simulationClock.getSimulatedTime());
 
         if (timingQueryPool != VK_NULL_HANDLE) {
             vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, timingQueryPool, timingQueryBase + 1);
@@ -497,6 +727,10 @@ void HeatSystem::cleanupResources() {
 }
 
 void HeatSystem::cleanup() {
+    temperatureRecorder.stop();
+    cpuSolver.cleanup();
+    cpuSolverDirty = true;
+    freeCpuUploadSlots();
     heatContactRuntime.clearCouplings(memoryAllocator);
     surfaceRuntime.cleanup();
     cleanupVoronoiRuntime();
@@ -563,6 +797,26 @@ bool HeatSystem::initializeVoronoiMaterialNodes() {
         }
     }
 
+    maxDiffusionRate = 0.0f;
+    gmlsInterfaceCount = 0;
+    if (resources.gmlsInterfaceBuffer != VK_NULL_HANDLE) {
+        const auto* interfaces = static_cast<const voronoi::GMLSInterface*>(
+            memoryAllocator.getMappedPointer(resources.gmlsInterfaceBuffer, resources.gmlsInterfaceBufferOffset));
+        size_t interfaceCount = 0;
+        for (uint32_t nodeIndex = 0; nodeIndex < resources.voronoiNodeCount; ++nodeIndex) {
+            interfaceCount = std::max(
+                interfaceCount,
+                static_cast<size_t>(voronoiNodes[nodeIndex].neighborOffset) + voronoiNodes[nodeIndex].neighborCount);
+        }
+        gmlsInterfaceCount = interfaceCount;
+        maxDiffusionRate = heat::computeMaxDiffusionRate(
+            voronoiNodes,
+            resources.voronoiNodeCount,
+            interfaces,
+            interfaceCount,
+            materialNodes.data());
+    }
+
     if (resources.voronoiMaterialNodeBuffer != VK_NULL_HANDLE) {
         memoryAllocator.free(resources.voronoiMaterialNodeBuffer, resources.voronoiMaterialNodeBufferOffset);
         resources.voronoiMaterialNodeBuffer = VK_NULL_HANDLE;
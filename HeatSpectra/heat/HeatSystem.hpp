@@ -1,6 +1,7 @@
 #pragma once
 
 #include "HeatContactRuntime.hpp"
+#include "HeatCpuSolver.hpp"
 #include "contact/ContactTypes.hpp"
 #include "framegraph/ComputePass.hpp"
 #include "util/Structs.hpp"
@@ -8,6 +9,9 @@
 #include "HeatSystemSurfaceRuntime.hpp"
 #include "HeatSystemRuntime.hpp"
 #include "HeatSystemPresets.hpp"
+#include "HeatSubstepPolicy.hpp"
+#include "SimulationClock.hpp"
+#include "TemperatureRecorder.hpp"
 #include "mesh/remesher/SupportingHalfedge.hpp"
 #include "runtime/RuntimeProducts.hpp"
 #include "runtime/RuntimeThermalTypes.hpp"
@@ -15,8 +19,6 @@
 #include <memory>
 #include <unordered_map>
 
-static constexpr int NUM_SUBSTEPS = 8;
-
 class ModelRegistry;
 class MemoryAllocator;
 class VulkanDevice;
@@ -73,6 +75,12 @@ public:
         const std::vector<VkBufferView>& inputLengthViews);
     void setThermalMaterials(const std::vector<RuntimeThermalMaterial>& runtimeThermalMaterials);
     void setParams(float contactThermalConductance);
+    void setClockSettings(const SimulationClockSettings& settings) { simulationClock.setSettings(settings); }
+    const SimulationClock& getSimulationClock() const { return simulationClock; }
+    void setRecordSettings(const TemperatureRecordSettings& settings) { temperatureRecorder.setSettings(settings); }
+    void setSolverSettings(const HeatSolverSettings& settings);
+    const HeatCpuSolver::SolveResult& getCpuSolveResult() const { return cpuSolveResult; }
+    uint32_t getSubstepCount() const { return pendingSubstepCount; }
     void setContactCouplings(const std::vector<ContactCoupling>& contactCouplings);
     void clearVoronoiInputs();
     void setVoronoiBuffers(
@@ -107,6 +115,12 @@ private:
     bool initializeVoronoiMaterialNodes();
     void rebuildReceiverThermalMaterialMap();
     void cleanupVoronoiRuntime();
+    bool usesCpuSolver() const { return solverSettings.mode != HeatSolverMode::GpuSubsteps; }
+    bool initializeCpuSolver();
+    void stepCpuSolver(const SimulationClock::Advance& advance);
+    void recordCpuTemperatureUpload(VkCommandBuffer commandBuffer, uint32_t currentFrame);
+    void freeCpuUploadSlots();
+    float getBaseSourceTemperature() const;
 
     VulkanDevice& vulkanDevice;
     MemoryAllocator& memoryAllocator;
@@ -129,6 +143,33 @@ private:
     std::vector<uint32_t> receiverRuntimeModelIds;
     std::vector<RuntimeThermalMaterial> runtimeThermalMaterials;
     float contactThermalConductance = 16000.0f;
+    SimulationClock simulationClock;
+    // Steps produced by the last update(), consumed by recordComputeCommands
+    uint32_t pendingStepCount = 1;
+    uint32_t pendingSubstepCount = heat::MIN_SUBSTEPS;
+    float maxDiffusionRate = 0.0f;
+    size_t gmlsInterfaceCount = 0;
+    TemperatureRecorder temperatureRecorder;
+    HeatSolverSettings solverSettings{};
+    // Host solver state; reseeded from temperature buffer A at the ensureConfigured sync point
+    HeatCpuSolver cpuSolver;
+    HeatCpuSolver::SolveResult cpuSolveResult{};
+    bool cpuSolverDirty = true;
+    // Clock steps the host solver has not run yet because of its per-frame budget
+    uint32_t cpuStepBacklog = 0;
+    uint64_t cpuDroppedStepCount = 0;
+    bool cpuSolverBehind = false;
+    // Host results reach buffer A through a staging copy recorded into the frame's compute
+    // command buffer. Each frame slot owns its staging buffer, which is only rewritten once
+    // FrameSync has waited on that slot's fence.
+    struct CpuUploadSlot {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VkDeviceSize offset = 0;
+        VkDeviceSize size = 0;
+        float* mapped = nullptr;
+    };
+    std::vector<CpuUploadSlot> cpuUploadSlots;
+    bool cpuTemperaturesPending = false;
     
     std::unique_ptr<HeatSystemSimStage> simStage;
     std::unique_ptr<HeatSystemSurfaceStage> surfaceStage;
@@ -155,5 +196,7 @@ private:
     bool thermalMaterialsDirty = true;
     bool heatParamsDirty = true;
     static constexpr uint32_t MAX_NODE_NEIGHBORS = 50;
+    static constexpr double CPU_SOLVE_BUDGET_MS = 8.0;
+    static constexpr uint32_t MAX_CPU_STEP_BACKLOG = 64;
 };
 
@@ -94,6 +94,9 @@ void HeatSystemComputeController::configure(uint64_t socketKey, const Config& co
     if (instance.system) {
         instance.system->setActive(config.active);
         instance.system->setIsPaused(config.active && config.paused);
+        instance.system->setClockSettings(config.clockSettings);
+        instance.system->setRecordSettings(config.recordSettings);
+        instance.system->setSolverSettings(config.solverSettings);
 
         if (config.resetRequested) {
             instance.system->resetHeatState();
@@ -104,7 +107,14 @@ void HeatSystemComputeController::configure(uint64_t socketKey, const Config& co
     if (configIt != configuredConfigs.end()) {
         configIt->second.paused = config.paused;
         configIt->second.resetRequested = config.resetRequested;
+        configIt->second.clockSettings = config.clockSettings;
+        configIt->second.recordSettings = config.recordSettings;
+        configIt->second.solverSettings = config.solverSettings;
         if (configIt->second.computeHash == config.computeHash) {
+            // A solver mode switch alone still seeds the host solver at this sync point
+            if (instance.system) {
+                instance.system->ensureConfigured();
+            }
             return;
         }
     }
@@ -27,6 +27,10 @@ public:
         bool paused = false;
         bool resetRequested = false;
         float contactThermalConductance = 16000.0f;
+        // Not part of buildComputeHash; applied without rebuilding the system
+        SimulationClockSettings clockSettings{};
+        TemperatureRecordSettings recordSettings{};
+        HeatSolverSettings solverSettings{};
         std::vector<SupportingHalfedge::IntrinsicMesh> sourceIntrinsicMeshes;
         std::vector<uint32_t> sourceRuntimeModelIds;
         std::vector<SupportingHalfedge::IntrinsicMesh> receiverIntrinsicMeshes;
@@ -34,7 +34,9 @@ bool HeatSystemSimRuntime::initialize(VulkanDevice& vulkanDevice, MemoryAllocato
             tempBufferSize,
             tempBufferA,
             tempBufferAOffset,
-            &mappedPtr) != VK_SUCCESS ||
+            &mappedPtr,
+            true,
+            VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT) != VK_SUCCESS ||
         tempBufferA == VK_NULL_HANDLE ||
         mappedPtr == nullptr) {
         cleanup(memoryAllocator);
@@ -49,7 +51,9 @@ bool HeatSystemSimRuntime::initialize(VulkanDevice& vulkanDevice, MemoryAllocato
             tempBufferSize,
             tempBufferB,
             tempBufferBOffset,
-            &mappedPtr) != VK_SUCCESS ||
+            &mappedPtr,
+            true,
+            VK_BUFFER_USAGE_TRANSFER_SRC_BIT) != VK_SUCCESS ||
         tempBufferB == VK_NULL_HANDLE ||
         mappedPtr == nullptr) {
         cleanup(memoryAllocator);
@@ -26,7 +26,7 @@ void HeatSystemSimStage::recordComputeCommands(
     (void)currentFrame;
 
     const uint32_t nodeCount = simRuntime.getNodeCount();
-    if (nodeCount == 0 || numSubsteps == 0) {
+    if (nodeCount == 0) {
         return;
     }
 
@@ -51,7 +51,9 @@ void HeatSystemSimStage::recordComputeCommands(
             numSubsteps);
     }
 
-    voronoiStage.insertFinalTemperatureBarrier(commandBuffer, simRuntime, numSubsteps);
+    if (numSubsteps > 0) {
+        voronoiStage.insertFinalTemperatureBarrier(commandBuffer, simRuntime, numSubsteps);
+    }
 
     pushConstant.substepIndex = 0;
     surfaceStage.dispatchSurfaceTemperatureUpdates(
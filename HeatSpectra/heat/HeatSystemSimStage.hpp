@@ -18,6 +18,7 @@ class HeatSystemSimStage {
 public:
     explicit HeatSystemSimStage(const HeatSystemStageContext& stageContext);
 
+    // With numSubsteps == 0 only the receiver surfaces are refreshed from buffer A.
     void recordComputeCommands(
         VkCommandBuffer commandBuffer,
         uint32_t currentFrame,
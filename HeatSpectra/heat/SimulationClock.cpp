@@ -0,0 +1,54 @@
+#include "SimulationClock.hpp"
+
+#include <algorithm>
+
+void SimulationClock::setSettings(const SimulationClockSettings& updatedSettings) {
+    SimulationClockSettings sanitized = updatedSettings;
+    if (!(sanitized.fixedDeltaTime > 0.0f)) {
+        sanitized.fixedDeltaTime = SimulationClockSettings{}.fixedDeltaTime;
+    }
+    sanitized.stepsPerSubmission = std::clamp<uint32_t>(sanitized.stepsPerSubmission, 1u, MAX_STEPS_PER_SUBMISSION);
+
+    if (sanitized.mode != settings.mode) {
+        // Do not count time spent in another mode as real-time progress
+        hasWallTime = false;
+    }
+    settings = sanitized;
+}
+
+SimulationClock::Advance SimulationClock::advance() {
+    Advance result{};
+    switch (settings.mode) {
+    case SimulationClockMode::RealTime: {
+        const Clock::time_point now = Clock::now();
+        float deltaTime = 0.0f;
+        if (hasWallTime) {
+            deltaTime = std::chrono::duration<float>(now - lastWallTime).count();
+        }
+        lastWallTime = now;
+        hasWallTime = true;
+
+        result.stepDeltaTime = std::min(deltaTime, MAX_REAL_TIME_DELTA);
+        result.stepCount = 1;
+        break;
+    }
+    case SimulationClockMode::FixedStep:
+        result.stepDeltaTime = settings.fixedDeltaTime;
+        result.stepCount = 1;
+        break;
+    case SimulationClockMode::AsFastAsPossible:
+        result.stepDeltaTime = settings.fixedDeltaTime;
+        result.stepCount = settings.stepsPerSubmission;
+        break;
+    }
+
+    simulatedTime += static_cast<double>(result.stepDeltaTime) * static_cast<double>(result.stepCount);
+    stepCount += result.stepCount;
+    return result;
+}
+
+void SimulationClock::reset() {
+    hasWallTime = false;
+    simulatedTime = 0.0;
+    stepCount = 0;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+enum class SimulationClockMode : uint8_t {
+    RealTime = 0,
+    FixedStep = 1,
+    AsFastAsPossible = 2,
+};
+
+struct SimulationClockSettings {
+    SimulationClockMode mode = SimulationClockMode::RealTime;
+    float fixedDeltaTime = 1.0f / 60.0f;
+    uint32_t stepsPerSubmission = 16;
+};
+
+// Decides how much simulated time each submitted frame advances.
+// RealTime follows the wall clock (clamped), FixedStep advances one fixed step
+// per frame for deterministic replay, and AsFastAsPossible batches
+// stepsPerSubmission fixed steps into a single submission.
+class SimulationClock {
+public:
+    static constexpr float MAX_REAL_TIME_DELTA = 1.0f / 30.0f;
+    static constexpr uint32_t MAX_STEPS_PER_SUBMISSION = 256;
+
+    struct Advance {
+        float stepDeltaTime = 0.0f;
+        uint32_t stepCount = 0;
+    };
+
+    void setSettings(const SimulationClockSettings& updatedSettings);
+    const SimulationClockSettings& getSettings() const { return settings; }
+
+    Advance advance();
+    void reset();
+
+    double getSimulatedTime() const { return simulatedTime; }
+    uint64_t getStepCount() const { return stepCount; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    SimulationClockSettings settings{};
+    Clock::time_point lastWallTime{};
+    bool hasWallTime = false;
+    double simulatedTime = 0.0;
+    uint64_t stepCount = 0;
+};
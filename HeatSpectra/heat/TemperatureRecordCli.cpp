@@ -0,0 +1,168 @@
+#include "TemperatureRecordCli.hpp"
+
+#include "TemperatureRecordReader.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr const char* INFO_COMMAND = "--record-info";
+constexpr const char* EXTRACT_COMMAND = "--extract-probes";
+
+struct Probe {
+    std::string label;
+    uint32_t valueIndex = 0;
+};
+
+void printUsage() {
+    std::cerr << "Usage:\n"
+              << "  HeatSpectra " << INFO_COMMAND << " <recording>\n"
+              << "  HeatSpectra " << EXTRACT_COMMAND << " <recording> [--node <index>]... "
+              << "[--surface <modelId>:<vertex>]... [--output <file.csv>]" << std::endl;
+}
+
+bool parseUnsigned(const char* text, uint32_t& outValue) {
+    if (!text || *text == '\0') {
+        return false;
+    }
+    char* end = nullptr;
+    const unsigned long long value = std::strtoull(text, &end, 10);
+    if (*end != '\0' || value > UINT32_MAX) {
+        return false;
+    }
+    outValue = static_cast<uint32_t>(value);
+    return true;
+}
+
+int printInfo(TemperatureRecordReader& reader) {
+    std::cout << "nodes: " << reader.getNodeCount() << "\n";
+    for (const temperaturerecord::ReceiverEntry& receiver : reader.getReceivers()) {
+        std::cout << "receiver " << receiver.runtimeModelId << ": " << receiver.vertexCount << " surface vertices\n";
+    }
+    std::cout << "snapshots: " << reader.getFrameCount() << "\n";
+    if (reader.getFrameCount() > 0) {
+        const size_t last = reader.getFrameCount() - 1;
+        std::cout << "steps: " << reader.getStepIndex(0) << " - " << reader.getStepIndex(last) << "\n";
+        std::cout << "time: " << reader.getSimulatedTime(0) << " - " << reader.getSimulatedTime(last) << " s\n";
+    }
+    std::cout << "quantization: " << reader.getQuantizationStep() << std::endl;
+    return 0;
+}
+
+int extractProbes(TemperatureRecordReader& reader, int argc, char** argv, int firstOption) {
+    std::vector<Probe> probes;
+    std::string outputPath;
+    for (int argIndex = firstOption; argIndex < argc; ++argIndex) {
+        const char* option = argv[argIndex];
+        const char* value = argIndex + 1 < argc ? argv[argIndex + 1] : nullptr;
+        if (!value) {
+            printUsage();
+            return 1;
+        }
+        ++argIndex;
+
+        if (std::strcmp(option, "--node") == 0) {
+            uint32_t nodeIndex = 0;
+            if (!parseUnsigned(value, nodeIndex) || nodeIndex >= reader.getNodeCount()) {
+                std::cerr << "Invalid node index " << value << std::endl;
+                return 1;
+            }
+            probes.push_back({ std::string("node_") + value, nodeIndex });
+        } else if (std::strcmp(option, "--surface") == 0) {
+            const std::string text(value);
+            const size_t separator = text.find(':');
+            uint32_t modelId = 0;
+            uint32_t vertexIndex = 0;
+            if (separator == std::string::npos ||
+                !parseUnsigned(text.substr(0, separator).c_str(), modelId) ||
+                !parseUnsigned(text.substr(separator + 1).c_str(), vertexIndex)) {
+                std::cerr << "Invalid surface probe " << value << ", expected <modelId>:<vertex>" << std::endl;
+                return 1;
+            }
+            const uint32_t valueIndex = reader.findSurfaceValueIndex(modelId, vertexIndex);
+            if (valueIndex == UINT32_MAX) {
+                std::cerr << "Surface probe " << value << " is not in the recording" << std::endl;
+                return 1;
+            }
+            probes.push_back({ "surface_" + std::to_string(modelId) + "_" + std::to_string(vertexIndex), valueIndex });
+        } else if (std::strcmp(option, "--output") == 0) {
+            outputPath = value;
+        } else {
+            printUsage();
+            return 1;
+        }
+    }
+
+    if (probes.empty()) {
+        std::cerr << "No probes given" << std::endl;
+        printUsage();
+        return 1;
+    }
+
+    std::vector<uint32_t> valueIndices;
+    valueIndices.reserve(probes.size());
+    for (const Probe& probe : probes) {
+        valueIndices.push_back(probe.valueIndex);
+    }
+
+    std::vector<float> history;
+    if (!reader.readHistory(valueIndices, history)) {
+        std::cerr << "Failed to decode the recording" << std::endl;
+        return 1;
+    }
+
+    std::ofstream outputFile;
+    if (!outputPath.empty()) {
+        outputFile.open(outputPath, std::ios::trunc);
+        if (!outputFile.is_open()) {
+            std::cerr << "Failed to open " << outputPath << " for writing" << std::endl;
+            return 1;
+        }
+    }
+    std::ostream& output = outputPath.empty() ? std::cout : outputFile;
+
+    output << "step,time";
+    for (const Probe& probe : probes) {
+        output << "," << probe.label;
+    }
+    output << "\n";
+    for (size_t frameIndex = 0; frameIndex < reader.getFrameCount(); ++frameIndex) {
+        output << reader.getStepIndex(frameIndex) << "," << reader.getSimulatedTime(frameIndex);
+        for (size_t probe = 0; probe < probes.size(); ++probe) {
+            output << "," << history[frameIndex * probes.size() + probe];
+        }
+        output << "\n";
+    }
+    output.flush();
+    return output ? 0 : 1;
+}
+
+}
+
+bool isTemperatureRecordCliInvocation(int argc, char** argv) {
+    return argc > 1 && argv[1] &&
+        (std::strcmp(argv[1], INFO_COMMAND) == 0 || std::strcmp(argv[1], EXTRACT_COMMAND) == 0);
+}
+
+int runTemperatureRecordCli(int argc, char** argv) {
+    if (argc < 3) {
+        printUsage();
+        return 1;
+    }
+
+    TemperatureRecordReader reader;
+    if (!reader.open(argv[2])) {
+        return 1;
+    }
+
+    if (std::strcmp(argv[1], INFO_COMMAND) == 0) {
+        return printInfo(reader);
+    }
+    return extractProbes(reader, argc, argv, 3);
+}
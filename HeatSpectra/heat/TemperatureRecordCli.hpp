@@ -0,0 +1,8 @@
+#pragma once
+
+// Command-line access to temperature recordings, handled before the UI starts:
+//   --record-info <file>
+//   --extract-probes <file> [--node <index>]... [--surface <modelId>:<vertex>]... [--output <file.csv>]
+// Probe histories are written as CSV with one row per recorded snapshot.
+bool isTemperatureRecordCliInvocation(int argc, char** argv);
+int runTemperatureRecordCli(int argc, char** argv);
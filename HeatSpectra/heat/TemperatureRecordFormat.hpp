@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct TemperatureRecordSettings {
+    bool enabled = false;
+    std::string path;
+    uint32_t stepInterval = 10;
+};
+
+// On-disk layout of a temperature recording:
+//   FileHeader, ReceiverEntry[receiverCount]
+//   ChunkHeader + payload, one chunk per snapshot, appended in step order
+//   IndexEntry[entryCount], IndexFooter (written on close)
+// Snapshots are taken after the last step of a submission. When a submission
+// advances several steps (AsFastAsPossible), the actual stride is stepInterval
+// rounded up to a multiple of that count, so it may be larger than requested.
+// Every chunk stores its own step index.
+// Every value is quantized to quantizationStep and stored as a zigzag varint.
+// Keyframes hold the quantized values; other chunks hold the difference to the
+// previous snapshot. A file without a footer is still readable by scanning chunks.
+namespace temperaturerecord {
+
+constexpr uint32_t FILE_MAGIC = 0x52545348u;   // "HSTR"
+constexpr uint32_t CHUNK_MAGIC = 0x4b4e4843u;  // "CHNK"
+constexpr uint32_t INDEX_MAGIC = 0x58444e49u;  // "INDX"
+constexpr uint32_t FILE_VERSION = 1;
+constexpr uint32_t CHUNK_FLAG_KEYFRAME = 1u;
+
+struct FileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t nodeCount;
+    uint32_t receiverCount;
+    float quantizationStep;
+    uint32_t keyframeInterval;
+    uint64_t reserved;
+};
+
+struct ReceiverEntry {
+    uint32_t runtimeModelId;
+    uint32_t vertexCount;
+};
+
+struct ChunkHeader {
+    uint32_t magic;
+    uint32_t flags;
+    uint64_t stepIndex;
+    double simulatedTime;
+    uint32_t valueCount;
+    uint32_t payloadBytes;
+};
+
+struct IndexEntry {
+    uint64_t fileOffset;
+    uint64_t stepIndex;
+    double simulatedTime;
+    uint32_t flags;
+    uint32_t reserved;
+};
+
+struct IndexFooter {
+    uint64_t indexOffset;
+    uint32_t entryCount;
+    uint32_t magic;
+};
+
+inline int64_t quantize(float value, float quantizationStep) {
+    const double scaled = static_cast<double>(value) / static_cast<double>(quantizationStep);
+    if (!std::isfinite(scaled)) {
+        return 0;
+    }
+    // Bounded so the difference of two values still fits in int64
+    constexpr double LIMIT = 4.0e18;
+    return static_cast<int64_t>(std::llround(std::fmax(-LIMIT, std::fmin(LIMIT, scaled))));
+}
+
+inline float dequantize(int64_t value, float quantizationStep) {
+    return static_cast<float>(static_cast<double>(value) * static_cast<double>(quantizationStep));
+}
+
+inline void appendVarint(std::vector<uint8_t>& out, int64_t value) {
+    uint64_t zigzag = (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    while (zigzag >= 0x80u) {
+        out.push_back(static_cast<uint8_t>(zigzag | 0x80u));
+        zigzag >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(zigzag));
+}
+
+inline bool readVarint(const uint8_t*& cursor, const uint8_t* end, int64_t& outValue) {
+    uint64_t zigzag = 0;
+    for (uint32_t shift = 0; shift < 64 && cursor < end; shift += 7) {
+        const uint8_t byte = *cursor++;
+        zigzag |= static_cast<uint64_t>(byte & 0x7fu) << shift;
+        if ((byte & 0x80u) == 0) {
+            outValue = static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1u);
+            return true;
+        }
+    }
+    return false;
+}
+
+}
@@ -0,0 +1,238 @@
+#include "TemperatureRecordReader.hpp"
+
+#include <iostream>
+
+bool TemperatureRecordReader::open(const std::string& path) {
+    close();
+
+    file.open(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        std::cerr << "[TemperatureRecordReader] Failed to open " << path << std::endl;
+        return false;
+    }
+
+    const std::streamoff fileSize = file.tellg();
+    file.seekg(0);
+    if (fileSize < static_cast<std::streamoff>(sizeof(header))) {
+        close();
+        return false;
+    }
+
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || header.magic != temperaturerecord::FILE_MAGIC || header.version != temperaturerecord::FILE_VERSION ||
+        !(header.quantizationStep > 0.0f)) {
+        std::cerr << "[TemperatureRecordReader] " << path << " is not a temperature recording" << std::endl;
+        close();
+        return false;
+    }
+
+    const uint64_t dataOffset = sizeof(header) + sizeof(temperaturerecord::ReceiverEntry) * static_cast<uint64_t>(header.receiverCount);
+    if (dataOffset > static_cast<uint64_t>(fileSize)) {
+        close();
+        return false;
+    }
+
+    receivers.resize(header.receiverCount);
+    if (!receivers.empty()) {
+        file.read(
+            reinterpret_cast<char*>(receivers.data()),
+            static_cast<std::streamsize>(sizeof(temperaturerecord::ReceiverEntry) * receivers.size()));
+    }
+
+    uint64_t totalValues = header.nodeCount;
+    for (const temperaturerecord::ReceiverEntry& receiver : receivers) {
+        totalValues += receiver.vertexCount;
+    }
+    if (!file || totalValues > UINT32_MAX) {
+        close();
+        return false;
+    }
+    valueCount = static_cast<uint32_t>(totalValues);
+
+    // Recordings cut short by a crash have no footer; rebuild the index from the chunks
+    if (!readIndexFooter(static_cast<uint64_t>(fileSize), dataOffset) &&
+        !scanChunks(static_cast<uint64_t>(fileSize), dataOffset)) {
+        close();
+        return false;
+    }
+
+    decodedQuantized.assign(valueCount, 0);
+    decodedFrame = SIZE_MAX;
+    return true;
+}
+
+void TemperatureRecordReader::close() {
+    if (file.is_open()) {
+        file.close();
+    }
+    file.clear();
+    header = {};
+    receivers.clear();
+    index.clear();
+    valueCount = 0;
+    payload.clear();
+    decodedQuantized.clear();
+    decodedFrame = SIZE_MAX;
+}
+
+uint32_t TemperatureRecordReader::findSurfaceValueIndex(uint32_t runtimeModelId, uint32_t vertexIndex) const {
+    uint32_t base = header.nodeCount;
+    for (const temperaturerecord::ReceiverEntry& receiver : receivers) {
+        if (receiver.runtimeModelId == runtimeModelId) {
+            return vertexIndex < receiver.vertexCount ? base + vertexIndex : UINT32_MAX;
+        }
+        base += receiver.vertexCount;
+    }
+    return UINT32_MAX;
+}
+
+bool TemperatureRecordReader::readIndexFooter(uint64_t fileSize, uint64_t dataOffset) {
+    if (fileSize < dataOffset + sizeof(temperaturerecord::IndexFooter)) {
+        return false;
+    }
+
+    temperaturerecord::IndexFooter footer{};
+    file.seekg(static_cast<std::streamoff>(fileSize - sizeof(footer)));
+    file.read(reinterpret_cast<char*>(&footer), sizeof(footer));
+    if (!file || footer.magic != temperaturerecord::INDEX_MAGIC) {
+        file.clear();
+        return false;
+    }
+
+    const uint64_t indexBytes = sizeof(temperaturerecord::IndexEntry) * static_cast<uint64_t>(footer.entryCount);
+    if (footer.indexOffset < dataOffset || footer.indexOffset + indexBytes + sizeof(footer) != fileSize) {
+        return false;
+    }
+
+    index.resize(footer.entryCount);
+    file.seekg(static_cast<std::streamoff>(footer.indexOffset));
+    if (!index.empty()) {
+        file.read(reinterpret_cast<char*>(index.data()), static_cast<std::streamsize>(indexBytes));
+    }
+    if (!file || (!index.empty() && (index.front().flags & temperaturerecord::CHUNK_FLAG_KEYFRAME) == 0u)) {
+        file.clear();
+        index.clear();
+        return false;
+    }
+    return true;
+}
+
+bool TemperatureRecordReader::scanChunks(uint64_t fileSize, uint64_t dataOffset) {
+    index.clear();
+    file.clear();
+
+    uint64_t offset = dataOffset;
+    while (offset + sizeof(temperaturerecord::ChunkHeader) <= fileSize) {
+        temperaturerecord::ChunkHeader chunk{};
+        file.seekg(static_cast<std::streamoff>(offset));
+        file.read(reinterpret_cast<char*>(&chunk), sizeof(chunk));
+        if (!file || chunk.magic != temperaturerecord::CHUNK_MAGIC || chunk.valueCount != valueCount) {
+            break;
+        }
+
+        const uint64_t chunkEnd = offset + sizeof(chunk) + chunk.payloadBytes;
+        if (chunkEnd > fileSize) {
+            break;
+        }
+
+        temperaturerecord::IndexEntry entry{};
+        entry.fileOffset = offset;
+        entry.stepIndex = chunk.stepIndex;
+        entry.simulatedTime = chunk.simulatedTime;
+        entry.flags = chunk.flags;
+        index.push_back(entry);
+        offset = chunkEnd;
+    }
+
+    file.clear();
+    if (!index.empty() && (index.front().flags & temperaturerecord::CHUNK_FLAG_KEYFRAME) == 0u) {
+        index.clear();
+    }
+    return !index.empty();
+}
+
+bool TemperatureRecordReader::decodeFrame(size_t frameIndex) {
+    if (frameIndex >= index.size()) {
+        return false;
+    }
+    if (frameIndex == decodedFrame) {
+        return true;
+    }
+
+    // Continue from the cached frame when it lies between the keyframe and the target
+    size_t keyframe = frameIndex;
+    while (keyframe > 0 && (index[keyframe].flags & temperaturerecord::CHUNK_FLAG_KEYFRAME) == 0u) {
+        --keyframe;
+    }
+    size_t begin = keyframe;
+    if (decodedFrame != SIZE_MAX && decodedFrame >= keyframe && decodedFrame < frameIndex) {
+        begin = decodedFrame + 1;
+    }
+
+    for (size_t current = begin; current <= frameIndex; ++current) {
+        temperaturerecord::ChunkHeader chunk{};
+        file.seekg(static_cast<std::streamoff>(index[current].fileOffset));
+        file.read(reinterpret_cast<char*>(&chunk), sizeof(chunk));
+        if (!file || chunk.magic != temperaturerecord::CHUNK_MAGIC || chunk.valueCount != valueCount) {
+            file.clear();
+            decodedFrame = SIZE_MAX;
+            return false;
+        }
+
+        payload.resize(chunk.payloadBytes);
+        file.read(reinterpret_cast<char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+        if (!file) {
+            file.clear();
+            decodedFrame = SIZE_MAX;
+            return false;
+        }
+
+        const bool keyframeChunk = (chunk.flags & temperaturerecord::CHUNK_FLAG_KEYFRAME) != 0u;
+        const uint8_t* cursor = payload.data();
+        const uint8_t* end = cursor + payload.size();
+        for (uint32_t valueIndex = 0; valueIndex < valueCount; ++valueIndex) {
+            int64_t value = 0;
+            if (!temperaturerecord::readVarint(cursor, end, value)) {
+                decodedFrame = SIZE_MAX;
+                return false;
+            }
+            decodedQuantized[valueIndex] = keyframeChunk ? value : decodedQuantized[valueIndex] + value;
+        }
+        decodedFrame = current;
+    }
+    return true;
+}
+
+bool TemperatureRecordReader::readFrame(size_t frameIndex, std::vector<float>& outValues) {
+    if (!decodeFrame(frameIndex)) {
+        return false;
+    }
+
+    outValues.resize(valueCount);
+    for (uint32_t valueIndex = 0; valueIndex < valueCount; ++valueIndex) {
+        outValues[valueIndex] = temperaturerecord::dequantize(decodedQuantized[valueIndex], header.quantizationStep);
+    }
+    return true;
+}
+
+bool TemperatureRecordReader::readHistory(const std::vector<uint32_t>& valueIndices, std::vector<float>& outHistory) {
+    outHistory.clear();
+    for (uint32_t valueIndex : valueIndices) {
+        if (valueIndex >= valueCount) {
+            return false;
+        }
+    }
+
+    outHistory.resize(index.size() * valueIndices.size());
+    for (size_t frameIndex = 0; frameIndex < index.size(); ++frameIndex) {
+        if (!decodeFrame(frameIndex)) {
+            outHistory.clear();
+            return false;
+        }
+        for (size_t probe = 0; probe < valueIndices.size(); ++probe) {
+            outHistory[frameIndex * valueIndices.size() + probe] =
+                temperaturerecord::dequantize(decodedQuantized[valueIndices[probe]], header.quantizationStep);
+        }
+    }
+    return true;
+}
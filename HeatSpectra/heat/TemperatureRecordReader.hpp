@@ -0,0 +1,49 @@
+#pragma once
+
+#include "TemperatureRecordFormat.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Random access over a file written by TemperatureRecordWriter. Values of a frame
+// are ordered as all Voronoi nodes, then each receiver's surface vertices in
+// header order. Reading frame N decodes forward from the nearest keyframe; the
+// last decoded frame is kept, so walking frames in order is linear overall.
+class TemperatureRecordReader {
+public:
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return file.is_open(); }
+
+    uint32_t getNodeCount() const { return header.nodeCount; }
+    uint32_t getValueCount() const { return valueCount; }
+    float getQuantizationStep() const { return header.quantizationStep; }
+    const std::vector<temperaturerecord::ReceiverEntry>& getReceivers() const { return receivers; }
+    // Index of a surface vertex in the frame values, or UINT32_MAX if unknown
+    uint32_t findSurfaceValueIndex(uint32_t runtimeModelId, uint32_t vertexIndex) const;
+
+    size_t getFrameCount() const { return index.size(); }
+    uint64_t getStepIndex(size_t frameIndex) const { return index[frameIndex].stepIndex; }
+    double getSimulatedTime(size_t frameIndex) const { return index[frameIndex].simulatedTime; }
+
+    bool readFrame(size_t frameIndex, std::vector<float>& outValues);
+    // outHistory is frame-major: outHistory[frame * valueIndices.size() + probe]
+    bool readHistory(const std::vector<uint32_t>& valueIndices, std::vector<float>& outHistory);
+
+private:
+    bool readIndexFooter(uint64_t fileSize, uint64_t dataOffset);
+    bool scanChunks(uint64_t fileSize, uint64_t dataOffset);
+    bool decodeFrame(size_t frameIndex);
+
+    std::ifstream file;
+    temperaturerecord::FileHeader header{};
+    std::vector<temperaturerecord::ReceiverEntry> receivers;
+    std::vector<temperaturerecord::IndexEntry> index;
+    uint32_t valueCount = 0;
+
+    std::vector<uint8_t> payload;
+    std::vector<int64_t> decodedQuantized;
+    size_t decodedFrame = SIZE_MAX;
+};
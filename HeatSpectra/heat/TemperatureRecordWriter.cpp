@@ -0,0 +1,206 @@
+#include "TemperatureRecordWriter.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <utility>
+
+TemperatureRecordWriter::~TemperatureRecordWriter() {
+    close();
+}
+
+bool TemperatureRecordWriter::open(const std::string& path, const Layout& updatedLayout) {
+    close();
+
+    if (path.empty() || !(updatedLayout.quantizationStep > 0.0f)) {
+        return false;
+    }
+
+    uint64_t totalValues = updatedLayout.nodeCount;
+    for (const temperaturerecord::ReceiverEntry& receiver : updatedLayout.receivers) {
+        totalValues += receiver.vertexCount;
+    }
+    if (totalValues == 0 || totalValues > UINT32_MAX) {
+        return false;
+    }
+
+    file.open(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "[TemperatureRecordWriter] Failed to open " << path << " for writing" << std::endl;
+        return false;
+    }
+
+    layout = updatedLayout;
+    layout.keyframeInterval = std::max(layout.keyframeInterval, 1u);
+    filePath = path;
+    valueCount = static_cast<uint32_t>(totalValues);
+
+    temperaturerecord::FileHeader header{};
+    header.magic = temperaturerecord::FILE_MAGIC;
+    header.version = temperaturerecord::FILE_VERSION;
+    header.nodeCount = layout.nodeCount;
+    header.receiverCount = static_cast<uint32_t>(layout.receivers.size());
+    header.quantizationStep = layout.quantizationStep;
+    header.keyframeInterval = layout.keyframeInterval;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (!layout.receivers.empty()) {
+        file.write(
+            reinterpret_cast<const char*>(layout.receivers.data()),
+            static_cast<std::streamsize>(sizeof(temperaturerecord::ReceiverEntry) * layout.receivers.size()));
+    }
+    if (!file) {
+        std::cerr << "[TemperatureRecordWriter] Failed to write header to " << path << std::endl;
+        file.close();
+        return false;
+    }
+
+    writeOffset = sizeof(header) + sizeof(temperaturerecord::ReceiverEntry) * layout.receivers.size();
+    previousQuantized.assign(valueCount, 0);
+    payload.clear();
+    index.clear();
+    framesSinceKeyframe = 0;
+    writeFailed = false;
+    stopping = false;
+    droppedFrameCount = 0;
+    writerThread = std::thread(&TemperatureRecordWriter::writerLoop, this);
+    return true;
+}
+
+void TemperatureRecordWriter::close() {
+    if (!writerThread.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    condition.notify_all();
+    writerThread.join();
+
+    if (!writeFailed && !writeIndex()) {
+        std::cerr << "[TemperatureRecordWriter] Failed to write index to " << filePath << std::endl;
+    }
+    file.close();
+
+    if (droppedFrameCount > 0) {
+        std::cerr << "[TemperatureRecordWriter] Dropped " << droppedFrameCount
+                  << " snapshots while the writer was behind" << std::endl;
+    }
+
+    pendingFrames.clear();
+    freeValues.clear();
+    previousQuantized.clear();
+    payload.clear();
+    index.clear();
+    valueCount = 0;
+}
+
+std::vector<float> TemperatureRecordWriter::acquireValues() {
+    std::vector<float> values;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!freeValues.empty()) {
+            values = std::move(freeValues.back());
+            freeValues.pop_back();
+        }
+    }
+    values.resize(valueCount);
+    return values;
+}
+
+bool TemperatureRecordWriter::submit(Frame&& frame) {
+    if (!isOpen() || frame.values.size() != valueCount) {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (pendingFrames.size() >= MAX_PENDING_FRAMES || writeFailed) {
+            ++droppedFrameCount;
+            freeValues.push_back(std::move(frame.values));
+            return false;
+        }
+        pendingFrames.push_back(std::move(frame));
+    }
+    condition.notify_one();
+    return true;
+}
+
+void TemperatureRecordWriter::writerLoop() {
+    while (true) {
+        Frame frame;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [this]() { return stopping || !pendingFrames.empty(); });
+            if (pendingFrames.empty()) {
+                return;
+            }
+            frame = std::move(pendingFrames.front());
+            pendingFrames.pop_front();
+        }
+
+        const bool written = writeFrame(frame);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        freeValues.push_back(std::move(frame.values));
+        if (!written) {
+            writeFailed = true;
+            pendingFrames.clear();
+            std::cerr << "[TemperatureRecordWriter] Failed to write snapshot to " << filePath << std::endl;
+            return;
+        }
+    }
+}
+
+bool TemperatureRecordWriter::writeFrame(const Frame& frame) {
+    const bool keyframe = framesSinceKeyframe == 0;
+    payload.clear();
+    payload.reserve(frame.values.size() * 2);
+    for (size_t valueIndex = 0; valueIndex < frame.values.size(); ++valueIndex) {
+        const int64_t quantized = temperaturerecord::quantize(frame.values[valueIndex], layout.quantizationStep);
+        temperaturerecord::appendVarint(payload, keyframe ? quantized : quantized - previousQuantized[valueIndex]);
+        previousQuantized[valueIndex] = quantized;
+    }
+    if (payload.size() > UINT32_MAX) {
+        return false;
+    }
+
+    temperaturerecord::ChunkHeader header{};
+    header.magic = temperaturerecord::CHUNK_MAGIC;
+    header.flags = keyframe ? temperaturerecord::CHUNK_FLAG_KEYFRAME : 0u;
+    header.stepIndex = frame.stepIndex;
+    header.simulatedTime = frame.simulatedTime;
+    header.valueCount = valueCount;
+    header.payloadBytes = static_cast<uint32_t>(payload.size());
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+    if (!file) {
+        return false;
+    }
+
+    temperaturerecord::IndexEntry entry{};
+    entry.fileOffset = writeOffset;
+    entry.stepIndex = frame.stepIndex;
+    entry.simulatedTime = frame.simulatedTime;
+    entry.flags = header.flags;
+    index.push_back(entry);
+
+    writeOffset += sizeof(header) + payload.size();
+    framesSinceKeyframe = (framesSinceKeyframe + 1) % layout.keyframeInterval;
+    return true;
+}
+
+bool TemperatureRecordWriter::writeIndex() {
+    temperaturerecord::IndexFooter footer{};
+    footer.indexOffset = writeOffset;
+    footer.entryCount = static_cast<uint32_t>(index.size());
+    footer.magic = temperaturerecord::INDEX_MAGIC;
+    if (!index.empty()) {
+        file.write(
+            reinterpret_cast<const char*>(index.data()),
+            static_cast<std::streamsize>(sizeof(temperaturerecord::IndexEntry) * index.size()));
+    }
+    file.write(reinterpret_cast<const char*>(&footer), sizeof(footer));
+    file.flush();
+    return static_cast<bool>(file);
+}
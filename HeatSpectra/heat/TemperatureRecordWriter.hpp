@@ -0,0 +1,75 @@
+#pragma once
+
+#include "TemperatureRecordFormat.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Appends temperature snapshots to a recording file from a background thread.
+// submit never blocks on disk: when the queue is full the snapshot is dropped
+// and counted, so the solver keeps its frame rate even on a slow drive.
+class TemperatureRecordWriter {
+public:
+    struct Layout {
+        uint32_t nodeCount = 0;
+        std::vector<temperaturerecord::ReceiverEntry> receivers;
+        float quantizationStep = 1.0e-4f;
+        uint32_t keyframeInterval = 32;
+    };
+
+    struct Frame {
+        uint64_t stepIndex = 0;
+        double simulatedTime = 0.0;
+        std::vector<float> values;
+    };
+
+    static constexpr size_t MAX_PENDING_FRAMES = 8;
+
+    TemperatureRecordWriter() = default;
+    ~TemperatureRecordWriter();
+
+    TemperatureRecordWriter(const TemperatureRecordWriter&) = delete;
+    TemperatureRecordWriter& operator=(const TemperatureRecordWriter&) = delete;
+
+    bool open(const std::string& path, const Layout& layout);
+    // Drains the queue, writes the index and closes the file
+    void close();
+    bool isOpen() const { return writerThread.joinable(); }
+
+    uint32_t getValueCount() const { return valueCount; }
+    // Returns a recycled value buffer sized for one frame
+    std::vector<float> acquireValues();
+    bool submit(Frame&& frame);
+
+private:
+    void writerLoop();
+    bool writeFrame(const Frame& frame);
+    bool writeIndex();
+
+    std::ofstream file;
+    std::string filePath;
+    Layout layout;
+    uint32_t valueCount = 0;
+
+    std::thread writerThread;
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::deque<Frame> pendingFrames;
+    std::vector<std::vector<float>> freeValues;
+    bool stopping = false;
+    uint64_t droppedFrameCount = 0;
+
+    // Owned by the writer thread while it runs
+    std::vector<int64_t> previousQuantized;
+    std::vector<uint8_t> payload;
+    std::vector<temperaturerecord::IndexEntry> index;
+    uint64_t writeOffset = 0;
+    uint32_t framesSinceKeyframe = 0;
+    bool writeFailed = false;
+};
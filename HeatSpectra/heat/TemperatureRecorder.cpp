@@ -0,0 +1,291 @@
+#include "TemperatureRecorder.hpp"
+
+#include "HeatReceiverRuntime.hpp"
+#include "heat/HeatGpuStructs.hpp"
+#include "vulkan/MemoryAllocator.hpp"
+#include "vulkan/VulkanDevice.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+namespace {
+
+constexpr VkDeviceSize SURFACE_DATA_ALIGNMENT = 16;
+constexpr size_t SURFACE_TEMPERATURE_OFFSET = offsetof(heat::SurfacePoint, temperature);
+
+std::string rotatedPath(const std::string& path, uint32_t index) {
+    if (index == 0) {
+        return path;
+    }
+
+    std::filesystem::path rotated(path);
+    const std::filesystem::path extension = rotated.extension();
+    rotated.replace_extension();
+    rotated += "." + std::to_string(index);
+    rotated += extension;
+    return rotated.string();
+}
+
+}
+
+TemperatureRecorder::TemperatureRecorder(VulkanDevice& vulkanDevice, MemoryAllocator& memoryAllocator, uint32_t maxFramesInFlight)
+    : vulkanDevice(vulkanDevice),
+      memoryAllocator(memoryAllocator),
+      slots(std::max(maxFramesInFlight, 1u)) {
+}
+
+TemperatureRecorder::~TemperatureRecorder() {
+    stop();
+}
+
+void TemperatureRecorder::setSettings(const TemperatureRecordSettings& updatedSettings) {
+    TemperatureRecordSettings sanitized = updatedSettings;
+    sanitized.stepInterval = std::max(sanitized.stepInterval, 1u);
+
+    const bool restart =
+        sanitized.enabled != settings.enabled ||
+        sanitized.path != settings.path;
+    if (restart) {
+        stop();
+        writerFailed = false;
+        recordingIndex = 0;
+    }
+    settings = sanitized;
+}
+
+bool TemperatureRecorder::matchesLayout(uint32_t nodeCount, const std::vector<std::unique_ptr<HeatReceiverRuntime>>& receivers) const {
+    if (nodeCount != layout.nodeCount) {
+        return false;
+    }
+
+    size_t receiverIndex = 0;
+    for (const auto& receiver : receivers) {
+        if (!receiver || receiver->getSurfaceBuffer() == VK_NULL_HANDLE) {
+            continue;
+        }
+        if (receiverIndex >= layout.receivers.size() ||
+            layout.receivers[receiverIndex].runtimeModelId != receiver->getRuntimeModelId() ||
+            layout.receivers[receiverIndex].vertexCount != receiver->getIntrinsicVertexCount()) {
+            return false;
+        }
+        ++receiverIndex;
+    }
+    return receiverIndex == layout.receivers.size();
+}
+
+bool TemperatureRecorder::ensureSlotBuffer(SnapshotSlot& slot, VkDeviceSize size) {
+    if (slot.buffer != VK_NULL_HANDLE && slot.size == size) {
+        return true;
+    }
+
+    if (slot.buffer != VK_NULL_HANDLE) {
+        memoryAllocator.free(slot.buffer, slot.offset);
+        slot = {};
+    }
+
+    auto [buffer, offset] = memoryAllocator.allocate(
+        size,
+        VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    if (buffer == VK_NULL_HANDLE) {
+        return false;
+    }
+
+    slot.buffer = buffer;
+    slot.offset = offset;
+    slot.size = size;
+    slot.mapped = static_cast<const uint8_t*>(memoryAllocator.getMappedPointer(buffer, offset));
+    if (!slot.mapped) {
+        memoryAllocator.free(buffer, offset);
+        slot = {};
+        return false;
+    }
+    return true;
+}
+
+void TemperatureRecorder::harvestSlot(SnapshotSlot& slot) {
+    if (!slot.pending) {
+        return;
+    }
+    slot.pending = false;
+    if (!writer.isOpen()) {
+        return;
+    }
+
+    TemperatureRecordWriter::Frame frame;
+    frame.stepIndex = slot.stepIndex;
+    frame.simulatedTime = slot.simulatedTime;
+    frame.values = writer.acquireValues();
+
+    std::memcpy(frame.values.data(), slot.mapped, sizeof(float) * layout.nodeCount);
+    size_t valueIndex = layout.nodeCount;
+    const uint8_t* surfaceData = slot.mapped + surfaceDataOffset;
+    for (const temperaturerecord::ReceiverEntry& receiver : layout.receivers) {
+        for (uint32_t vertexIndex = 0; vertexIndex < receiver.vertexCount; ++vertexIndex) {
+            std::memcpy(&frame.values[valueIndex++], surfaceData + SURFACE_TEMPERATURE_OFFSET, sizeof(float));
+            surfaceData += sizeof(heat::SurfacePoint);
+        }
+    }
+
+    writer.submit(std::move(frame));
+}
+
+void TemperatureRecorder::recordSnapshot(
+    VkCommandBuffer commandBuffer,
+    uint32_t currentFrame,
+    VkBuffer temperatureBuffer,
+    VkDeviceSize temperatureBufferOffset,
+    uint32_t nodeCount,
+    const std::vector<std::unique_ptr<HeatReceiverRuntime>>& receivers,
+    uint64_t stepIndex,
+    uint32_t submittedStepCount,
+    double simulatedTime) {
+    SnapshotSlot& slot = slots[currentFrame % slots.size()];
+    harvestSlot(slot);
+
+    if (!isRecording() || writerFailed || nodeCount == 0 || temperatureBuffer == VK_NULL_HANDLE) {
+        return;
+    }
+
+    if (writer.isOpen() && !matchesLayout(nodeCount, receivers)) {
+        stop();
+    }
+
+    if (!writer.isOpen()) {
+        layout = {};
+        layout.nodeCount = nodeCount;
+        for (const auto& receiver : receivers) {
+            if (receiver && receiver->getSurfaceBuffer() != VK_NULL_HANDLE) {
+                layout.receivers.push_back({
+                    receiver->getRuntimeModelId(),
+                    static_cast<uint32_t>(receiver->getIntrinsicVertexCount()) });
+            }
+        }
+        const std::string path = rotatedPath(settings.path, recordingIndex);
+        if (!writer.open(path, layout)) {
+            std::cerr << "[TemperatureRecorder] Recording disabled, could not start " << path << std::endl;
+            writerFailed = true;
+            return;
+        }
+        ++recordingIndex;
+        nextSnapshotStep = stepIndex;
+    }
+
+    if (stepIndex < nextSnapshotStep) {
+        return;
+    }
+
+    // Only the last step of a submission can be captured, so the stride is the
+    // interval rounded up to a whole number of submissions
+    const uint64_t submissionSteps = std::max(submittedStepCount, 1u);
+    const uint64_t stride = (settings.stepInterval + submissionSteps - 1) / submissionSteps * submissionSteps;
+    if (stride != settings.stepInterval && stride != reportedStride) {
+        std::cerr << "[TemperatureRecorder] Recording every " << stride << " steps instead of "
+                  << settings.stepInterval << ", each submission advances " << submissionSteps << " steps" << std::endl;
+        reportedStride = stride;
+    }
+
+    surfaceDataOffset = (sizeof(float) * static_cast<VkDeviceSize>(nodeCount) + SURFACE_DATA_ALIGNMENT - 1) &
+        ~(SURFACE_DATA_ALIGNMENT - 1);
+    VkDeviceSize snapshotSize = surfaceDataOffset;
+    for (const temperaturerecord::ReceiverEntry& receiver : layout.receivers) {
+        snapshotSize += sizeof(heat::SurfacePoint) * static_cast<VkDeviceSize>(receiver.vertexCount);
+    }
+    if (!ensureSlotBuffer(slot, snapshotSize)) {
+        std::cerr << "[TemperatureRecorder] Failed to allocate snapshot buffer" << std::endl;
+        return;
+    }
+
+    VkMemoryBarrier computeToTransfer{};
+    computeToTransfer.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    computeToTransfer.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    computeToTransfer.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    vkCmdPipelineBarrier(
+        commandBuffer,
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        0,
+        1,
+        &computeToTransfer,
+        0,
+        nullptr,
+        0,
+        nullptr);
+
+    const VkBufferCopy nodeRegion{ temperatureBufferOffset, slot.offset, sizeof(float) * static_cast<VkDeviceSize>(nodeCount) };
+    vkCmdCopyBuffer(commandBuffer, temperatureBuffer, slot.buffer, 1, &nodeRegion);
+
+    VkDeviceSize dstOffset = slot.offset + surfaceDataOffset;
+    for (const auto& receiver : receivers) {
+        if (!receiver || receiver->getSurfaceBuffer() == VK_NULL_HANDLE) {
+            continue;
+        }
+        const VkDeviceSize surfaceSize = sizeof(heat::SurfacePoint) * static_cast<VkDeviceSize>(receiver->getIntrinsicVertexCount());
+        if (surfaceSize == 0) {
+            continue;
+        }
+        const VkBufferCopy surfaceRegion{ receiver->getSurfaceBufferOffset(), dstOffset, surfaceSize };
+        vkCmdCopyBuffer(commandBuffer, receiver->getSurfaceBuffer(), slot.buffer, 1, &surfaceRegion);
+        dstOffset += surfaceSize;
+    }
+
+    // Make the copy visible to the host and keep the next submission's shaders
+    // from overwriting the sources before the copy has read them
+    VkMemoryBarrier transferToHost{};
+    transferToHost.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    transferToHost.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    transferToHost.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    vkCmdPipelineBarrier(
+        commandBuffer,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_PIPELINE_STAGE_HOST_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        0,
+        1,
+        &transferToHost,
+        0,
+        nullptr,
+        0,
+        nullptr);
+
+    slot.pending = true;
+    slot.stepIndex = stepIndex;
+    slot.simulatedTime = simulatedTime;
+    nextSnapshotStep = stepIndex + stride;
+}
+
+void TemperatureRecorder::stop() {
+    std::vector<SnapshotSlot*> pendingSlots;
+    for (SnapshotSlot& slot : slots) {
+        if (slot.pending) {
+            pendingSlots.push_back(&slot);
+        }
+    }
+
+    if (!pendingSlots.empty()) {
+        vkDeviceWaitIdle(vulkanDevice.getDevice());
+        std::sort(pendingSlots.begin(), pendingSlots.end(), [](const SnapshotSlot* lhs, const SnapshotSlot* rhs) {
+            return lhs->stepIndex < rhs->stepIndex;
+        });
+        for (SnapshotSlot* slot : pendingSlots) {
+            harvestSlot(*slot);
+        }
+    }
+
+    writer.close();
+    freeSlots();
+    layout = {};
+    nextSnapshotStep = 0;
+}
+
+void TemperatureRecorder::freeSlots() {
+    for (SnapshotSlot& slot : slots) {
+        if (slot.buffer != VK_NULL_HANDLE) {
+            memoryAllocator.free(slot.buffer, slot.offset);
+        }
+        slot = {};
+    }
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "TemperatureRecordFormat.hpp"
+#include "TemperatureRecordWriter.hpp"
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class MemoryAllocator;
+class VulkanDevice;
+class HeatReceiverRuntime;
+
+// Streams solver temperatures to a TemperatureRecordWriter every stepInterval steps,
+// rounded up to a multiple of the steps each submission advances.
+// Each frame slot owns a host-visible snapshot buffer that the compute command
+// buffer copies into; the slot is read back the next time it is recorded, after
+// FrameSync has waited on its fence, so the GPU is never stalled for a snapshot.
+class TemperatureRecorder {
+public:
+    TemperatureRecorder(VulkanDevice& vulkanDevice, MemoryAllocator& memoryAllocator, uint32_t maxFramesInFlight);
+    ~TemperatureRecorder();
+
+    // Stops the current recording when the file or enabled flag changes. The next
+    // recording starts over at the configured path.
+    void setSettings(const TemperatureRecordSettings& settings);
+    bool isRecording() const { return settings.enabled && !settings.path.empty(); }
+
+    void recordSnapshot(
+        VkCommandBuffer commandBuffer,
+        uint32_t currentFrame,
+        VkBuffer temperatureBuffer,
+        VkDeviceSize temperatureBufferOffset,
+        uint32_t nodeCount,
+        const std::vector<std::unique_ptr<HeatReceiverRuntime>>& receivers,
+        uint64_t stepIndex,
+        uint32_t submittedStepCount,
+        double simulatedTime);
+
+    // Waits for in-flight snapshots, flushes them and finalizes the file. A later
+    // snapshot starts a new recording beside it, so a run saved to run.rec is
+    // followed by run.1.rec, run.2.rec and so on.
+    void stop();
+
+private:
+    struct SnapshotSlot {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VkDeviceSize offset = 0;
+        VkDeviceSize size = 0;
+        const uint8_t* mapped = nullptr;
+        bool pending = false;
+        uint64_t stepIndex = 0;
+        double simulatedTime = 0.0;
+    };
+
+    bool matchesLayout(uint32_t nodeCount, const std::vector<std::unique_ptr<HeatReceiverRuntime>>& receivers) const;
+    bool ensureSlotBuffer(SnapshotSlot& slot, VkDeviceSize size);
+    void harvestSlot(SnapshotSlot& slot);
+    void freeSlots();
+
+    VulkanDevice& vulkanDevice;
+    MemoryAllocator& memoryAllocator;
+    TemperatureRecordSettings settings;
+    TemperatureRecordWriter writer;
+    TemperatureRecordWriter::Layout layout;
+    std::vector<SnapshotSlot> slots;
+    VkDeviceSize surfaceDataOffset = 0;
+    uint64_t nextSnapshotStep = 0;
+    uint64_t reportedStride = 0;
+    uint32_t recordingIndex = 0;
+    bool writerFailed = false;
+};
@@ -1,10 +1,77 @@
 #include "CommonSubdivision.hpp"
 #include "iODT.hpp"
 #include <algorithm>
-#include <map>
-#include <set>
+#include <atomic>
 #include <cmath>
+#include <cstdint>
+#include <memory>
 #include <iostream>
+#include <unordered_map>
+
+namespace {
+
+const uint32_t EMPTY_SLOT = static_cast<uint32_t>(-1);
+
+using PointCell = std::array<int64_t, 3>;
+
+struct PointCellHash {
+    size_t operator()(const PointCell& cell) const {
+        uint64_t h = static_cast<uint64_t>(cell[0]) * 0x9E3779B97F4A7C15ull;
+        h ^= static_cast<uint64_t>(cell[1]) * 0xC2B2AE3D27D4EB4Full + (h << 6) + (h >> 2);
+        h ^= static_cast<uint64_t>(cell[2]) * 0x165667B19E3779F9ull + (h << 6) + (h >> 2);
+        return static_cast<size_t>(h ^ (h >> 29));
+    }
+};
+
+// Lock-free union-find that always links the higher root under the lower one,
+// so each cluster's root is its lowest point index.
+class PointUnionFind {
+public:
+    explicit PointUnionFind(size_t count)
+        : parent(new std::atomic<uint32_t>[count]) {
+        const int parentCount = static_cast<int>(count);
+        #pragma omp parallel for schedule(static)
+        for (int i = 0; i < parentCount; ++i) {
+            parent[i].store(static_cast<uint32_t>(i), std::memory_order_relaxed);
+        }
+    }
+    
+    uint32_t find(uint32_t x) {
+        while (true) {
+            uint32_t p = parent[x].load();
+            if (p == x) {
+                return x;
+            }
+            uint32_t grandparent = parent[p].load();
+            if (grandparent != p) {
+                parent[x].compare_exchange_weak(p, grandparent);
+            }
+            x = grandparent;
+        }
+    }
+    
+    void unite(uint32_t a, uint32_t b) {
+        while (true) {
+            a = find(a);
+            b = find(b);
+            if (a == b) {
+                return;
+            }
+            if (a < b) {
+                std::swap(a, b);
+            }
+            uint32_t expected = a;
+            if (parent[a].compare_exchange_strong(expected, b)) {
+                return;
+            }
+        }
+    }
+    
+private:
+    std::unique_ptr<std::atomic<uint32_t>[]> parent;
+};
+
+}
 
 CommonSubdivision::CommonSubdivision(const SignpostMesh& intrinsicMesh, const SignpostMesh& inputMesh, const GeodesicTracer& tracer,
     const std::unordered_map<uint32_t, GeodesicTracer::SurfacePoint>& vertexLocations, iODT& remesher)
@@ -20,33 +87,44 @@ void CommonSubdivision::build() {
     auto& conn = intrinsicMesh.getConnectivity();
     const auto& faces = conn.getFaces();
     
-
-    // Build all intrinsic triangles
-    intrinsicTriangles.clear();
-    intrinsicTriangles.reserve(faces.size());
-    
+    std::vector<uint32_t> liveFaces;
+    liveFaces.reserve(faces.size());
     for (uint32_t faceIdx = 0; faceIdx < faces.size(); ++faceIdx) {
-        if (faces[faceIdx].halfEdgeIdx == INVALID_INDEX) {
-            continue;
+        if (faces[faceIdx].halfEdgeIdx != INVALID_INDEX) {
+            liveFaces.push_back(faceIdx);
         }
-        
-        IntrinsicTriangle tri = buildIntrinsicTriangle(faceIdx);
+    }
+
+    // Trace intrinsic triangles in parallel, each face into its own slot so the order matches a serial build
+    std::vector<IntrinsicTriangle> tracedTriangles(liveFaces.size());
+    const int liveFaceCount = static_cast<int>(liveFaces.size());
+
+    #pragma omp parallel for schedule(dynamic, 64)
+    for (int i = 0; i < liveFaceCount; ++i) {
+        tracedTriangles[i] = buildIntrinsicTriangle(liveFaces[i]);
+    }
+
+    intrinsicTriangles.clear();
+    intrinsicTriangles.reserve(tracedTriangles.size());
+    for (auto& tri : tracedTriangles) {
         if (tri.faceIdx != INVALID_INDEX) {
-            intrinsicTriangles.push_back(tri);
+            intrinsicTriangles.push_back(std::move(tri));
         }
     }
+    tracedTriangles.clear();
     
-    // Extract all 3D points from intrinsic triangles
+    // Gather the traced 3D points
+    std::vector<size_t> triangleStartIndices(intrinsicTriangles.size());
+    size_t pointCount = 0;
+    for (size_t triIdx = 0; triIdx < intrinsicTriangles.size(); ++triIdx) {
+        triangleStartIndices[triIdx] = pointCount;
+        pointCount += intrinsicTriangles[triIdx].positions.size();
+    }
+
     std::vector<glm::vec3> allPoints;
-    std::vector<size_t> triangleStartIndices;
-    
-    for (auto& tri : intrinsicTriangles) {
-        triangleStartIndices.push_back(allPoints.size());
-        
-        for (const auto& sp : tri.vertices) {
-            glm::dvec3 pos3D = tracer.evaluateSurfacePoint(sp);
-            allPoints.push_back(glm::vec3(pos3D));
-        }
+    allPoints.reserve(pointCount);
+    for (const auto& tri : intrinsicTriangles) {
+        allPoints.insert(allPoints.end(), tri.positions.begin(), tri.positions.end());
     }
     
     // Merge nearby points 
@@ -64,107 +142,124 @@ void CommonSubdivision::build() {
         vertices[i].texCoord = glm::vec2(0.0f);
     }
     
-    // Store deduplicated indices and identify corners
-    for (size_t triIdx = 0; triIdx < intrinsicTriangles.size(); ++triIdx) {
-        size_t startIdx = triangleStartIndices[triIdx];
-        auto& tri = intrinsicTriangles[triIdx];
-        
-        tri.indices.clear();
-        tri.indices.reserve(tri.vertices.size());
-        
-        for (size_t i = 0; i < tri.vertices.size(); ++i) {
-            uint32_t mergedIdx = pointMapping[startIdx + i];
-            tri.indices.push_back(mergedIdx);
-        }
-        
-        // Find corner indices using barycentric coordinates
-        size_t cornerCount = 0;
-        std::array<bool, 3> cornerFound = {false, false, false};
-        
-        for (size_t i = 0; i < tri.vertices.size() && cornerCount < 3; ++i) {
-            const auto& bary = tri.baryCoords[i];
+    // Store deduplicated indices, identify corners and triangulate each intrinsic triangle locally
+    const int triangleCount = static_cast<int>(intrinsicTriangles.size());
+
+    #pragma omp parallel
+    {
+        std::vector<std::pair<uint32_t, uint32_t>> facePoints;
+
+        #pragma omp for schedule(dynamic, 64)
+        for (int triIdx = 0; triIdx < triangleCount; ++triIdx) {
+            size_t startIdx = triangleStartIndices[triIdx];
+            auto& tri = intrinsicTriangles[triIdx];
             
-            for (size_t c = 0; c < 3; ++c) {
-                if (cornerFound[c]) 
-                    continue;
-                
-                // Check if this is corner
-                bool isThisCorner = (bary[c] > 0.99) && 
-                                   (bary[(c+1)%3] < 0.01) && 
-                                   (bary[(c+2)%3] < 0.01);
+            tri.indices.clear();
+            tri.indices.reserve(tri.vertices.size());
+            
+            for (size_t i = 0; i < tri.vertices.size(); ++i) {
+                uint32_t mergedIdx = pointMapping[startIdx + i];
+                tri.indices.push_back(mergedIdx);
+            }
+            
+            // Find corner indices using barycentric coordinates
+            size_t cornerCount = 0;
+            std::array<bool, 3> cornerFound = {false, false, false};
+            
+            for (size_t i = 0; i < tri.vertices.size() && cornerCount < 3; ++i) {
+                const auto& bary = tri.baryCoords[i];
                 
-                if (isThisCorner) {
-                    tri.cornerIndices[c] = i;
-                    cornerFound[c] = true;
-                    cornerCount++;
-                    break;
+                for (size_t c = 0; c < 3; ++c) {
+                    if (cornerFound[c]) 
+                        continue;
+                    
+                    // Check if this is corner
+                    bool isThisCorner = (bary[c] > 0.99) && 
+                                       (bary[(c+1)%3] < 0.01) && 
+                                       (bary[(c+2)%3] < 0.01);
+                    
+                    if (isThisCorner) {
+                        tri.cornerIndices[c] = i;
+                        cornerFound[c] = true;
+                        cornerCount++;
+                        break;
+                    }
                 }
             }
+
+            triangulateIntrinsicTriangle(tri, facePoints);
         }
     }
     
-    
     // Generate colors for visualization
     std::vector<glm::vec3> faceColors = generateFaceColors(intrinsicTriangles.size());
     
-    // Build triangles by grouping points by input face
+    // Concatenate the local triangulations in triangle order
     indices.clear();
-    auto& inputConn = inputMesh.getConnectivity();
-    
     for (size_t triIdx = 0; triIdx < intrinsicTriangles.size(); ++triIdx) {
         glm::vec3 color = faceColors[triIdx];
-        auto& tri = intrinsicTriangles[triIdx];
+        const auto& tri = intrinsicTriangles[triIdx];
         
-        // Group points by input face
-        std::map<uint32_t, std::vector<size_t>> pointsByInputFace;
+        for (uint32_t localIdx : tri.triangulationIndices) {
+            uint32_t index = tri.indices[localIdx];
+            vertices[index].color = color;
+            indices.push_back(index);
+        }
+    }
+}
+
+void CommonSubdivision::triangulateIntrinsicTriangle(IntrinsicTriangle& tri, std::vector<std::pair<uint32_t, uint32_t>>& facePoints) const {
+    const uint32_t INVALID_INDEX = static_cast<uint32_t>(-1);
+    auto& inputConn = inputMesh.getConnectivity();
+    const auto& inputEdges = inputConn.getEdges();
+    const auto& inputHalfEdges = inputConn.getHalfEdges();
+
+    // Group points by input face as (input face, local point) pairs sorted by face
+    facePoints.clear();
+    for (uint32_t i = 0; i < static_cast<uint32_t>(tri.vertices.size()); ++i) {
+        const auto& sp = tri.vertices[i];
         
-        for (size_t i = 0; i < tri.vertices.size(); ++i) {
-            const auto& sp = tri.vertices[i];
-            std::vector<uint32_t> adjacentFaces;
+        if (sp.type == GeodesicTracer::SurfacePoint::Type::FACE) {
+            facePoints.emplace_back(sp.elementId, i);
+        }
+        else if (sp.type == GeodesicTracer::SurfacePoint::Type::EDGE) {
+            uint32_t he = inputEdges[sp.elementId].halfEdgeIdx;
+            uint32_t face1 = inputHalfEdges[he].face;
+            if (face1 != INVALID_INDEX) facePoints.emplace_back(face1, i);
             
-            if (sp.type == GeodesicTracer::SurfacePoint::Type::FACE) {
-                adjacentFaces.push_back(sp.elementId);
-            }
-            else if (sp.type == GeodesicTracer::SurfacePoint::Type::EDGE) {
-                uint32_t edgeId = sp.elementId;
-                uint32_t he = inputConn.getEdges()[edgeId].halfEdgeIdx;
-                uint32_t face1 = inputConn.getHalfEdges()[he].face;
-                if (face1 != INVALID_INDEX) adjacentFaces.push_back(face1);
-                
-                uint32_t oppositeHe = inputConn.getHalfEdges()[he].opposite;
-                if (oppositeHe != INVALID_INDEX) {
-                    uint32_t face2 = inputConn.getHalfEdges()[oppositeHe].face;
-                    if (face2 != INVALID_INDEX) adjacentFaces.push_back(face2);
-                }
+            uint32_t oppositeHe = inputHalfEdges[he].opposite;
+            if (oppositeHe != INVALID_INDEX) {
+                uint32_t face2 = inputHalfEdges[oppositeHe].face;
+                if (face2 != INVALID_INDEX) facePoints.emplace_back(face2, i);
             }
-            else if (sp.type == GeodesicTracer::SurfacePoint::Type::VERTEX) {
-                uint32_t vertId = sp.elementId;
-                auto vertexHalfedges = inputConn.getVertexHalfEdges(vertId);
-                for (uint32_t he : vertexHalfedges) {
-                    uint32_t faceId = inputConn.getHalfEdges()[he].face;
-                    if (faceId != INVALID_INDEX) adjacentFaces.push_back(faceId);
-                }
-            }
-            
-            for (uint32_t faceId : adjacentFaces) {
-                pointsByInputFace[faceId].push_back(i);
+        }
+        else if (sp.type == GeodesicTracer::SurfacePoint::Type::VERTEX) {
+            for (uint32_t he : inputConn.vertexHalfEdges(sp.elementId)) {
+                uint32_t faceId = inputHalfEdges[he].face;
+                if (faceId != INVALID_INDEX) facePoints.emplace_back(faceId, i);
             }
         }
+    }
+    std::sort(facePoints.begin(), facePoints.end());
+    
+    // Simple fan triangulation for each group
+    size_t groupBegin = 0;
+    while (groupBegin < facePoints.size()) {
+        size_t groupEnd = groupBegin + 1;
+        while (groupEnd < facePoints.size() && facePoints[groupEnd].first == facePoints[groupBegin].first) {
+            ++groupEnd;
+        }
         
-        // Simple fan triangulation for each group
-        for (const auto& [inputFaceId, pointIndices] : pointsByInputFace) {
-            if (pointIndices.size() < 3) 
-                continue;
-            
-            uint32_t anchor = tri.indices[pointIndices[0]];
-            uint32_t localAnchor = static_cast<uint32_t>(pointIndices[0]);
+        if (groupEnd - groupBegin >= 3) {
+            uint32_t localAnchor = facePoints[groupBegin].second;
+            uint32_t anchor = tri.indices[localAnchor];
             
-            for (size_t i = 1; i + 1 < pointIndices.size(); ++i) {
-                uint32_t idx1 = tri.indices[pointIndices[i]];
-                uint32_t idx2 = tri.indices[pointIndices[i + 1]];
+            for (size_t i = groupBegin + 1; i + 1 < groupEnd; ++i) {
+                uint32_t localIdx1 = facePoints[i].second;
+                uint32_t localIdx2 = facePoints[i + 1].second;
                 
-                uint32_t localIdx1 = static_cast<uint32_t>(pointIndices[i]);
-                uint32_t localIdx2 = static_cast<uint32_t>(pointIndices[i + 1]);
+                uint32_t idx1 = tri.indices[localIdx1];
+                uint32_t idx2 = tri.indices[localIdx2];
                 
                 // Skip degenerate triangles
                 if (anchor == idx1 || idx1 == idx2 || idx2 == anchor) 
@@ -178,24 +273,13 @@ void CommonSubdivision::build() {
                 if (area < 1e-8f) 
                     continue;
                 
-                // Set vertex colors
-                vertices[anchor].color = color;
-                vertices[idx1].color = color;
-                vertices[idx2].color = color;
-                
-                // Add triangle to global indices
-                indices.push_back(anchor);
-                indices.push_back(idx1);
-                indices.push_back(idx2);
-                
-                // Add triangle to local triangulation indices
                 tri.triangulationIndices.push_back(localAnchor);
                 tri.triangulationIndices.push_back(localIdx1);
                 tri.triangulationIndices.push_back(localIdx2);
             }
         }
+        groupBegin = groupEnd;
     }
-    
 }
 
 CommonSubdivision::IntrinsicTriangle CommonSubdivision::buildIntrinsicTriangle(uint32_t intrinsicFaceIdx) {
@@ -211,8 +295,8 @@ CommonSubdivision::IntrinsicTriangle CommonSubdivision::buildIntrinsicTriangle(u
     }
     
     // Get the 3 intrinsic vertices
-    auto faceVerts = conn.getFaceVertices(intrinsicFaceIdx);
-    if (faceVerts.size() != 3) {
+    std::array<uint32_t, 3> faceVerts;
+    if (!conn.getTriangleVertices(intrinsicFaceIdx, faceVerts)) {
         return triangle;
     }
     
@@ -221,8 +305,8 @@ CommonSubdivision::IntrinsicTriangle CommonSubdivision::buildIntrinsicTriangle(u
     triangle.intrinsicVertices[2] = faceVerts[2];
     
     // Get the 3 halfedges to trace
-    auto faceHalfedges = conn.getFaceHalfEdges(intrinsicFaceIdx);
-    if (faceHalfedges.size() != 3) {
+    std::array<uint32_t, 3> faceHalfedges;
+    if (!conn.getTriangleHalfEdges(intrinsicFaceIdx, faceHalfedges)) {
         return triangle;
     }
     
@@ -303,29 +387,110 @@ std::vector<glm::vec3> CommonSubdivision::mergeNearbyPoints(const std::vector<gl
     if (points.empty())
         return points;
     
-    std::vector<glm::vec3> merged;
-    merged.reserve(points.size());
-    outMapping.resize(points.size());
+    const int pointCount = static_cast<int>(points.size());
+    const double invCellSize = 1.0 / tolerance;
+    const double toleranceSq = tolerance * tolerance;
     
-    for (size_t i = 0; i < points.size(); ++i) {
-        const auto& point = points[i];
-        bool foundNearby = false;
-        
-        for (size_t j = 0; j < merged.size(); ++j) {
-            if (glm::length(point - merged[j]) <= tolerance) {
-                merged[j] = (merged[j] + point) * 0.5f;  // Average positions
-                outMapping[i] = static_cast<uint32_t>(j);
-                foundNearby = true;
-                break;
+    std::vector<PointCell> cells(points.size());
+    
+    #pragma omp parallel for schedule(static)
+    for (int i = 0; i < pointCount; ++i) {
+        cells[i] = {
+            static_cast<int64_t>(std::floor(points[i].x * invCellSize)),
+            static_cast<int64_t>(std::floor(points[i].y * invCellSize)),
+            static_cast<int64_t>(std::floor(points[i].z * invCellSize))
+        };
+    }
+    
+    // Sort points by cell so every cell is a contiguous run headed by its lowest index
+    std::vector<uint32_t> order(points.size());
+    for (int i = 0; i < pointCount; ++i) {
+        order[i] = static_cast<uint32_t>(i);
+    }
+    std::sort(order.begin(), order.end(), [&cells](uint32_t a, uint32_t b) {
+        return cells[a] != cells[b] ? cells[a] < cells[b] : a < b;
+    });
+    
+    // Cell -> lowest point index in it; filled sequentially and only read below
+    std::unordered_map<PointCell, uint32_t, PointCellHash> leaders;
+    leaders.reserve(points.size());
+    std::vector<uint32_t> runBegin(points.size(), 0);
+    std::vector<uint32_t> runEnd(points.size(), 0);
+    for (size_t begin = 0; begin < order.size();) {
+        size_t end = begin + 1;
+        while (end < order.size() && cells[order[end]] == cells[order[begin]]) {
+            ++end;
+        }
+        uint32_t leader = order[begin];
+        runBegin[leader] = static_cast<uint32_t>(begin);
+        runEnd[leader] = static_cast<uint32_t>(end);
+        leaders.emplace(cells[leader], leader);
+        begin = end;
+    }
+    
+    // Union every pair within tolerance, so chains spanning several cells end up in one cluster
+    PointUnionFind clusters(points.size());
+    
+    #pragma omp parallel for schedule(dynamic, 256)
+    for (int i = 0; i < pointCount; ++i) {
+        for (int dx = -1; dx <= 1; ++dx) {
+            for (int dy = -1; dy <= 1; ++dy) {
+                for (int dz = -1; dz <= 1; ++dz) {
+                    const PointCell neighbor = { cells[i][0] + dx, cells[i][1] + dy, cells[i][2] + dz };
+                    const auto leaderIt = leaders.find(neighbor);
+                    if (leaderIt == leaders.end())
+                        continue;
+                    
+                    const uint32_t leader = leaderIt->second;
+                    for (uint32_t k = runBegin[leader]; k < runEnd[leader]; ++k) {
+                        uint32_t j = order[k];
+                        if (j >= static_cast<uint32_t>(i))
+                            break;
+                        
+                        glm::vec3 offset = points[j] - points[i];
+                        if (static_cast<double>(glm::dot(offset, offset)) <= toleranceSq) {
+                            clusters.unite(static_cast<uint32_t>(i), j);
+                        }
+                    }
+                }
             }
         }
-        
-        if (!foundNearby) {
-            uint32_t newIdx = static_cast<uint32_t>(merged.size());
-            merged.push_back(point);
-            outMapping[i] = newIdx;
+    }
+    
+    // Roots are the lowest index of each cluster, independent of thread scheduling
+    std::vector<uint32_t> root(points.size());
+    
+    #pragma omp parallel for schedule(static)
+    for (int i = 0; i < pointCount; ++i) {
+        root[i] = clusters.find(static_cast<uint32_t>(i));
+    }
+    
+    // Number clusters by root and average their points
+    std::vector<uint32_t> mergedIndex(points.size(), EMPTY_SLOT);
+    std::vector<glm::dvec3> sums;
+    std::vector<uint32_t> counts;
+    sums.reserve(points.size());
+    counts.reserve(points.size());
+    outMapping.resize(points.size());
+    
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (root[i] == i) {
+            mergedIndex[i] = static_cast<uint32_t>(sums.size());
+            sums.emplace_back(0.0);
+            counts.push_back(0);
         }
     }
+    for (size_t i = 0; i < points.size(); ++i) {
+        uint32_t newIdx = mergedIndex[root[i]];
+        sums[newIdx] += glm::dvec3(points[i]);
+        counts[newIdx]++;
+        outMapping[i] = newIdx;
+    }
+    
+    std::vector<glm::vec3> merged(sums.size());
+    for (size_t i = 0; i < sums.size(); ++i) {
+        merged[i] = glm::vec3(sums[i] / static_cast<double>(counts[i]));
+    }
 
     return merged;
 }
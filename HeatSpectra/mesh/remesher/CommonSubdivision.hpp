@@ -7,6 +7,7 @@
 #include <vector>
 #include <array>
 #include <unordered_map>
+#include <utility>
 #include <glm/glm.hpp>
 
 class iODT;
@@ -59,6 +60,8 @@ public:
     const std::vector<uint32_t>& getIndices() const { return indices; }
 
 private:
+    void triangulateIntrinsicTriangle(IntrinsicTriangle& tri, std::vector<std::pair<uint32_t, uint32_t>>& facePoints) const;
+
     const SignpostMesh& intrinsicMesh;
     const SignpostMesh& inputMesh;
     const GeodesicTracer& tracer;
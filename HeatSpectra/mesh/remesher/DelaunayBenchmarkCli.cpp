@@ -0,0 +1,147 @@
+#include "DelaunayBenchmarkCli.hpp"
+
+#include "HalfEdgeMesh.hpp"
+#include "SignPostMesh.hpp"
+#include "util/ObjMeshLoader.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr const char* BENCH_COMMAND = "--bench-delaunay";
+
+void printUsage() {
+    std::cerr << "Usage:\n"
+              << "  HeatSpectra " << BENCH_COMMAND << " [--model <file.obj>]... [--subdivisions <count>]" << std::endl;
+}
+
+bool parseCount(const char* text, uint32_t& outValue) {
+    if (!text || *text == '\0') {
+        return false;
+    }
+    char* end = nullptr;
+    const unsigned long long value = std::strtoull(text, &end, 10);
+    if (*end != '\0' || value > UINT32_MAX) {
+        return false;
+    }
+    outValue = static_cast<uint32_t>(value);
+    return true;
+}
+
+// Splits every triangle into four at jittered edge points, which leaves plenty of
+// non-Delaunay edges for the flip to fix
+void subdivide(std::vector<float>& positions, std::vector<uint32_t>& indices, std::mt19937& generator) {
+    std::uniform_real_distribution<float> split(0.1f, 0.9f);
+    std::map<std::pair<uint32_t, uint32_t>, uint32_t> edgePoints;
+    const auto edgePoint = [&](uint32_t a, uint32_t b) {
+        const std::pair<uint32_t, uint32_t> key(std::min(a, b), std::max(a, b));
+        const auto it = edgePoints.find(key);
+        if (it != edgePoints.end()) {
+            return it->second;
+        }
+        const float t = split(generator);
+        const uint32_t point = static_cast<uint32_t>(positions.size() / 3);
+        for (int axis = 0; axis < 3; ++axis) {
+            positions.push_back(positions[3 * key.first + axis] * (1.0f - t) + positions[3 * key.second + axis] * t);
+        }
+        edgePoints.emplace(key, point);
+        return point;
+    };
+
+    std::vector<uint32_t> subdivided;
+    subdivided.reserve(indices.size() * 4);
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        const uint32_t a = indices[i];
+        const uint32_t b = indices[i + 1];
+        const uint32_t c = indices[i + 2];
+        const uint32_t ab = edgePoint(a, b);
+        const uint32_t bc = edgePoint(b, c);
+        const uint32_t ca = edgePoint(c, a);
+        subdivided.insert(subdivided.end(), { a, ab, ca, ab, b, bc, ca, bc, c, ab, bc, ca });
+    }
+    indices.swap(subdivided);
+}
+
+}
+
+bool isDelaunayBenchmarkCliInvocation(int argc, char** argv) {
+    return argc > 1 && argv[1] && std::strcmp(argv[1], BENCH_COMMAND) == 0;
+}
+
+int runDelaunayBenchmarkCli(int argc, char** argv) {
+    std::vector<std::string> modelPaths;
+    uint32_t subdivisionCount = 3;
+    for (int argIndex = 2; argIndex < argc; argIndex += 2) {
+        const char* option = argv[argIndex];
+        const char* value = argIndex + 1 < argc ? argv[argIndex + 1] : nullptr;
+        bool parsed = false;
+        if (std::strcmp(option, "--model") == 0 && value) {
+            modelPaths.push_back(value);
+            parsed = true;
+        } else if (std::strcmp(option, "--subdivisions") == 0) {
+            parsed = parseCount(value, subdivisionCount);
+        }
+        if (!parsed) {
+            printUsage();
+            return 1;
+        }
+    }
+    if (modelPaths.empty()) {
+        modelPaths = { "models/teapot.obj", "models/heatsink.obj" };
+    }
+
+    using Clock = std::chrono::steady_clock;
+    bool allDelaunay = true;
+    for (const std::string& modelPath : modelPaths) {
+        std::vector<glm::vec3> loadedPositions;
+        std::vector<uint32_t> indices;
+        if (!loadObjTriangles(modelPath, loadedPositions, indices)) {
+            return 1;
+        }
+        std::vector<float> positions;
+        positions.reserve(loadedPositions.size() * 3);
+        for (const glm::vec3& position : loadedPositions) {
+            positions.insert(positions.end(), { position.x, position.y, position.z });
+        }
+        std::mt19937 generator(7);
+        for (uint32_t level = 0; level < subdivisionCount; ++level) {
+            subdivide(positions, indices, generator);
+        }
+
+        // Same setup as iODT's intrinsic mesh before its Delaunay phase
+        SignpostMesh mesh;
+        mesh.buildFromIndexedData(positions, indices);
+        mesh.updateAllCornerAngles({});
+        HalfEdgeMesh& conn = mesh.getConnectivity();
+
+        const Clock::time_point start = Clock::now();
+        const int flipCount = conn.makeDelaunay();
+        const double milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        uint32_t nonDelaunayCount = 0;
+        for (const HalfEdgeMesh::Edge& edge : conn.getEdges()) {
+            if (edge.halfEdgeIdx != HalfEdgeMesh::INVALID_INDEX && !conn.isDelaunayEdge(edge.halfEdgeIdx)) {
+                ++nonDelaunayCount;
+            }
+        }
+        allDelaunay = allDelaunay && nonDelaunayCount == 0;
+
+        std::cout << modelPath << ": " << positions.size() / 3 << " vertices, " << indices.size() / 3
+                  << " triangles after " << subdivisionCount << " subdivisions, "
+                  << flipCount << " flips in " << std::fixed << std::setprecision(1) << milliseconds << " ms, "
+                  << nonDelaunayCount << " non-Delaunay edges" << std::defaultfloat << "\n";
+    }
+    std::cout << std::flush;
+    return allDelaunay ? 0 : 1;
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+// Times the intrinsic Delaunay flip on subdivided models and checks that every
+// edge ends Delaunay, handled before the UI starts:
+//   --bench-delaunay [--model <file.obj>]... [--subdivisions <count>]
+bool isDelaunayBenchmarkCliInvocation(int argc, char** argv);
+int runDelaunayBenchmarkCli(int argc, char** argv);
@@ -273,8 +273,8 @@ GeodesicTracer::GeodesicTraceResult GeodesicTracer::traceFromFaceBarycentric(
             return result;
         }
 
-        auto faceHEs = conn.getFaceHalfEdges(currFace);
-        if (faceHEs.size() != 3) {
+        std::array<uint32_t, 3> faceHEs;
+        if (!conn.getTriangleHalfEdges(currFace, faceHEs)) {
             return result;
         }
 
@@ -542,8 +542,9 @@ GeodesicTracer::GeodesicTraceResult GeodesicTracer::traceFromFace(uint32_t start
 
             // Find the halfedge incoming to the vertex in the current face
             uint32_t inHe = HalfEdgeMesh::INVALID_INDEX;
-            auto faceHEs = conn.getFaceHalfEdges(currFace);
-            for(size_t i = 0; i < faceHEs.size(); ++i) {
+            std::array<uint32_t, 3> faceHEs;
+            const bool faceValid = conn.getTriangleHalfEdges(currFace, faceHEs);
+            for(size_t i = 0; faceValid && i < faceHEs.size(); ++i) {
                 uint32_t he = faceHEs[i];
                 uint32_t nextHe = halfEdges[he].next;
                 // The vertex of a corner is the origin of the next halfedge
@@ -641,7 +642,11 @@ GeodesicTracer::GeodesicTraceResult GeodesicTracer::traceFromFace(uint32_t start
                 // Check if the smallest barycentric coordinate is near zero
                 if (min_bary < BARY_SNAP_TOL) {
                     // Map bestEdge to halfedge index on this face 
-                    auto faceHEs = conn.getFaceHalfEdges(currFace);
+                    std::array<uint32_t, 3> faceHEs = { INVALID_INDEX, INVALID_INDEX, INVALID_INDEX };
+                    if (!conn.getTriangleHalfEdges(currFace, faceHEs)) {
+                        result.success = false;
+                        return result;
+                    }
                     uint32_t heOnEdge = faceHEs[bestEdge];
                     uint32_t edgeIdx = conn.getEdgeFromHalfEdge(heOnEdge);
 
@@ -651,7 +656,7 @@ GeodesicTracer::GeodesicTraceResult GeodesicTracer::traceFromFace(uint32_t start
                     uint32_t vA = halfEdges[canonicalHe].origin;
                     uint32_t vB = halfEdges[oppCanon].origin;
 
-                    const auto& vertsRef = conn.getVertices();
+                    const auto& positionsRef = conn.getVertexPositions();
 
                     // Flip if canonical exists and orientation is different
                     double face_t = bestT;
@@ -669,8 +674,8 @@ GeodesicTracer::GeodesicTraceResult GeodesicTracer::traceFromFace(uint32_t start
                     edgeExit.split = splitCanon;
 
                     // Compute 3D position
-                    glm::dvec3 pA = glm::dvec3(vertsRef[vA].position);
-                    glm::dvec3 pB = glm::dvec3(vertsRef[vB].position);
+                    glm::dvec3 pA = glm::dvec3(positionsRef[vA]);
+                    glm::dvec3 pB = glm::dvec3(positionsRef[vB]);
                     glm::dvec3 pEdge;
                     if (edgeExit.split == 0.0) {
                         pEdge = pA;
@@ -750,9 +755,9 @@ GeodesicTracer::GeodesicTraceResult GeodesicTracer::traceFromFace(uint32_t start
         edgeExit.split = splitCanon;
 
         // compute canonical 3D point
-        const auto& vertsRef = conn.getVertices();
-        glm::dvec3 pA = glm::dvec3(vertsRef[vA].position);
-        glm::dvec3 pB = glm::dvec3(vertsRef[vB].position);
+        const auto& positionsRef = conn.getVertexPositions();
+        glm::dvec3 pA = glm::dvec3(positionsRef[vA]);
+        glm::dvec3 pB = glm::dvec3(positionsRef[vB]);
         glm::dvec3 pEdge;
         if (edgeExit.split == 0.0) {
             pEdge = pA;
@@ -937,8 +942,8 @@ GeodesicTracer::FaceStepResult GeodesicTracer::traceInFace(const SurfacePoint& s
 
         // Map to halfedge index
         const auto& conn = mesh.getConnectivity();
-        auto faceHEs = conn.getFaceHalfEdges(start.elementId);
-        if (bestEdge < (int)faceHEs.size()) {
+        std::array<uint32_t, 3> faceHEs;
+        if (conn.getTriangleHalfEdges(start.elementId, faceHEs) && bestEdge < (int)faceHEs.size()) {
             result.halfEdgeIdx = faceHEs[bestEdge];
         }
         else {
@@ -985,8 +990,9 @@ GeodesicTracer::FaceStepResult GeodesicTracer::traceInFace(const SurfacePoint& s
                         result.edgeParam = t;
 
                         const auto& conn = mesh.getConnectivity();
-                        auto faceHEs = conn.getFaceHalfEdges(start.elementId);
-                        if (result.localEdgeIndex < static_cast<int>(faceHEs.size())) {
+                        std::array<uint32_t, 3> faceHEs;
+                        if (conn.getTriangleHalfEdges(start.elementId, faceHEs) &&
+                            result.localEdgeIndex < static_cast<int>(faceHEs.size())) {
                             result.halfEdgeIdx = faceHEs[result.localEdgeIndex];
                         }
                     }
@@ -1001,16 +1007,16 @@ glm::dvec3 GeodesicTracer::evaluateSurfacePoint(const SurfacePoint& point) const
     const auto& conn = mesh.getConnectivity();
     const auto& halfEs = conn.getHalfEdges();
     const auto& edges = conn.getEdges();
-    const auto& verts = conn.getVertices();
+    const auto& positions = conn.getVertexPositions();
     const auto& faces = conn.getFaces();
 
     switch (point.type) {
     case SurfacePoint::Type::VERTEX: {
         uint32_t vIdx = point.elementId;
-        if (vIdx >= verts.size()) {
+        if (vIdx >= positions.size()) {
             return glm::dvec3(0.0);
         }
-        return glm::dvec3(verts[vIdx].position);
+        return glm::dvec3(positions[vIdx]);
     }
     case SurfacePoint::Type::EDGE: {
         uint32_t eIdx = point.elementId;
@@ -1026,23 +1032,23 @@ glm::dvec3 GeodesicTracer::evaluateSurfacePoint(const SurfacePoint& point) const
             : halfEs[halfEs[he0].next].origin);
         // baryCoords = (1-t, t, 0)
         double t = point.baryCoords.y;
-        return glm::mix(verts[vA].position, verts[vB].position, float(t));
+        return glm::mix(positions[vA], positions[vB], float(t));
     }
     case SurfacePoint::Type::FACE: {
         uint32_t fIdx = point.elementId;
         if (fIdx >= faces.size()) {
             return glm::dvec3(0.0);
         }
-        auto fv = conn.getFaceVertices(fIdx);
-        if (fv.size() != 3) {
+        std::array<uint32_t, 3> fv;
+        if (!conn.getTriangleVertices(fIdx, fv)) {
             return glm::dvec3(0.0);
         }
         double x = point.baryCoords.x;
         double y = point.baryCoords.y;
         double z = point.baryCoords.z;
-        glm::dvec3 P0 = glm::dvec3(verts[fv[0]].position);
-        glm::dvec3 P1 = glm::dvec3(verts[fv[1]].position);
-        glm::dvec3 P2 = glm::dvec3(verts[fv[2]].position);
+        glm::dvec3 P0 = glm::dvec3(positions[fv[0]]);
+        glm::dvec3 P1 = glm::dvec3(positions[fv[1]]);
+        glm::dvec3 P2 = glm::dvec3(positions[fv[2]]);
         return x * P0 + y * P1 + z * P2;
     }
     }
@@ -1233,7 +1239,10 @@ GeodesicTracer::GeodesicTraceResult GeodesicTracer::traceFromEdge(uint32_t start
     }
     
     // Set starting barycentric coordinates on the edge in the target face
-    auto faceHEs = conn.getFaceHalfEdges(targetFace);
+    std::array<uint32_t, 3> faceHEs = { INVALID_INDEX, INVALID_INDEX, INVALID_INDEX };
+    if (!conn.getTriangleHalfEdges(targetFace, faceHEs)) {
+        return result;
+    }
     int edgeOrigin = -1;
     for (int i = 0; i < 3; ++i) {
         if (faceHEs[i] == traceHe) {
@@ -1241,6 +1250,9 @@ GeodesicTracer::GeodesicTraceResult GeodesicTracer::traceFromEdge(uint32_t start
             break;
         }
     }
+    if (edgeOrigin < 0) {
+        return result;
+    }
 
     // Convert edge split to barycentric coordinates
     // tEdge represents how far along the halfedge from origin to target
@@ -26,8 +26,8 @@ void buildFromIndexedMesh(
 	halfEdges.clear();
 
 	vertices.resize(vertexPositions.size());
+	mesh.getVertexPositions() = vertexPositions;
 	for (size_t i = 0; i < vertexPositions.size(); ++i) {
-		vertices[i].position = vertexPositions[i];
 		vertices[i].originalIndex = static_cast<uint32_t>(i);
 		vertices[i].halfEdgeIdx = HalfEdgeMesh::INVALID_INDEX;
 	}
@@ -138,6 +138,10 @@ void buildFromIndexedMesh(
 			}
 		}
 	}
+
+	mesh.getEdgeLengths().assign(edges.size(), 0.0);
+	mesh.getCornerAngles().assign(halfEdges.size(), 0.0);
+	mesh.getSignpostAngles().assign(halfEdges.size(), 0.0);
 }
 
 } // namespace
@@ -145,15 +149,15 @@ void buildFromIndexedMesh(
 void HalfEdgeMesh::buildFromIndexedData(
 	const std::vector<float>& pointPositions,
 	const std::vector<uint32_t>& triangleIndices) {
-	std::vector<glm::vec3> vertexPositions;
-	vertexPositions.reserve(pointPositions.size() / 3);
+	std::vector<glm::vec3> positions;
+	positions.reserve(pointPositions.size() / 3);
 	for (size_t index = 0; index + 2 < pointPositions.size(); index += 3) {
-		vertexPositions.emplace_back(
+		positions.emplace_back(
 			pointPositions[index],
 			pointPositions[index + 1],
 			pointPositions[index + 2]);
 	}
-	buildFromIndexedMesh(*this, vertexPositions, triangleIndices);
+	buildFromIndexedMesh(*this, positions, triangleIndices);
 
 	if (!isManifold()) {
 		std::cerr << "[HalfEdgeMesh] Indexed mesh is not manifold" << std::endl;
@@ -175,7 +179,7 @@ void HalfEdgeMesh::applyToModel(class Model& dstModel) const {
 		const auto& heVertex = vertices[i];
 
 		::Vertex modelVertex;
-		modelVertex.pos = heVertex.position;
+		modelVertex.pos = vertexPositions[i];
 
 		if (heVertex.originalIndex < dstModel.getVertexCount()) {
 			const auto& originalVertex = dstModel.getVertices()[heVertex.originalIndex];
@@ -200,30 +204,24 @@ void HalfEdgeMesh::applyToModel(class Model& dstModel) const {
 		if (face.halfEdgeIdx == INVALID_INDEX)
 			continue;
 
-		std::vector<uint32_t> faceHalfEdges = getFaceHalfEdges(i);
-
-		// Skip degenerate faces
-		if (faceHalfEdges.size() < 3)
+		// Fan-triangulate the face loop; triangles come out unchanged
+		const uint32_t firstHE = face.halfEdgeIdx;
+		if (firstHE >= halfEdges.size())
 			continue;
 
-		if (faceHalfEdges.size() == 3) {
-			for (uint32_t heIdx : faceHalfEdges) {
-				uint32_t vertexIdx = halfEdges[heIdx].origin;
-				newIndices.push_back(vertexIndexMap[vertexIdx]);
-			}
-		}
-		else {
-			// Triangulate for non-triangular faces
-			uint32_t firstVertexIdx = halfEdges[faceHalfEdges[0]].origin;
-
-			for (size_t j = 1; j < faceHalfEdges.size() - 1; ++j) {
-				uint32_t v1Idx = halfEdges[faceHalfEdges[j]].origin;
-				uint32_t v2Idx = halfEdges[faceHalfEdges[j + 1]].origin;
+		const uint32_t firstVertexIdx = halfEdges[firstHE].origin;
+		uint32_t he1 = halfEdges[firstHE].next;
+		int safetyCounter = 0;
+		const int MAX_ITERATIONS = 100;
+		while (he1 < halfEdges.size() && he1 != firstHE) {
+			const uint32_t he2 = halfEdges[he1].next;
+			if (he2 >= halfEdges.size() || he2 == firstHE || ++safetyCounter > MAX_ITERATIONS)
+				break;
 
-				newIndices.push_back(vertexIndexMap[firstVertexIdx]);
-				newIndices.push_back(vertexIndexMap[v1Idx]);
-				newIndices.push_back(vertexIndexMap[v2Idx]);
-			}
+			newIndices.push_back(vertexIndexMap[firstVertexIdx]);
+			newIndices.push_back(vertexIndexMap[halfEdges[he1].origin]);
+			newIndices.push_back(vertexIndexMap[halfEdges[he2].origin]);
+			he1 = he2;
 		}
 	}
 
@@ -233,8 +231,8 @@ void HalfEdgeMesh::applyToModel(class Model& dstModel) const {
 
 void HalfEdgeMesh::initializeIntrinsicLengths() {
 	// Initialize intrinsic lengths
-	for (auto& e : edges) {
-		uint32_t heIdx = e.halfEdgeIdx;
+	for (size_t edgeIdx = 0; edgeIdx < edges.size(); ++edgeIdx) {
+		uint32_t heIdx = edges[edgeIdx].halfEdgeIdx;
 		if (heIdx >= halfEdges.size()) 
 			continue;
 		
@@ -247,13 +245,13 @@ void HalfEdgeMesh::initializeIntrinsicLengths() {
 		if (v1 == INVALID_INDEX) 
 			continue;
 
-		const glm::vec3& p0 = vertices[v0].position;
-		const glm::vec3& p1 = vertices[v1].position;
+		const glm::vec3& p0 = vertexPositions[v0];
+		const glm::vec3& p1 = vertexPositions[v1];
 
 		glm::dvec3 dp0(p0.x, p0.y, p0.z);
 		glm::dvec3 dp1(p1.x, p1.y, p1.z);
 		double length = glm::length(dp1 - dp0);
-		e.intrinsicLength = length;		
+		edgeLengths[edgeIdx] = length;
 	}
 }
 
@@ -342,9 +340,9 @@ HalfEdgeMesh::Triangle2D HalfEdgeMesh::layoutTriangle(uint32_t faceIdx) const {
 		}
 		return result;
 	}
-	result.edgeLengths[0] = edges[e0].intrinsicLength;
-	result.edgeLengths[1] = edges[e1].intrinsicLength;
-	result.edgeLengths[2] = edges[e2].intrinsicLength;
+	result.edgeLengths[0] = edgeLengths[e0];
+	result.edgeLengths[1] = edgeLengths[e1];
+	result.edgeLengths[2] = edgeLengths[e2];
 
 	// Validate
 	const double MIN_LENGTH = 1e-12;
@@ -434,11 +432,11 @@ std::array<glm::dvec2, 4> HalfEdgeMesh::layoutDiamond(uint32_t heIdx) const {
 		edgeVdVb == INVALID_INDEX || edgeVdVb >= edges.size()) {
 		return { glm::dvec2(0), glm::dvec2(0), glm::dvec2(0), glm::dvec2(0) };
 	}
-	double diagLen = edges[edgeDiag].intrinsicLength;		// va-vb
-	double len_vb_vc = edges[edgeVbVc].intrinsicLength;		// vb-vc
-	double len_vc_va = edges[edgeVcVa].intrinsicLength;		// vc-va
-	double len_va_vd = edges[edgeVaVd].intrinsicLength;	// va-vd
-	double len_vd_vb = edges[edgeVdVb].intrinsicLength;	// vd-vb
+	double diagLen = edgeLengths[edgeDiag];		// va-vb
+	double len_vb_vc = edgeLengths[edgeVbVc];		// vb-vc
+	double len_vc_va = edgeLengths[edgeVcVa];		// vc-va
+	double len_va_vd = edgeLengths[edgeVaVd];	// va-vd
+	double len_vd_vb = edgeLengths[edgeVdVb];	// vd-vb
 
 	// Layout: place va at (0,0), vb at (diagLen, 0)
 	glm::dvec2 p1(0.0, 0.0);          // va
@@ -474,7 +472,7 @@ HalfEdgeMesh::VertexRing2D HalfEdgeMesh::buildVertexRing2D(uint32_t vertexIdx) c
 	ring.centerVertexIdx = vertexIdx;
 
 	// Get all outgoing HEs in CCW order
-	auto outgoingHEs = getVertexHalfEdges(vertexIdx);
+	const auto outgoingHEs = vertexHalfEdges(vertexIdx);
 	if (outgoingHEs.empty()) {
 		return ring;
 	}
@@ -505,20 +503,19 @@ HalfEdgeMesh::VertexRing2D HalfEdgeMesh::buildVertexRing2D(uint32_t vertexIdx) c
 	// Lay out neighbors in 2D with center at origin
 	// Place first neighbor on positive x-axis
 	uint32_t firstEdge = ring.edgeIndices[0];
-	double firstLen = edges[firstEdge].intrinsicLength;
+	double firstLen = edgeLengths[firstEdge];
 	ring.neighborPositions2D.push_back(glm::dvec2(firstLen, 0.0));
 
 	// Unfold remaining neighbors using corner angles
+	double cumulativeAngle = 0.0;
+	auto heIt = outgoingHEs.begin();
 	for (size_t i = 1; i < ring.neighborVertexIndices.size(); ++i) {
 		uint32_t edgeIdx = ring.edgeIndices[i];
-		double edgeLen = edges[edgeIdx].intrinsicLength;
+		double edgeLen = edgeLengths[edgeIdx];
 		
-		// Get cumulative angle from first edge
-		double cumulativeAngle = 0.0;
-		for (size_t j = 0; j < i; ++j) {
-			uint32_t heOut = outgoingHEs[j];
-			cumulativeAngle += halfEdges[heOut].cornerAngle;
-		}
+		// Cumulative angle from first edge
+		cumulativeAngle += cornerAngles[*heIt];
+		++heIt;
 		
 		// Position = rotate by cumulative angle
 		glm::dvec2 pos;
@@ -785,13 +782,13 @@ bool HalfEdgeMesh::flipEdge(uint32_t edgeIdx) {
 	double lenCD = newLength;
 
 	// Update corner angles
-	halfEdges[ha1].cornerAngle = lawOfCosinesAngle(lenCD, lenCB, lenBD); // Corner at vc in face fa
-	halfEdges[hb3].cornerAngle = lawOfCosinesAngle(lenBD, lenCD, lenCB); // Corner at vd in face fa
-	halfEdges[ha2].cornerAngle = lawOfCosinesAngle(lenCB, lenBD, lenCD); // Corner at vb in face fa
+	cornerAngles[ha1] = lawOfCosinesAngle(lenCD, lenCB, lenBD); // Corner at vc in face fa
+	cornerAngles[hb3] = lawOfCosinesAngle(lenBD, lenCD, lenCB); // Corner at vd in face fa
+	cornerAngles[ha2] = lawOfCosinesAngle(lenCB, lenBD, lenCD); // Corner at vb in face fa
 
-	halfEdges[hb1].cornerAngle = lawOfCosinesAngle(lenCD, lenDA, lenAC); // Corner at vd in face fb
-	halfEdges[ha3].cornerAngle = lawOfCosinesAngle(lenAC, lenCD, lenDA); // Corner at vc in face fb
-	halfEdges[hb2].cornerAngle = lawOfCosinesAngle(lenDA, lenAC, lenCD); // Corner at va in face fb
+	cornerAngles[hb1] = lawOfCosinesAngle(lenCD, lenDA, lenAC); // Corner at vd in face fb
+	cornerAngles[ha3] = lawOfCosinesAngle(lenAC, lenCD, lenDA); // Corner at vc in face fb
+	cornerAngles[hb2] = lawOfCosinesAngle(lenDA, lenAC, lenCD); // Corner at va in face fb
 
 	// Update face's HEs
 	faces[fa].halfEdgeIdx = ha1;
@@ -835,20 +832,20 @@ bool HalfEdgeMesh::flipEdge(uint32_t edgeIdx) {
 	// The clockwise neighbor to ha1 is hb1.next (ha3)
 	uint32_t ha1Neighbor = halfEdges[hb1].next; 
 	if (ha1Neighbor != INVALID_INDEX) {
-		halfEdges[ha1].signpostAngle = halfEdges[ha1Neighbor].signpostAngle + halfEdges[ha1Neighbor].cornerAngle;
+		signpostAngles[ha1] = signpostAngles[ha1Neighbor] + cornerAngles[ha1Neighbor];
 	}
 
 	// Update signpost angle for hb1
 	// The clockwise neighbor to hb1 is ha1.next (hb3)
 	uint32_t hb1Neighbor = halfEdges[ha1].next;
 	if (hb1Neighbor != INVALID_INDEX) {
-		halfEdges[hb1].signpostAngle = halfEdges[hb1Neighbor].signpostAngle + halfEdges[hb1Neighbor].cornerAngle;
+		signpostAngles[hb1] = signpostAngles[hb1Neighbor] + cornerAngles[hb1Neighbor];
 	}
 
 	// Set flipped edge as non-original
 	edges[edgeIdx].isOriginal = false;
 	// Set the new diagonal length
-	edges[edgeIdx].intrinsicLength = newLength; 
+	edgeLengths[edgeIdx] = newLength; 
 
 	return true;
 }
@@ -881,7 +878,7 @@ bool HalfEdgeMesh::isDelaunayEdge(uint32_t heIdx) const {
 
 	// Intrinsic Delaunay test: the sum of angles opposite the edge should be <= pi.
 	// This matches the GC edge cotan/angle-sum test and avoids unstable incircle determinants on thin diamonds.
-	const double angleSum = halfEdges[oppA].cornerAngle + halfEdges[oppB].cornerAngle;
+	const double angleSum = cornerAngles[oppA] + cornerAngles[oppB];
 	const double EPS = 1e-10;
 	return angleSum <= glm::pi<double>() + EPS;
 }
@@ -977,13 +974,29 @@ int HalfEdgeMesh::makeDelaunayLocal(const std::vector<uint32_t>& seedEdges, std:
 }
 
 uint32_t HalfEdgeMesh::addIntrinsicVertex() {
-	Vertex newVertex;
-	newVertex.position = glm::vec3(0.0f);
-	newVertex.halfEdgeIdx = INVALID_INDEX;
-	newVertex.originalIndex = INVALID_INDEX; 
+	return appendVertex();
+}
 
-	vertices.push_back(newVertex);
-	return static_cast<uint32_t>(vertices.size() - 1);
+uint32_t HalfEdgeMesh::appendVertex() {
+	const uint32_t vertexIdx = static_cast<uint32_t>(vertices.size());
+	vertices.emplace_back();
+	vertexPositions.emplace_back(0.0f);
+	return vertexIdx;
+}
+
+uint32_t HalfEdgeMesh::appendHalfEdges(uint32_t count) {
+	const uint32_t firstIdx = static_cast<uint32_t>(halfEdges.size());
+	halfEdges.resize(halfEdges.size() + count);
+	cornerAngles.resize(halfEdges.size(), 0.0);
+	signpostAngles.resize(halfEdges.size(), 0.0);
+	return firstIdx;
+}
+
+uint32_t HalfEdgeMesh::appendEdge(uint32_t heIdx, double length) {
+	const uint32_t edgeIdx = static_cast<uint32_t>(edges.size());
+	edges.emplace_back(heIdx);
+	edgeLengths.push_back(length);
+	return edgeIdx;
 }
 
 uint32_t HalfEdgeMesh::splitTriangleIntrinsic(uint32_t faceIdx, double r0, double r1, double r2) {
@@ -1014,8 +1027,7 @@ uint32_t HalfEdgeMesh::splitTriangleIntrinsic(uint32_t faceIdx, double r0, doubl
 		return INVALID_INDEX;
 
 	// Allocate 6 new HEs
-	uint32_t baseIdx = static_cast<uint32_t>(halfEdges.size());
-	halfEdges.resize(baseIdx + 6);
+	uint32_t baseIdx = appendHalfEdges(6);
 	uint32_t newHe01 = baseIdx + 0;
 	uint32_t newHe12 = baseIdx + 1;
 	uint32_t newHe20 = baseIdx + 2;
@@ -1086,23 +1098,17 @@ uint32_t HalfEdgeMesh::splitTriangleIntrinsic(uint32_t faceIdx, double r0, doubl
 	halfEdges[newHe21].opposite = newHe20;
 
 	// Create Edge entries
-	uint32_t newEdge0 = edges.size();
-	edges.emplace_back(newHe01);
-	edges[newEdge0].intrinsicLength = r0;
+	uint32_t newEdge0 = appendEdge(newHe01, r0);
 	edges[newEdge0].isOriginal = false;
 	halfEdges[newHe01].edgeIdx = newEdge0;
 	halfEdges[newHe02].edgeIdx = newEdge0;
 
-	uint32_t newEdge1 = edges.size();
-	edges.emplace_back(newHe12);
-	edges[newEdge1].intrinsicLength = r1;
+	uint32_t newEdge1 = appendEdge(newHe12, r1);
 	edges[newEdge1].isOriginal = false;
 	halfEdges[newHe12].edgeIdx = newEdge1;
 	halfEdges[newHe10].edgeIdx = newEdge1;
 
-	uint32_t newEdge2 = edges.size();
-	edges.emplace_back(newHe20);
-	edges[newEdge2].intrinsicLength = r2;
+	uint32_t newEdge2 = appendEdge(newHe20, r2);
 	edges[newEdge2].isOriginal = false;
 	halfEdges[newHe20].edgeIdx = newEdge2;
 	halfEdges[newHe21].edgeIdx = newEdge2;
@@ -1136,15 +1142,12 @@ uint32_t HalfEdgeMesh::insertVertexAlongEdge(uint32_t edgeIdx) {
 	uint32_t vOrigA = halfEdges[heA].origin;
 
 	// Create new vertex
-	uint32_t newV = vertices.size();
-	vertices.emplace_back();
+	uint32_t newV = appendVertex();
 	vertices[newV].halfEdgeIdx = heA;
 
 	// Create new halfedge pair heAnew <-> heBnew
-	uint32_t heAnew = halfEdges.size();
-	halfEdges.emplace_back();
-	uint32_t heBnew = halfEdges.size();
-	halfEdges.emplace_back();
+	uint32_t heAnew = appendHalfEdges(2);
+	uint32_t heBnew = heAnew + 1;
 
 	// Mark opposites
 	halfEdges[heAnew].opposite = heBnew;
@@ -1192,10 +1195,8 @@ uint32_t HalfEdgeMesh::connectVertices(uint32_t heA, uint32_t heB) {
 	uint32_t vB = halfEdges[heB].origin;
 
 	// Create new halfedge pair diagA <-> diagB
-	uint32_t diagA = halfEdges.size();
-	halfEdges.emplace_back();
-	uint32_t diagB = halfEdges.size();
-	halfEdges.emplace_back();
+	uint32_t diagA = appendHalfEdges(2);
+	uint32_t diagB = diagA + 1;
 
 	halfEdges[diagA].opposite = diagB;
 	halfEdges[diagB].opposite = diagA;
@@ -1257,7 +1258,7 @@ HalfEdgeMesh::Split HalfEdgeMesh::splitEdgeTopo(uint32_t edgeIdx, double t) {
 
 	// Store original edge info
 	uint32_t originalHE = edges[edgeIdx].halfEdgeIdx;
-	double originalLength = edges[edgeIdx].intrinsicLength;
+	double originalLength = edgeLengths[edgeIdx];
 	// Split the original edge into a quad on each side
 	uint32_t heFront = insertVertexAlongEdge(edgeIdx);
 
@@ -1293,7 +1294,7 @@ HalfEdgeMesh::Split HalfEdgeMesh::splitEdgeTopo(uint32_t edgeIdx, double t) {
 
 	// Update Edge members
 	edges[edgeIdx].halfEdgeIdx = child1;
-	edges[edgeIdx].intrinsicLength = lengthA;
+	edgeLengths[edgeIdx] = lengthA;
 	halfEdges[child1].edgeIdx = edgeIdx;
 	uint32_t child1Opp = halfEdges[child1].opposite;
 
@@ -1301,9 +1302,7 @@ HalfEdgeMesh::Split HalfEdgeMesh::splitEdgeTopo(uint32_t edgeIdx, double t) {
 		halfEdges[child1Opp].edgeIdx = edgeIdx;
 	}
 
-	uint32_t newEdgeIdx = edges.size();
-	edges.emplace_back(child2);
-	edges[newEdgeIdx].intrinsicLength = lengthB;
+	uint32_t newEdgeIdx = appendEdge(child2, lengthB);
 	halfEdges[child2].edgeIdx = newEdgeIdx;
 	uint32_t child2Opp = halfEdges[child2].opposite;
 
@@ -1317,9 +1316,7 @@ HalfEdgeMesh::Split HalfEdgeMesh::splitEdgeTopo(uint32_t edgeIdx, double t) {
 
 	// Create Edge entries for the diagonals
 	if (diagFront != INVALID_INDEX) {
-		uint32_t diagFrontEdgeIdx = edges.size();
-		edges.emplace_back(diagFront);
-		edges[diagFrontEdgeIdx].intrinsicLength = 0.0;
+		uint32_t diagFrontEdgeIdx = appendEdge(diagFront, 0.0);
 		edges[diagFrontEdgeIdx].isOriginal = false;
 		halfEdges[diagFront].edgeIdx = diagFrontEdgeIdx;
 		uint32_t diagFrontOpp = halfEdges[diagFront].opposite;
@@ -1330,9 +1327,7 @@ HalfEdgeMesh::Split HalfEdgeMesh::splitEdgeTopo(uint32_t edgeIdx, double t) {
 	}
 
 	if (diagBack != INVALID_INDEX) {
-		uint32_t diagBackEdgeIdx = edges.size();
-		edges.emplace_back(diagBack);
-		edges[diagBackEdgeIdx].intrinsicLength = 0.0;
+		uint32_t diagBackEdgeIdx = appendEdge(diagBack, 0.0);
 		edges[diagBackEdgeIdx].isOriginal = false;
 		halfEdges[diagBack].edgeIdx = diagBackEdgeIdx;
 		uint32_t diagBackOpp = halfEdges[diagBack].opposite;
@@ -1384,103 +1379,54 @@ uint32_t HalfEdgeMesh::getNextAroundVertex(uint32_t halfEdgeIdx) const {
 	return opp;
 }
 
-std::vector<uint32_t> HalfEdgeMesh::getVertexHalfEdges(uint32_t vertexIdx) const {
-	std::vector<uint32_t> fan;
+HalfEdgeMesh::Range<HalfEdgeMesh::VertexHalfEdgeIterator> HalfEdgeMesh::vertexHalfEdges(uint32_t vertexIdx) const {
 	if (vertexIdx >= vertices.size()) {
-		return fan;
-	}
-
-	uint32_t startHE = vertices[vertexIdx].halfEdgeIdx;
-	if (startHE == INVALID_INDEX || startHE >= halfEdges.size()) {
-		return fan;
+		return {};
 	}
 
-	if (halfEdges[startHE].origin != vertexIdx) {
-		return fan;
+	const uint32_t startHE = vertices[vertexIdx].halfEdgeIdx;
+	if (startHE == INVALID_INDEX || startHE >= halfEdges.size() || halfEdges[startHE].origin != vertexIdx) {
+		return {};
 	}
 
-	uint32_t he = startHE;
-	const size_t maxSteps = std::max<size_t>(halfEdges.size(), 1);
-	size_t steps = 0;
-	do {
-		fan.push_back(he);
-
-		uint32_t nextHe = getNextAroundVertex(he);
-		if (nextHe == INVALID_INDEX) {
-			break;
-		}
-
-		he = nextHe;
-		if (++steps > maxSteps) {
-			break;
-		}
-	} while (he != startHE);
-
-	return fan;
+	return { VertexHalfEdgeIterator(this, startHE), VertexHalfEdgeIterator() };
 }
 
-std::vector<uint32_t> HalfEdgeMesh::getVertexFaces(uint32_t vertexIdx) const {
-	std::vector<uint32_t> faceIndices;
-	std::set<uint32_t> uniqueFaces; 
-
-	if (vertexIdx >= vertices.size() || vertices[vertexIdx].halfEdgeIdx == INVALID_INDEX)
-		return faceIndices;
-
-	// Get all HEs from this vertex
-	std::vector<uint32_t> vertexHalfEdges = getVertexHalfEdges(vertexIdx);
-
-	// For each HE, get its canonical face
-	for (uint32_t heIdx : vertexHalfEdges) {
-		uint32_t faceIdx = halfEdges[heIdx].face;
-		if (faceIdx != INVALID_INDEX) {
-			uniqueFaces.insert(faceIdx);
-		}
-	}
-
-	// Convert set to vector
-	faceIndices.assign(uniqueFaces.begin(), uniqueFaces.end());
-	return faceIndices;
+HalfEdgeMesh::Range<HalfEdgeMesh::VertexFaceIterator> HalfEdgeMesh::vertexFaces(uint32_t vertexIdx) const {
+	const Range<VertexHalfEdgeIterator> ring = vertexHalfEdges(vertexIdx);
+	return { VertexFaceIterator(this, ring.first), VertexFaceIterator(this, ring.last) };
 }
 
-std::vector<uint32_t> HalfEdgeMesh::getFaceHalfEdges(uint32_t faceIdx) const {
-	std::vector<uint32_t> edgeIndices;
-
-	if (faceIdx >= faces.size() || faces[faceIdx].halfEdgeIdx == INVALID_INDEX)
-		return edgeIndices;
-
-	uint32_t startIdx = faces[faceIdx].halfEdgeIdx;
-	uint32_t currentIdx = startIdx;
-	int safetyCounter = 0;
-	const int MAX_ITERATIONS = 100;
-
-	do {
-		if (currentIdx == INVALID_INDEX || currentIdx >= halfEdges.size()) {
-			break;
-		}
-
-		edgeIndices.push_back(currentIdx);
-		currentIdx = halfEdges[currentIdx].next;
+bool HalfEdgeMesh::getTriangleHalfEdges(uint32_t faceIdx, std::array<uint32_t, 3>& outHalfEdges) const {
+	if (faceIdx >= faces.size()) {
+		return false;
+	}
 
-		if (++safetyCounter > MAX_ITERATIONS) {
-			break;
-		}
-	} while (currentIdx != startIdx);
+	const uint32_t he0 = faces[faceIdx].halfEdgeIdx;
+	if (he0 >= halfEdges.size()) {
+		return false;
+	}
+	const uint32_t he1 = halfEdges[he0].next;
+	if (he1 >= halfEdges.size()) {
+		return false;
+	}
+	const uint32_t he2 = halfEdges[he1].next;
+	if (he2 >= halfEdges.size() || halfEdges[he2].next != he0) {
+		return false;
+	}
 
-	return edgeIndices;
+	outHalfEdges = { he0, he1, he2 };
+	return true;
 }
 
-std::vector<uint32_t> HalfEdgeMesh::getFaceVertices(uint32_t faceIdx) const {
-	std::vector<uint32_t> vertexIndices;
-	auto faceHalfEdges = getFaceHalfEdges(faceIdx);
-	vertexIndices.reserve(faceHalfEdges.size());
-	for (uint32_t heIdx : faceHalfEdges) {
-		if (heIdx >= halfEdges.size()) {
-			break;
-		}
-		vertexIndices.push_back(halfEdges[heIdx].origin);
+bool HalfEdgeMesh::getTriangleVertices(uint32_t faceIdx, std::array<uint32_t, 3>& outVertices) const {
+	std::array<uint32_t, 3> faceHEs;
+	if (!getTriangleHalfEdges(faceIdx, faceHEs)) {
+		return false;
 	}
 
-	return vertexIndices;
+	outVertices = { halfEdges[faceHEs[0]].origin, halfEdges[faceHEs[1]].origin, halfEdges[faceHEs[2]].origin };
+	return true;
 }
 
 std::pair<uint32_t, uint32_t> HalfEdgeMesh::getEdgeVertices(uint32_t edgeIdx) const {
@@ -1524,7 +1470,7 @@ double HalfEdgeMesh::getIntrinsicLengthFromHalfEdge(uint32_t halfEdgeIdx) const
 	if (edgeIdx == INVALID_INDEX || edgeIdx >= edges.size()) {
 		return 0.0;
 	}
-	return edges[edgeIdx].intrinsicLength;
+	return edgeLengths[edgeIdx];
 }
 
 bool HalfEdgeMesh::isBoundaryVertex(uint32_t vertexIdx) const {
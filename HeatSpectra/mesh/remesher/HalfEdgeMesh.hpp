@@ -4,6 +4,7 @@
 #include <glm/glm.hpp>
 #include <unordered_map>
 #include <functional>
+#include <iterator>
 
 class HalfEdgeMesh {
 public:
@@ -11,15 +12,16 @@ public:
 
 	struct HalfEdge;
 
+	// Element records hold connectivity only. Positions, lengths and angles live in
+	// parallel streams (getVertexPositions, getEdgeLengths, getCornerAngles,
+	// getSignpostAngles) so traversals do not pull geometry into cache.
 	struct Vertex {
-		glm::vec3 position		= glm::vec3(0.0f);
 		uint32_t halfEdgeIdx	= INVALID_INDEX;
 		uint32_t originalIndex	= INVALID_INDEX;
 	};
 
 	struct Edge {
 		uint32_t halfEdgeIdx	= INVALID_INDEX;
-		double intrinsicLength	= 0.0;
 		bool isOriginal			= true;
 
 		Edge() = default;
@@ -37,10 +39,6 @@ public:
 		uint32_t opposite		= INVALID_INDEX;
 		uint32_t face			= INVALID_INDEX;
 		uint32_t edgeIdx		= INVALID_INDEX;	
-
-		double cornerAngle		= 0.0;
-		double signpostAngle	= 0.0;    
-		bool isFeature			= false;
 	};
 
 	struct Split {
@@ -100,10 +98,98 @@ public:
 	uint32_t connectVertices(uint32_t heA, uint32_t heB);
 	Split splitEdgeTopo(uint32_t edgeIdx, double t);
 
-	std::vector<uint32_t> getVertexHalfEdges(uint32_t vertexIdx) const;
-	std::vector<uint32_t> getVertexFaces(uint32_t vertexIdx) const;
-	std::vector<uint32_t> getFaceHalfEdges(uint32_t faceIdx) const;
-	std::vector<uint32_t> getFaceVertices(uint32_t faceIdx) const;
+	// Outgoing half-edges of a vertex in CCW order; stops at a boundary
+	class VertexHalfEdgeIterator {
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = uint32_t;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const uint32_t*;
+		using reference = uint32_t;
+
+		VertexHalfEdgeIterator() = default;
+		VertexHalfEdgeIterator(const HalfEdgeMesh* mesh, uint32_t startHE)
+			: mesh(mesh), startHE(startHE), current(startHE) {}
+
+		uint32_t operator*() const { return current; }
+		VertexHalfEdgeIterator& operator++() {
+			const uint32_t nextHE = mesh->getNextAroundVertex(current);
+			if (nextHE == INVALID_INDEX || nextHE == startHE || ++steps > mesh->halfEdges.size()) {
+				current = INVALID_INDEX;
+			}
+			else {
+				current = nextHE;
+			}
+			return *this;
+		}
+		VertexHalfEdgeIterator operator++(int) { VertexHalfEdgeIterator copy = *this; ++*this; return copy; }
+		bool operator==(const VertexHalfEdgeIterator& other) const { return current == other.current; }
+		bool operator!=(const VertexHalfEdgeIterator& other) const { return current != other.current; }
+
+	private:
+		const HalfEdgeMesh* mesh = nullptr;
+		uint32_t startHE = INVALID_INDEX;
+		uint32_t current = INVALID_INDEX;
+		size_t steps = 0;
+	};
+
+	// Faces around a vertex in CCW order, each reported once even when several of its corners are the vertex
+	class VertexFaceIterator {
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = uint32_t;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const uint32_t*;
+		using reference = uint32_t;
+
+		VertexFaceIterator() = default;
+		VertexFaceIterator(const HalfEdgeMesh* mesh, VertexHalfEdgeIterator heIt)
+			: mesh(mesh), heIt(heIt) { skipRepeated(); }
+
+		uint32_t operator*() const { return mesh->halfEdges[*heIt].face; }
+		VertexFaceIterator& operator++() { ++heIt; skipRepeated(); return *this; }
+		VertexFaceIterator operator++(int) { VertexFaceIterator copy = *this; ++*this; return copy; }
+		bool operator==(const VertexFaceIterator& other) const { return heIt == other.heIt; }
+		bool operator!=(const VertexFaceIterator& other) const { return heIt != other.heIt; }
+
+	private:
+		// Keeps only the lowest-indexed corner of each face at this vertex
+		void skipRepeated() {
+			for (; *heIt != INVALID_INDEX; ++heIt) {
+				const HalfEdge& he = mesh->halfEdges[*heIt];
+				if (he.face == INVALID_INDEX) {
+					continue;
+				}
+				const uint32_t next = he.next;
+				const uint32_t prev = he.prev;
+				const bool repeated =
+					(next < *heIt && mesh->halfEdges[next].origin == he.origin) ||
+					(prev < *heIt && prev != INVALID_INDEX && mesh->halfEdges[prev].origin == he.origin);
+				if (!repeated) {
+					break;
+				}
+			}
+		}
+
+		const HalfEdgeMesh* mesh = nullptr;
+		VertexHalfEdgeIterator heIt;
+	};
+
+	template <typename Iterator>
+	struct Range {
+		Iterator first;
+		Iterator last;
+		Iterator begin() const { return first; }
+		Iterator end() const { return last; }
+		bool empty() const { return first == last; }
+	};
+
+	// Allocation-free traversal. The ranges are invalidated by any topology change.
+	Range<VertexHalfEdgeIterator> vertexHalfEdges(uint32_t vertexIdx) const;
+	Range<VertexFaceIterator> vertexFaces(uint32_t vertexIdx) const;
+	// False unless the face is a valid triangle
+	bool getTriangleHalfEdges(uint32_t faceIdx, std::array<uint32_t, 3>& outHalfEdges) const;
+	bool getTriangleVertices(uint32_t faceIdx, std::array<uint32_t, 3>& outVertices) const;
 	std::pair<uint32_t, uint32_t> getEdgeVertices(uint32_t edgeIdx) const;
 	uint32_t getEdgeFromHalfEdge(uint32_t heIdx) const;
 	double getIntrinsicLengthFromHalfEdge(uint32_t halfEdgeIdx) const;
@@ -139,12 +225,46 @@ public:
 	std::vector<Face>& getFaces() {
 		return faces;
 	}
+	const std::vector<glm::vec3>& getVertexPositions() const {
+		return vertexPositions;
+	}
+	std::vector<glm::vec3>& getVertexPositions() {
+		return vertexPositions;
+	}
+	const std::vector<double>& getEdgeLengths() const {
+		return edgeLengths;
+	}
+	std::vector<double>& getEdgeLengths() {
+		return edgeLengths;
+	}
+	const std::vector<double>& getCornerAngles() const {
+		return cornerAngles;
+	}
+	std::vector<double>& getCornerAngles() {
+		return cornerAngles;
+	}
+	const std::vector<double>& getSignpostAngles() const {
+		return signpostAngles;
+	}
+	std::vector<double>& getSignpostAngles() {
+		return signpostAngles;
+	}
 	
 private:
 	double lawOfCosinesAngle(double a, double b, double opposite) const;
 
+	// Grow an element array together with its streams; return the first new index
+	uint32_t appendVertex();
+	uint32_t appendHalfEdges(uint32_t count);
+	uint32_t appendEdge(uint32_t heIdx, double length);
+
 	std::vector<HalfEdge> halfEdges;
 	std::vector<Vertex> vertices;
 	std::vector<Edge> edges;
 	std::vector<Face> faces;
+
+	std::vector<glm::vec3> vertexPositions;
+	std::vector<double> edgeLengths;
+	std::vector<double> cornerAngles;
+	std::vector<double> signpostAngles;
 };
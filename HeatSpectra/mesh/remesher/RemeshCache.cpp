@@ -0,0 +1,372 @@
+#include "RemeshCache.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <type_traits>
+
+namespace {
+
+enum SectionId : uint32_t {
+    SECTION_SOURCE_POSITIONS,
+    SECTION_SOURCE_INDICES,
+    SECTION_VERTICES,
+    SECTION_INDICES,
+    SECTION_FACE_IDS,
+    SECTION_TRIANGLES,
+    SECTION_SUPPORTING_HALFEDGES,
+    SECTION_SUPPORTING_ANGLES,
+    SECTION_INTRINSIC_HALFEDGES,
+    SECTION_INTRINSIC_EDGES,
+    SECTION_INTRINSIC_TRIANGLES,
+    SECTION_INTRINSIC_LENGTHS,
+    SECTION_INPUT_HALFEDGES,
+    SECTION_INPUT_EDGES,
+    SECTION_INPUT_TRIANGLES,
+    SECTION_INPUT_LENGTHS,
+    SECTION_COUNT
+};
+
+struct FileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t key;
+    int32_t iterations;
+    float minAngleDegrees;
+    float maxEdgeLength;
+    float stepSize;
+    uint32_t sectionCount;
+    uint32_t algorithmVersion;
+};
+
+struct SectionEntry {
+    uint64_t offset;
+    uint64_t byteSize;
+    uint32_t elementSize;
+    uint32_t reserved;
+};
+
+struct SectionSource {
+    const void* data;
+    uint64_t byteSize;
+    uint32_t elementSize;
+};
+
+template <typename T>
+void setSection(SectionSource* sources, SectionId id, const std::vector<T>& values) {
+    static_assert(std::is_trivially_copyable_v<T>, "Cache sections must be trivially copyable");
+    sources[id] = SectionSource{ values.data(), static_cast<uint64_t>(values.size() * sizeof(T)), static_cast<uint32_t>(sizeof(T)) };
+}
+
+template <typename T>
+bool readSection(const std::vector<char>& file, const SectionEntry& entry, std::vector<T>& outValues) {
+    static_assert(std::is_trivially_copyable_v<T>, "Cache sections must be trivially copyable");
+    if (entry.elementSize != sizeof(T) || entry.byteSize % sizeof(T) != 0 ||
+        entry.offset > file.size() || entry.byteSize > file.size() - entry.offset) {
+        return false;
+    }
+
+    outValues.resize(static_cast<size_t>(entry.byteSize / sizeof(T)));
+    if (entry.byteSize > 0) {
+        std::memcpy(outValues.data(), file.data() + entry.offset, static_cast<size_t>(entry.byteSize));
+    }
+    return true;
+}
+
+template <typename T>
+bool sectionMatches(const std::vector<char>& file, const SectionEntry& entry, const std::vector<T>& values) {
+    if (entry.elementSize != sizeof(T) || entry.byteSize != values.size() * sizeof(T) ||
+        entry.offset > file.size() || entry.byteSize > file.size() - entry.offset) {
+        return false;
+    }
+    return entry.byteSize == 0 || std::memcmp(file.data() + entry.offset, values.data(), static_cast<size_t>(entry.byteSize)) == 0;
+}
+
+std::string readEnvironment(const char* name) {
+#ifdef _MSC_VER
+    char* value = nullptr;
+    size_t length = 0;
+    if (_dupenv_s(&value, &length, name) != 0 || !value) {
+        return {};
+    }
+    std::string result(value);
+    std::free(value);
+    return result;
+#else
+    const char* value = std::getenv(name);
+    return value ? std::string(value) : std::string();
+#endif
+}
+
+bool readWholeFile(const std::string& path, std::vector<char>& outBuffer) {
+    std::ifstream file(path, std::ios::ate | std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    const std::streamoff fileSize = file.tellg();
+    if (fileSize <= 0) {
+        return false;
+    }
+
+    outBuffer.resize(static_cast<size_t>(fileSize));
+    file.seekg(0);
+    file.read(outBuffer.data(), static_cast<std::streamsize>(fileSize));
+    return static_cast<bool>(file);
+}
+
+}
+
+bool RemeshCache::load(
+    uint64_t key,
+    const std::vector<float>& pointPositions,
+    const std::vector<uint32_t>& triangleIndices,
+    const Params& params,
+    RemeshGeometry& outGeometry) const {
+    outGeometry = {};
+    if (!isEnabled()) {
+        return false;
+    }
+
+    std::vector<char> file;
+    if (!readWholeFile(buildPath(key), file)) {
+        return false;
+    }
+
+    const size_t tableEnd = sizeof(FileHeader) + sizeof(SectionEntry) * SECTION_COUNT;
+    if (file.size() < tableEnd) {
+        return false;
+    }
+
+    FileHeader header{};
+    std::memcpy(&header, file.data(), sizeof(FileHeader));
+    if (header.magic != FILE_MAGIC ||
+        header.version != FILE_VERSION ||
+        header.algorithmVersion != ALGORITHM_VERSION ||
+        header.key != key ||
+        header.sectionCount != SECTION_COUNT) {
+        return false;
+    }
+    if (header.iterations != params.iterations ||
+        header.minAngleDegrees != params.minAngleDegrees ||
+        header.maxEdgeLength != params.maxEdgeLength ||
+        header.stepSize != params.stepSize) {
+        return false;
+    }
+
+    SectionEntry sections[SECTION_COUNT];
+    std::memcpy(sections, file.data() + sizeof(FileHeader), sizeof(sections));
+
+    if (!sectionMatches(file, sections[SECTION_SOURCE_POSITIONS], pointPositions) ||
+        !sectionMatches(file, sections[SECTION_SOURCE_INDICES], triangleIndices)) {
+        return false;
+    }
+
+    SupportingHalfedge::IntrinsicMesh& mesh = outGeometry.intrinsicMesh;
+    SupportingHalfedge::GPUBuffers& buffers = outGeometry.gpuBuffers;
+    const bool valid =
+        readSection(file, sections[SECTION_VERTICES], mesh.vertices) &&
+        readSection(file, sections[SECTION_INDICES], mesh.indices) &&
+        readSection(file, sections[SECTION_FACE_IDS], mesh.faceIds) &&
+        readSection(file, sections[SECTION_TRIANGLES], mesh.triangles) &&
+        readSection(file, sections[SECTION_SUPPORTING_HALFEDGES], buffers.supportingHalfedges) &&
+        readSection(file, sections[SECTION_SUPPORTING_ANGLES], buffers.supportingAngles) &&
+        readSection(file, sections[SECTION_INTRINSIC_HALFEDGES], buffers.intrinsicHalfedgeData) &&
+        readSection(file, sections[SECTION_INTRINSIC_EDGES], buffers.intrinsicEdgeData) &&
+        readSection(file, sections[SECTION_INTRINSIC_TRIANGLES], buffers.intrinsicTriangleData) &&
+        readSection(file, sections[SECTION_INTRINSIC_LENGTHS], buffers.intrinsicLengths) &&
+        readSection(file, sections[SECTION_INPUT_HALFEDGES], buffers.inputHalfedgeData) &&
+        readSection(file, sections[SECTION_INPUT_EDGES], buffers.inputEdgeData) &&
+        readSection(file, sections[SECTION_INPUT_TRIANGLES], buffers.inputTriangleData) &&
+        readSection(file, sections[SECTION_INPUT_LENGTHS], buffers.inputLengths);
+    if (!valid || mesh.vertices.empty() || mesh.indices.empty()) {
+        std::cerr << "[RemeshCache] Ignoring malformed cache entry " << buildPath(key) << std::endl;
+        outGeometry = {};
+        return false;
+    }
+
+    // Mark the entry as recently used for eviction
+    std::error_code error;
+    std::filesystem::last_write_time(buildPath(key), std::filesystem::file_time_type::clock::now(), error);
+    return true;
+}
+
+bool RemeshCache::store(
+    uint64_t key,
+    const std::vector<float>& pointPositions,
+    const std::vector<uint32_t>& triangleIndices,
+    const Params& params,
+    const RemeshGeometry& geometry) const {
+    if (!isEnabled()) {
+        return false;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error) {
+        std::cerr << "[RemeshCache] Failed to create cache directory " << directory << ": " << error.message() << std::endl;
+        return false;
+    }
+
+    SectionSource sources[SECTION_COUNT]{};
+    const SupportingHalfedge::IntrinsicMesh& mesh = geometry.intrinsicMesh;
+    const SupportingHalfedge::GPUBuffers& buffers = geometry.gpuBuffers;
+    setSection(sources, SECTION_SOURCE_POSITIONS, pointPositions);
+    setSection(sources, SECTION_SOURCE_INDICES, triangleIndices);
+    setSection(sources, SECTION_VERTICES, mesh.vertices);
+    setSection(sources, SECTION_INDICES, mesh.indices);
+    setSection(sources, SECTION_FACE_IDS, mesh.faceIds);
+    setSection(sources, SECTION_TRIANGLES, mesh.triangles);
+    setSection(sources, SECTION_SUPPORTING_HALFEDGES, buffers.supportingHalfedges);
+    setSection(sources, SECTION_SUPPORTING_ANGLES, buffers.supportingAngles);
+    setSection(sources, SECTION_INTRINSIC_HALFEDGES, buffers.intrinsicHalfedgeData);
+    setSection(sources, SECTION_INTRINSIC_EDGES, buffers.intrinsicEdgeData);
+    setSection(sources, SECTION_INTRINSIC_TRIANGLES, buffers.intrinsicTriangleData);
+    setSection(sources, SECTION_INTRINSIC_LENGTHS, buffers.intrinsicLengths);
+    setSection(sources, SECTION_INPUT_HALFEDGES, buffers.inputHalfedgeData);
+    setSection(sources, SECTION_INPUT_EDGES, buffers.inputEdgeData);
+    setSection(sources, SECTION_INPUT_TRIANGLES, buffers.inputTriangleData);
+    setSection(sources, SECTION_INPUT_LENGTHS, buffers.inputLengths);
+
+    FileHeader header{};
+    header.magic = FILE_MAGIC;
+    header.version = FILE_VERSION;
+    header.key = key;
+    header.iterations = params.iterations;
+    header.minAngleDegrees = params.minAngleDegrees;
+    header.maxEdgeLength = params.maxEdgeLength;
+    header.stepSize = params.stepSize;
+    header.sectionCount = SECTION_COUNT;
+    header.algorithmVersion = ALGORITHM_VERSION;
+
+    SectionEntry sections[SECTION_COUNT]{};
+    uint64_t offset = sizeof(FileHeader) + sizeof(sections);
+    for (uint32_t id = 0; id < SECTION_COUNT; ++id) {
+        offset = (offset + SECTION_ALIGNMENT - 1) & ~(SECTION_ALIGNMENT - 1);
+        sections[id].offset = offset;
+        sections[id].byteSize = sources[id].byteSize;
+        sections[id].elementSize = sources[id].elementSize;
+        offset += sources[id].byteSize;
+    }
+
+    // Write under a per-thread name and rename, so readers never see a partial file
+    const std::string path = buildPath(key);
+    std::ostringstream tempPath;
+    tempPath << path << ".tmp" << std::hash<std::thread::id>{}(std::this_thread::get_id());
+    {
+        std::ofstream file(tempPath.str(), std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            std::cerr << "[RemeshCache] Failed to open " << tempPath.str() << " for writing" << std::endl;
+            return false;
+        }
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(sections), sizeof(sections));
+        uint64_t written = sizeof(header) + sizeof(sections);
+        const char padding[SECTION_ALIGNMENT] = {};
+        for (uint32_t id = 0; id < SECTION_COUNT; ++id) {
+            file.write(padding, static_cast<std::streamsize>(sections[id].offset - written));
+            if (sources[id].byteSize > 0) {
+                file.write(static_cast<const char*>(sources[id].data), static_cast<std::streamsize>(sources[id].byteSize));
+            }
+            written = sections[id].offset + sources[id].byteSize;
+        }
+
+        if (!file) {
+            std::cerr << "[RemeshCache] Failed to write " << tempPath.str() << std::endl;
+            file.close();
+            std::filesystem::remove(tempPath.str(), error);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tempPath.str(), path, error);
+    if (error) {
+        std::cerr << "[RemeshCache] Failed to publish " << path << ": " << error.message() << std::endl;
+        std::filesystem::remove(tempPath.str(), error);
+        return false;
+    }
+
+    evictToBudget(path);
+    return true;
+}
+
+std::string RemeshCache::defaultDirectory() {
+#ifdef _WIN32
+    const std::string localAppData = readEnvironment("LOCALAPPDATA");
+    if (!localAppData.empty()) {
+        return (std::filesystem::path(localAppData) / "HeatSpectra" / "cache" / "remesh").string();
+    }
+#else
+    const std::string cacheHome = readEnvironment("XDG_CACHE_HOME");
+    if (!cacheHome.empty()) {
+        return (std::filesystem::path(cacheHome) / "HeatSpectra" / "remesh").string();
+    }
+    const std::string home = readEnvironment("HOME");
+    if (!home.empty()) {
+        return (std::filesystem::path(home) / ".cache" / "HeatSpectra" / "remesh").string();
+    }
+#endif
+    std::cerr << "[RemeshCache] No user cache directory found, remesh cache disabled" << std::endl;
+    return {};
+}
+
+void RemeshCache::evictToBudget(const std::string& keepPath) const {
+    struct Entry {
+        std::filesystem::path path;
+        uint64_t byteSize;
+        std::filesystem::file_time_type lastUsed;
+    };
+
+    std::error_code error;
+    std::vector<Entry> entries;
+    uint64_t totalBytes = 0;
+    for (std::filesystem::directory_iterator it(directory, error), end; !error && it != end; it.increment(error)) {
+        if (it->path().extension() != ".remesh") {
+            continue;
+        }
+        std::error_code entryError;
+        const uint64_t byteSize = it->file_size(entryError);
+        const std::filesystem::file_time_type lastUsed = it->last_write_time(entryError);
+        if (entryError) {
+            continue;
+        }
+        entries.push_back({ it->path(), byteSize, lastUsed });
+        totalBytes += byteSize;
+    }
+    if (totalBytes <= maxBytes) {
+        return;
+    }
+
+    // Other workers may evict concurrently; files already gone are skipped
+    std::sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs) {
+        return lhs.lastUsed < rhs.lastUsed;
+    });
+    const std::filesystem::path keep(keepPath);
+    for (const Entry& entry : entries) {
+        if (totalBytes <= maxBytes) {
+            break;
+        }
+        if (entry.path == keep) {
+            continue;
+        }
+        if (std::filesystem::remove(entry.path, error)) {
+            totalBytes -= entry.byteSize;
+        }
+    }
+}
+
+std::string RemeshCache::buildPath(uint64_t key) const {
+    std::ostringstream name;
+    name << std::hex;
+    name.width(16);
+    name.fill('0');
+    name << key;
+    return (std::filesystem::path(directory) / (name.str() + ".remesh")).string();
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "mesh/remesher/Remesher.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Content-addressed store of remesh results, one file per key. Files hold a fixed
+// header, a section table and 16-byte aligned raw arrays, so every section can be
+// used in place once the file is in memory. The source geometry and iODT params are
+// stored alongside and compared on load, so a key collision reads as a miss.
+// Loads refresh a file's modification time and stores evict the least recently
+// used files once the directory exceeds its byte budget.
+class RemeshCache {
+public:
+    static constexpr uint64_t DEFAULT_MAX_BYTES = 2ull * 1024 * 1024 * 1024;
+    // Raise whenever iODT or the remesher produces different output for the same
+    // input. It is part of the cache key and the file header, so files written by
+    // an older remesher read as misses instead of being served stale.
+    static constexpr uint32_t ALGORITHM_VERSION = 1;
+
+    struct Params {
+        int iterations = 1;
+        float minAngleDegrees = 20.0f;
+        float maxEdgeLength = 0.1f;
+        float stepSize = 0.25f;
+    };
+
+    void setDirectory(const std::string& updatedDirectory) { directory = updatedDirectory; }
+    const std::string& getDirectory() const { return directory; }
+    bool isEnabled() const { return !directory.empty(); }
+    void setMaxBytes(uint64_t updatedMaxBytes) { maxBytes = updatedMaxBytes; }
+    uint64_t getMaxBytes() const { return maxBytes; }
+
+    // Per-user cache location: %LOCALAPPDATA%/HeatSpectra/cache/remesh on Windows,
+    // $XDG_CACHE_HOME/HeatSpectra/remesh or ~/.cache/HeatSpectra/remesh elsewhere.
+    // Empty, which disables the cache, when none of those is set.
+    static std::string defaultDirectory();
+
+    bool load(
+        uint64_t key,
+        const std::vector<float>& pointPositions,
+        const std::vector<uint32_t>& triangleIndices,
+        const Params& params,
+        RemeshGeometry& outGeometry) const;
+    bool store(
+        uint64_t key,
+        const std::vector<float>& pointPositions,
+        const std::vector<uint32_t>& triangleIndices,
+        const Params& params,
+        const RemeshGeometry& geometry) const;
+
+private:
+    static constexpr uint32_t FILE_MAGIC = 0x43524853u; // "SHRC"
+    static constexpr uint32_t FILE_VERSION = 1;
+    static constexpr uint64_t SECTION_ALIGNMENT = 16;
+
+    std::string buildPath(uint64_t key) const;
+    void evictToBudget(const std::string& keepPath) const;
+
+    std::string directory;
+    uint64_t maxBytes = DEFAULT_MAX_BYTES;
+};
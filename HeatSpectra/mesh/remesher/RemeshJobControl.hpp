@@ -0,0 +1,18 @@
+#pragma once
+
+#include <atomic>
+
+// Shared between a remesh running on a worker and its owner. The remesher polls
+// cancelRequested between phases and iterations and reports progress in [0, 1].
+struct RemeshJobControl {
+    std::atomic<bool> cancelRequested{false};
+    std::atomic<float> progress{0.0f};
+
+    bool isCancelled() const {
+        return cancelRequested.load(std::memory_order_relaxed);
+    }
+
+    void reportProgress(float value) {
+        progress.store(value, std::memory_order_relaxed);
+    }
+};
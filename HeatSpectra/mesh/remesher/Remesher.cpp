@@ -14,10 +14,8 @@ Remesher::Remesher(VulkanDevice& vulkanDevice, MemoryAllocator& memoryAllocator)
 }
 
 SupportingHalfedge::GPUResources Remesher::buildIntrinsicGPUResources(
-    const SupportingHalfedge& supportingHalfedge,
+    const SupportingHalfedge::GPUBuffers& gpuBuffers,
     const SupportingHalfedge::IntrinsicMesh& intrinsicMesh) const {
-    const SupportingHalfedge::GPUBuffers gpuBuffers = supportingHalfedge.buildGPUBuffers();
-
     SupportingHalfedge::GPUResources resources{};
     resources.triangleCount = intrinsicMesh.triangles.size();
     resources.vertexCount = intrinsicMesh.vertices.size();
@@ -140,17 +138,48 @@ bool Remesher::remesh(
     double stepSize,
     RemeshResult& outResult) const {
     outResult = {};
+
+    RemeshGeometry geometry{};
+    if (!remeshGeometry(
+            pointPositions,
+            triangleIndices,
+            iterations,
+            minAngleDegrees,
+            maxEdgeLength,
+            stepSize,
+            nullptr,
+            geometry)) {
+        return false;
+    }
+
+    return uploadGeometry(geometry, outResult);
+}
+
+bool Remesher::remeshGeometry(
+    const std::vector<float>& pointPositions,
+    const std::vector<uint32_t>& triangleIndices,
+    int iterations,
+    double minAngleDegrees,
+    double maxEdgeLength,
+    double stepSize,
+    RemeshJobControl* jobControl,
+    RemeshGeometry& outGeometry) {
+    outGeometry = {};
     if (pointPositions.empty() || triangleIndices.empty()) {
         std::cerr << "[Remesher] Cannot remesh empty geometry input" << std::endl;
         return false;
     }
 
     iODT remesher(pointPositions, triangleIndices);
+    remesher.setJobControl(jobControl);
     const bool success = remesher.optimalDelaunayTriangulation(
         iterations,
         minAngleDegrees,
         maxEdgeLength,
         stepSize);
+    if (jobControl && jobControl->isCancelled()) {
+        return false;
+    }
     if (!success) {
         std::cerr << "[Remesher] Payload remeshing failed" << std::endl;
         return false;
@@ -162,15 +191,25 @@ bool Remesher::remesh(
         return false;
     }
 
-    const SupportingHalfedge::IntrinsicMesh intrinsicMesh = supportingHalfedge->buildIntrinsicMesh();
-    if (intrinsicMesh.vertices.empty() || intrinsicMesh.indices.empty()) {
+    outGeometry.intrinsicMesh = supportingHalfedge->buildIntrinsicMesh();
+    if (outGeometry.intrinsicMesh.vertices.empty() || outGeometry.intrinsicMesh.indices.empty()) {
         std::cerr << "[Remesher] Intrinsic mesh output was empty" << std::endl;
+        outGeometry = {};
         return false;
     }
 
-    outResult.intrinsicMesh = intrinsicMesh;
-    outResult.intrinsicGpuResources = buildIntrinsicGPUResources(*supportingHalfedge, outResult.intrinsicMesh);
+    outGeometry.gpuBuffers = supportingHalfedge->buildGPUBuffers();
     remesher.cleanup();
+    if (jobControl) {
+        jobControl->reportProgress(0.95f);
+    }
+    return true;
+}
+
+bool Remesher::uploadGeometry(const RemeshGeometry& geometry, RemeshResult& outResult) const {
+    outResult = {};
+    outResult.intrinsicMesh = geometry.intrinsicMesh;
+    outResult.intrinsicGpuResources = buildIntrinsicGPUResources(geometry.gpuBuffers, outResult.intrinsicMesh);
     return true;
 }
 
@@ -216,7 +255,7 @@ void Remesher::cleanupGpuResources(SupportingHalfedge::GPUResources& resources)
     resources = {};
 }
 
-float Remesher::computeAverageTriangleArea(const SupportingHalfedge::IntrinsicMesh& intrinsicMesh) const {
+float Remesher::computeAverageTriangleArea(const SupportingHalfedge::IntrinsicMesh& intrinsicMesh) {
     if (intrinsicMesh.triangles.empty()) {
         return 0.0f;
     }
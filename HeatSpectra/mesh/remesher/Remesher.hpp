@@ -1,5 +1,6 @@
 #pragma once
 
+#include "mesh/remesher/RemeshJobControl.hpp"
 #include "mesh/remesher/SupportingHalfedge.hpp"
 
 #include <vector>
@@ -7,6 +8,12 @@
 class VulkanDevice;
 class MemoryAllocator;
 
+// CPU-side remesh output, ready to be uploaded on the thread that owns the device
+struct RemeshGeometry {
+    SupportingHalfedge::IntrinsicMesh intrinsicMesh;
+    SupportingHalfedge::GPUBuffers gpuBuffers;
+};
+
 struct RemeshResult {
     SupportingHalfedge::IntrinsicMesh intrinsicMesh;
     SupportingHalfedge::GPUResources intrinsicGpuResources;
@@ -24,13 +31,26 @@ public:
         double maxEdgeLength,
         double stepSize,
         RemeshResult& outResult) const;
+
+    // Touches no Vulkan state, so it may run on a worker thread. Returns false on
+    // failure or when jobControl was cancelled.
+    static bool remeshGeometry(
+        const std::vector<float>& pointPositions,
+        const std::vector<uint32_t>& triangleIndices,
+        int iterations,
+        double minAngleDegrees,
+        double maxEdgeLength,
+        double stepSize,
+        RemeshJobControl* jobControl,
+        RemeshGeometry& outGeometry);
+    bool uploadGeometry(const RemeshGeometry& geometry, RemeshResult& outResult) const;
     void cleanupGpuResources(SupportingHalfedge::GPUResources& resources) const;
 
 private:
     SupportingHalfedge::GPUResources buildIntrinsicGPUResources(
-        const SupportingHalfedge& supportingHalfedge,
+        const SupportingHalfedge::GPUBuffers& gpuBuffers,
         const SupportingHalfedge::IntrinsicMesh& intrinsicMesh) const;
-    float computeAverageTriangleArea(const SupportingHalfedge::IntrinsicMesh& intrinsicMesh) const;
+    static float computeAverageTriangleArea(const SupportingHalfedge::IntrinsicMesh& intrinsicMesh);
     VulkanDevice& vulkanDevice;
     MemoryAllocator& memoryAllocator;
 };
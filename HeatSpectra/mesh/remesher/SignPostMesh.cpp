@@ -11,6 +11,7 @@ void SignpostMesh::buildFromIndexedData(
     conn.buildFromIndexedData(pointPositions, triangleIndices);
     auto& HEs = conn.getHalfEdges();
     auto& V = conn.getVertices();
+    const auto& positions = conn.getVertexPositions();
 
     const auto& connFaces = conn.getFaces();
     faceNormals.resize(connFaces.size());
@@ -32,13 +33,14 @@ void SignpostMesh::buildFromIndexedData(
             continue;
         }
 
-        const glm::vec3 A = V[v0].position;
-        const glm::vec3 B = V[v1].position;
-        const glm::vec3 C = V[v2].position;
+        const glm::vec3 A = positions[v0];
+        const glm::vec3 B = positions[v1];
+        const glm::vec3 C = positions[v2];
         faceNormals[fid] = glm::normalize(glm::cross(B - A, C - A));
     }
 
     auto& edges = conn.getEdges();
+    auto& edgeLengths = conn.getEdgeLengths();
     for (uint32_t edgeIdx = 0; edgeIdx < edges.size(); ++edgeIdx) {
         const uint32_t he = edges[edgeIdx].halfEdgeIdx;
         if (he == INVALID_INDEX || he >= HEs.size()) {
@@ -56,9 +58,9 @@ void SignpostMesh::buildFromIndexedData(
             continue;
         }
 
-        const glm::dvec3 dv1(V[v1].position.x, V[v1].position.y, V[v1].position.z);
-        const glm::dvec3 dv2(V[v2].position.x, V[v2].position.y, V[v2].position.z);
-        edges[edgeIdx].intrinsicLength = glm::length(dv2 - dv1);
+        const glm::dvec3 dv1(positions[v1]);
+        const glm::dvec3 dv2(positions[v2]);
+        edgeLengths[edgeIdx] = glm::length(dv2 - dv1);
     }
 
     updateAllCornerAngles(std::unordered_set<uint32_t>());
@@ -71,6 +73,7 @@ SignpostMesh::Triangle2D SignpostMesh::layoutTriangle(uint32_t faceIdx) const {
 void SignpostMesh::updateAllSignposts() {
     const auto& V = conn.getVertices();
     const auto& HEs = conn.getHalfEdges();
+    const auto& cornerAngles = conn.getCornerAngles();
     vertexAngleSums.clear();
     vertexAngleSums.resize(V.size(), 0.0);
 
@@ -78,7 +81,7 @@ void SignpostMesh::updateAllSignposts() {
     for (uint32_t heIdx = 0; heIdx < HEs.size(); ++heIdx) {
         uint32_t vertexIdx = HEs[heIdx].origin;
         if (vertexIdx < vertexAngleSums.size()) {
-            vertexAngleSums[vertexIdx] += HEs[heIdx].cornerAngle;
+            vertexAngleSums[vertexIdx] += cornerAngles[heIdx];
         }
     }
 
@@ -93,10 +96,10 @@ void SignpostMesh::updateAllSignposts() {
         int safety = 0;
         do {
             // Store signpost angle at origin vertex 
-            conn.getHalfEdges()[currHe].signpostAngle = runningAngle;
+            conn.getSignpostAngles()[currHe] = runningAngle;
 
             // Add corner angle for next iteration 
-            double cornerAngleVal = conn.getHalfEdges()[currHe].cornerAngle;
+            double cornerAngleVal = conn.getCornerAngles()[currHe];
             runningAngle += cornerAngleVal;
 
             // Break at boundary 
@@ -118,6 +121,7 @@ void SignpostMesh::updateAllSignposts() {
 void SignpostMesh::rebuildVertexSums() {
     const auto& V = conn.getVertices();
     const auto& HEs = conn.getHalfEdges();
+    const auto& cornerAngles = conn.getCornerAngles();
 
     vertexAngleSums.clear();
     vertexAngleSums.resize(V.size(), 0.0);
@@ -125,7 +129,7 @@ void SignpostMesh::rebuildVertexSums() {
     for (uint32_t heIdx = 0; heIdx < HEs.size(); ++heIdx) {
         uint32_t vertexIdx = HEs[heIdx].origin;
         if (vertexIdx < vertexAngleSums.size()) {
-            vertexAngleSums[vertexIdx] += HEs[heIdx].cornerAngle;
+            vertexAngleSums[vertexIdx] += cornerAngles[heIdx];
         }
     }
 }
@@ -133,6 +137,7 @@ void SignpostMesh::rebuildVertexSums() {
 void SignpostMesh::updateVertexSums(const std::vector<uint32_t>& vertexIndices) {
     const auto& V = conn.getVertices();
     const auto& HEs = conn.getHalfEdges();
+    const auto& cornerAngles = conn.getCornerAngles();
 
     if (vertexAngleSums.size() != V.size()) {
         vertexAngleSums.resize(V.size(), 0.0);
@@ -147,9 +152,9 @@ void SignpostMesh::updateVertexSums(const std::vector<uint32_t>& vertexIndices)
 
     for (uint32_t vertexIdx : uniqueVertices) {
         vertexAngleSums[vertexIdx] = 0.0;
-        for (uint32_t heIdx : conn.getVertexHalfEdges(vertexIdx)) {
+        for (uint32_t heIdx : conn.vertexHalfEdges(vertexIdx)) {
             if (heIdx < HEs.size()) {
-                vertexAngleSums[vertexIdx] += HEs[heIdx].cornerAngle;
+                vertexAngleSums[vertexIdx] += cornerAngles[heIdx];
             }
         }
     }
@@ -163,7 +168,7 @@ glm::dvec2 SignpostMesh::halfedgeVector(uint32_t heIdx) const {
     const auto& he = HEs[heIdx];
 
     // Get raw signpost angle and apply vertex angle scaling
-    double rawAngle = he.signpostAngle;
+    double rawAngle = conn.getSignpostAngles()[heIdx];
     // Use origin vertex 
     uint32_t originVertexIdx = he.origin;
     
@@ -195,7 +200,7 @@ void SignpostMesh::buildHalfedgeVectorsInVertex() {
         
         do {
             // Use stored signpost angle directly 
-            double coordSum = conn.getHalfEdges()[currHe].signpostAngle;
+            double coordSum = conn.getSignpostAngles()[currHe];
             
             // Apply vertex angle scaling
             double scaleFactor = 1.0;
@@ -233,6 +238,7 @@ void SignpostMesh::buildHalfedgeVectorsInVertex() {
 
 void SignpostMesh::updateVertexVectors(const std::vector<uint32_t>& vertexIndices) {
     auto& HEs = conn.getHalfEdges();
+    auto& signpostAngles = conn.getSignpostAngles();
     const auto& V = conn.getVertices();
 
     if (halfedgeVectorsInVertex.size() != HEs.size()) {
@@ -255,7 +261,7 @@ void SignpostMesh::updateVertexVectors(const std::vector<uint32_t>& vertexIndice
         uint32_t currHe = firstOutgoing;
         int safety = 0;
         do {
-            double coordSum = HEs[currHe].signpostAngle;
+            double coordSum = signpostAngles[currHe];
             double scaleFactor = 1.0;
             if (vid < vertexAngleScales.size()) {
                 scaleFactor = vertexAngleScales[vid];
@@ -292,8 +298,8 @@ void SignpostMesh::buildHalfedgeVectorsInFace() {
 
     const uint32_t faceCount = conn.getFaces().size();
     for (uint32_t f = 0; f < faceCount; ++f) {
-        auto faceHEs = conn.getFaceHalfEdges(f);
-        if (faceHEs.size() != 3) {
+        std::array<uint32_t, 3> faceHEs;
+        if (!conn.getTriangleHalfEdges(f, faceHEs)) {
             continue;
         }
 
@@ -333,8 +339,8 @@ void SignpostMesh::updateFaceVectors(const std::vector<uint32_t>& faceIndices) {
     }
 
     for (uint32_t f : uniqueFaces) {
-        auto faceHEs = conn.getFaceHalfEdges(f);
-        if (faceHEs.size() != 3) {
+        std::array<uint32_t, 3> faceHEs;
+        if (!conn.getTriangleHalfEdges(f, faceHEs)) {
             continue;
         }
 
@@ -346,7 +352,11 @@ void SignpostMesh::updateFaceVectors(const std::vector<uint32_t>& faceIndices) {
     }
 
     for (uint32_t f : uniqueFaces) {
-        for (uint32_t heIdx : conn.getFaceHalfEdges(f)) {
+        std::array<uint32_t, 3> faceHEs;
+        if (!conn.getTriangleHalfEdges(f, faceHEs)) {
+            continue;
+        }
+        for (uint32_t heIdx : faceHEs) {
             if (heIdx < HEs.size() && HEs[heIdx].face == HalfEdgeMesh::INVALID_INDEX) {
                 halfedgeVectorsInFace[heIdx] = glm::dvec2(std::numeric_limits<double>::quiet_NaN());
             }
@@ -392,9 +402,8 @@ glm::dvec3 SignpostMesh::computeBarycentric2D(const glm::dvec2& p, const glm::dv
 double SignpostMesh::computeSplitDiagonalLength(uint32_t faceIdx, uint32_t originalVA, uint32_t originalVB, double splitFraction) const {
     // Lay out the triangle in 2D using intrinsic edge lengths
     auto triangle2D = layoutTriangle(faceIdx);
-    auto faceVertices = conn.getFaceVertices(faceIdx);  
-
-    if (faceVertices.size() != 3) {
+    std::array<uint32_t, 3> faceVertices;
+    if (!conn.getTriangleVertices(faceIdx, faceVertices)) {
         return 0.0;
     }
 
@@ -477,6 +486,7 @@ std::array<double, 3> SignpostMesh::computeCornerAngles(uint32_t faceIdx) const
 
 void SignpostMesh::computeCornerScaledAngles() {
     const auto& HEs = conn.getHalfEdges();
+    const auto& cornerAngles = conn.getCornerAngles();
     const auto& V = conn.getVertices();
 
     cornerScaledAngles.clear();
@@ -489,7 +499,7 @@ void SignpostMesh::computeCornerScaledAngles() {
         vertexAngleSums.resize(V.size(), 0.0);
         for (size_t he = 0; he < HEs.size(); ++he) {
             uint32_t vid = HEs[he].origin;
-            if (vid < vertexAngleSums.size()) vertexAngleSums[vid] += HEs[he].cornerAngle;
+            if (vid < vertexAngleSums.size()) vertexAngleSums[vid] += cornerAngles[he];
         }
     }
 
@@ -497,7 +507,7 @@ void SignpostMesh::computeCornerScaledAngles() {
     for (size_t he = 0; he < HEs.size(); ++he) {
         uint32_t vid = HEs[he].origin;
         if (vid >= V.size() || vid >= vertexAngleSums.size()) {
-            cornerScaledAngles[he] = HEs[he].cornerAngle; // fallback
+            cornerScaledAngles[he] = cornerAngles[he]; // fallback
             continue;
         }
 
@@ -505,16 +515,17 @@ void SignpostMesh::computeCornerScaledAngles() {
         double target = (HEs[he].opposite == HalfEdgeMesh::INVALID_INDEX) ? glm::pi<double>() : 2.0 * glm::pi<double>();
         if (vSum > 1e-12) {
             double scale = target / vSum;
-            cornerScaledAngles[he] = HEs[he].cornerAngle * scale;
+            cornerScaledAngles[he] = cornerAngles[he] * scale;
         }
         else {
-            cornerScaledAngles[he] = HEs[he].cornerAngle;
+            cornerScaledAngles[he] = cornerAngles[he];
         }
     }
 }
 
 void SignpostMesh::updateCornerScales(const std::vector<uint32_t>& vertexIndices) {
     const auto& HEs = conn.getHalfEdges();
+    const auto& cornerAngles = conn.getCornerAngles();
     const auto& V = conn.getVertices();
 
     if (cornerScaledAngles.size() != HEs.size()) {
@@ -534,16 +545,16 @@ void SignpostMesh::updateCornerScales(const std::vector<uint32_t>& vertexIndices
         }
 
         double vSum = vertexAngleSums[vid];
-        for (uint32_t heIdx : conn.getVertexHalfEdges(vid)) {
+        for (uint32_t heIdx : conn.vertexHalfEdges(vid)) {
             if (heIdx >= HEs.size()) {
                 continue;
             }
 
             double target = (HEs[heIdx].opposite == HalfEdgeMesh::INVALID_INDEX) ? glm::pi<double>() : 2.0 * glm::pi<double>();
             if (vSum > 1e-12) {
-                cornerScaledAngles[heIdx] = HEs[heIdx].cornerAngle * (target / vSum);
+                cornerScaledAngles[heIdx] = cornerAngles[heIdx] * (target / vSum);
             } else {
-                cornerScaledAngles[heIdx] = HEs[heIdx].cornerAngle;
+                cornerScaledAngles[heIdx] = cornerAngles[heIdx];
             }
         }
     }
@@ -552,6 +563,7 @@ void SignpostMesh::updateCornerScales(const std::vector<uint32_t>& vertexIndices
 void SignpostMesh::updateCornerAnglesForFace(uint32_t faceIdx) {
     const auto& faces = conn.getFaces();
     auto& HEs = conn.getHalfEdges();
+    auto& cornerAngles = conn.getCornerAngles();
 
     if (faceIdx >= faces.size() || faces[faceIdx].halfEdgeIdx == INVALID_INDEX)
         return;
@@ -567,9 +579,9 @@ void SignpostMesh::updateCornerAnglesForFace(uint32_t faceIdx) {
     const auto angles = computeCornerAngles(faceIdx);
 
     // Each halfedge gets the angle at its origin vertex
-    HEs[he0].cornerAngle = angles[0];  // Angle at origin of he0
-    HEs[he1].cornerAngle = angles[1];  // Angle at origin of he1
-    HEs[he2].cornerAngle = angles[2];  // Angle at origin of he2
+    cornerAngles[he0] = angles[0];  // Angle at origin of he0
+    cornerAngles[he1] = angles[1];  // Angle at origin of he1
+    cornerAngles[he2] = angles[2];  // Angle at origin of he2
 }
 
 void SignpostMesh::updateAllCornerAngles(const std::unordered_set<uint32_t>& skipFaces) {
@@ -595,18 +607,20 @@ double SignpostMesh::standardizeAngleForVertex(uint32_t vertexIdx, double angleR
 
 void SignpostMesh::updateAngleFromCWNeighbor(uint32_t heIdx) {
     auto& HEs = conn.getHalfEdges();
+    auto& cornerAngles = conn.getCornerAngles();
+    auto& signpostAngles = conn.getSignpostAngles();
     
     // Boundary handling 
     if (!conn.isInteriorHalfEdge(heIdx)) {
         // Last wedge angle
-        HEs[heIdx].signpostAngle = getVertexAngleSum(HEs[heIdx].origin); 
+        signpostAngles[heIdx] = getVertexAngleSum(HEs[heIdx].origin); 
         halfedgeVectorsInVertex[heIdx] = halfedgeVector(heIdx);
         return;
     }
 
     uint32_t twin = HEs[heIdx].opposite;
     if (!conn.isInteriorHalfEdge(twin)) {
-        HEs[heIdx].signpostAngle = 0.0; // first wedge
+        signpostAngles[heIdx] = 0.0; // first wedge
         halfedgeVectorsInVertex[heIdx] = halfedgeVector(heIdx);
         return;
     }
@@ -614,13 +628,13 @@ void SignpostMesh::updateAngleFromCWNeighbor(uint32_t heIdx) {
     // CW neighbor = he.opp().next()
     uint32_t cw = HEs[twin].next; 
     // Neighbor stored raw angle
-    double neighborRaw = HEs[cw].signpostAngle;
+    double neighborRaw = signpostAngles[cw];
     // Corner angle of neighbor
-    double cAngle = HEs[cw].cornerAngle;
+    double cAngle = cornerAngles[cw];
 
     // Add neighbor raw angle and corner angle then convert into target vertex domain
     double updated = standardizeAngleForVertex(HEs[heIdx].origin, neighborRaw + cAngle);
-    HEs[heIdx].signpostAngle = updated;
+    signpostAngles[heIdx] = updated;
     halfedgeVectorsInVertex[heIdx] = halfedgeVector(heIdx);
 }
 
@@ -633,8 +647,8 @@ float SignpostMesh::computeFaceArea(uint32_t faceIdx) const {
     }
 
     // Get the halfedges of this face
-    std::vector<uint32_t> faceEdges = conn.getFaceHalfEdges(faceIdx);
-    if (faceEdges.size() != 3) {
+    std::array<uint32_t, 3> faceEdges;
+    if (!conn.getTriangleHalfEdges(faceIdx, faceEdges)) {
         return 0.0f;
     }
 
@@ -690,14 +704,15 @@ uint32_t SignpostMesh::getVertexDegree(uint32_t vertexIdx) const {
         return 0;
     }
 
-    std::vector<uint32_t> vertexHEs = conn.getVertexHalfEdges(vertexIdx);
-    return static_cast<uint32_t>(vertexHEs.size());
+    const auto vertexHEs = conn.vertexHalfEdges(vertexIdx);
+    return static_cast<uint32_t>(std::distance(vertexHEs.begin(), vertexHEs.end()));
 }
 
 double SignpostMesh::getCornerAngle(uint32_t halfEdgeIdx) const {
     const auto& HEs = conn.getHalfEdges();
+    const auto& cornerAngles = conn.getCornerAngles();
     return (halfEdgeIdx < HEs.size())
-        ? HEs[halfEdgeIdx].cornerAngle
+        ? cornerAngles[halfEdgeIdx]
         : 0.0;
 }
 
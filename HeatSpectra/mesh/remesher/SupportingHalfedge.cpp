@@ -74,7 +74,7 @@ void SupportingHalfedge::updateRemoval(uint32_t intrinsicHE) {
         return;
     }
 
-    std::vector<uint32_t> helist = inputConn.getVertexHalfEdges(v);
+    const auto helist = inputConn.vertexHalfEdges(v);
     const auto& inputHalfedges = inputConn.getHalfEdges();
 
     auto cornerAngleAtHalfedge = [&](uint32_t he) -> double {
@@ -165,7 +165,7 @@ void SupportingHalfedge::updateInsertion(uint32_t h) {
         return;
     }
 
-    std::vector<uint32_t> helist = inputConn.getVertexHalfEdges(v);
+    const auto helist = inputConn.vertexHalfEdges(v);
 
     auto cornerAngleAtHalfedge = [&](uint32_t he) -> double {
         if (he == INVALID_INDEX || he >= intrinsicHalfedges.size()) {
@@ -263,7 +263,6 @@ bool SupportingHalfedge::flipEdge(uint32_t edgeIdx) {
         return false;
     }
 
-    static int flipCount = 0;
     std::unordered_set<uint32_t> affectedTriangles;
 
     // Update before flip
@@ -444,6 +443,7 @@ SupportingHalfedge::IntrinsicMesh SupportingHalfedge::buildIntrinsicMesh() const
 
     auto& intrinsicConn = intrinsicMesh.getConnectivity();
     const auto& intrinsicVertices = intrinsicConn.getVertices();
+    const auto& intrinsicPositions = intrinsicConn.getVertexPositions();
     const auto& intrinsicFaces = intrinsicConn.getFaces();
     const auto& intrinsicHalfedges = intrinsicConn.getHalfEdges();
     const auto& inputVertices = inputMesh.getConnectivity().getVertices();
@@ -454,7 +454,7 @@ SupportingHalfedge::IntrinsicMesh SupportingHalfedge::buildIntrinsicMesh() const
     for (uint32_t vertIdx = 0; vertIdx < intrinsicVertices.size(); ++vertIdx) {
         IntrinsicVertex vertex;
         vertex.intrinsicVertexId = vertIdx;
-        vertex.position = intrinsicVertices[vertIdx].position;
+        vertex.position = intrinsicPositions[vertIdx];
 
         if (vertIdx < inputVertices.size()) {
             // Original vertex from input mesh
@@ -621,9 +621,10 @@ SupportingHalfedge::GPUBuffers SupportingHalfedge::buildGPUBuffers() const {
         buffers.intrinsicTriangleData.push_back(static_cast<int32_t>(face.halfEdgeIdx));
     }
 
-    buffers.intrinsicLengths.reserve(intrinsicEdges.size());
-    for (const auto& edge : intrinsicEdges) {
-        buffers.intrinsicLengths.push_back(static_cast<float>(edge.intrinsicLength));
+    const auto& intrinsicEdgeLengths = intrinsicConn.getEdgeLengths();
+    buffers.intrinsicLengths.reserve(intrinsicEdgeLengths.size());
+    for (double length : intrinsicEdgeLengths) {
+        buffers.intrinsicLengths.push_back(static_cast<float>(length));
     }
 
     buffers.inputHalfedgeData.reserve(inputHalfedges.size() * 4);
@@ -649,9 +650,10 @@ SupportingHalfedge::GPUBuffers SupportingHalfedge::buildGPUBuffers() const {
         buffers.inputTriangleData.push_back(static_cast<int32_t>(face.halfEdgeIdx));
     }
 
-    buffers.inputLengths.reserve(inputEdges.size());
-    for (const auto& edge : inputEdges) {
-        buffers.inputLengths.push_back(static_cast<float>(edge.intrinsicLength));
+    const auto& inputEdgeLengths = inputConn.getEdgeLengths();
+    buffers.inputLengths.reserve(inputEdgeLengths.size());
+    for (double length : inputEdgeLengths) {
+        buffers.inputLengths.push_back(static_cast<float>(length));
     }
 
     return buffers;
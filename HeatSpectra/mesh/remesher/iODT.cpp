@@ -61,7 +61,10 @@ uint32_t previousAroundVertex(const HalfEdgeMesh& conn, uint32_t heIdx) {
 size_t countNeedleCornersGC(SignpostMesh& mesh, uint32_t faceIdx) {
     auto& conn = mesh.getConnectivity();
     const auto& halfEdges = conn.getHalfEdges();
-    std::vector<uint32_t> faceHEs = conn.getFaceHalfEdges(faceIdx);
+    std::array<uint32_t, 3> faceHEs;
+    if (!conn.getTriangleHalfEdges(faceIdx, faceHEs)) {
+        return 0;
+    }
     size_t needleCorners = 0;
 
     for (uint32_t he : faceHEs) {
@@ -182,21 +185,30 @@ bool iODT::optimalDelaunayTriangulation(int maxIterations, double minAngleDegree
     }
     
     refreshIntrinsicDirectionalData();
+    reportProgress(0.1f);
+    if (isCancelled()) {
+        return false;
+    }
 
     // Refinement phase
-    if (!delaunayRefinement(maxIterations, minAngleDegrees)) {
+    if (!delaunayRefinement(maxIterations, minAngleDegrees) && !isCancelled()) {
         std::cerr << "[iODT] Delaunay refinement failed" << std::endl;
     }
+    reportProgress(0.5f);
+    if (isCancelled()) {
+        return false;
+    }
 
     // Repositioning phase
     optimalReposition(maxIterations, 1e-4, maxEdgeLength, stepSize);
 
-    return true;
+    return !isCancelled();
 }
 
 int iODT::splitLongEdges(double maxEdgeLength, int maxSplits) {
     auto& conn = intrinsicMesh.getConnectivity();
     auto& edges = conn.getEdges();
+    const auto& edgeLengths = conn.getEdgeLengths();
     auto& halfEdges = conn.getHalfEdges();
     int splitCount = 0;
 
@@ -210,7 +222,7 @@ int iODT::splitLongEdges(double maxEdgeLength, int maxSplits) {
         if (edges[e].halfEdgeIdx == INVALID_INDEX) {
             continue;
         }
-        if (!(edges[e].intrinsicLength > maxEdgeLength)) {
+        if (!(edgeLengths[e] > maxEdgeLength)) {
             continue;
         }
         edgesToSplit.push_back({ e, edges[e].halfEdgeIdx });
@@ -269,7 +281,7 @@ int iODT::splitLongEdges(double maxEdgeLength, int maxSplits) {
 double iODT::repositionInsertedVertices(double stepSize) {
     auto& conn = intrinsicMesh.getConnectivity();
     auto& verts = conn.getVertices();
-    auto& edges = conn.getEdges();
+    auto& edgeLengths = conn.getEdgeLengths();
     auto& halfEdges = conn.getHalfEdges();
 
     const double EPS_LEN = 1e-12;
@@ -338,7 +350,7 @@ double iODT::repositionInsertedVertices(double stepSize) {
             continue; 
         }         
 
-        auto outgoingHEs = conn.getVertexHalfEdges(vIdx);
+        const auto outgoingHEs = conn.vertexHalfEdges(vIdx);
         
         // Call updateRemoval for all incident halfedges before changing lengths
         if (supportingHalfedge) {
@@ -356,7 +368,7 @@ double iODT::repositionInsertedVertices(double stepSize) {
             glm::dvec2 neighborPos2D = ring.neighborPositions2D[i];
 
             double newLength = glm::length(neighborPos2D - newPos2D);
-            edges[edgeIdx].intrinsicLength = newLength;
+            edgeLengths[edgeIdx] = newLength;
         }
         
         for (uint32_t fIdx : ring.faceIndices) {
@@ -386,12 +398,18 @@ void iODT::optimalReposition(int maxIters, double tol, double maxEdgeLength, dou
 {
     auto& conn = intrinsicMesh.getConnectivity();
     auto& verts = conn.getVertices();
+    auto& positions = conn.getVertexPositions();
     auto& halfEdges = conn.getHalfEdges();
 
     for (int iter = 0; iter < maxIters; ++iter) {
+        if (isCancelled()) {
+            return;
+        }
+
         int preSplitCount = splitLongEdges(maxEdgeLength, 0);
         double maxMove = repositionInsertedVertices(stepSize);
         int postSplitCount = splitLongEdges(maxEdgeLength, 0);
+        reportProgress(0.5f + 0.4f * static_cast<float>(iter + 1) / static_cast<float>(maxIters));
 
         if (insertedVertices.empty()) {
             return;
@@ -404,7 +422,7 @@ void iODT::optimalReposition(int maxIters, double tol, double maxEdgeLength, dou
 
     std::unordered_set<uint32_t> finalFaces;
     for (uint32_t vIdx : insertedVertices) {
-        for (uint32_t faceIdx : conn.getVertexFaces(vIdx)) {
+        for (uint32_t faceIdx : conn.vertexFaces(vIdx)) {
             if (faceIdx != HalfEdgeMesh::INVALID_INDEX) {
                 finalFaces.insert(faceIdx);
             }
@@ -419,8 +437,7 @@ void iODT::optimalReposition(int maxIters, double tol, double maxEdgeLength, dou
         if (vIdx >= verts.size()) {
             continue;
         }
-        auto outgoingHEs = conn.getVertexHalfEdges(vIdx);
-        for (uint32_t heOut : outgoingHEs) {
+        for (uint32_t heOut : conn.vertexHalfEdges(vIdx)) {
             uint32_t heIn = halfEdges[heOut].opposite;
             if (heIn != HalfEdgeMesh::INVALID_INDEX) {
                 intrinsicMesh.updateAngleFromCWNeighbor(heIn);
@@ -437,7 +454,7 @@ void iODT::optimalReposition(int maxIters, double tol, double maxEdgeLength, dou
 
         const GeodesicTracer::SurfacePoint& sp = it->second;
         glm::dvec3 p3 = tracerInput.evaluateSurfacePoint(sp); 
-        verts[vIdx].position = glm::vec3(p3);
+        positions[vIdx] = glm::vec3(p3);
     }
 }
 
@@ -453,9 +470,7 @@ bool iODT::delaunayRefinement(int maxIters, float minAngleDegrees) {
     std::vector<uint32_t> flippedEdges;
 
     const auto& faces = conn.getFaces();
-    for (uint32_t faceIdx = 0; faceIdx < faces.size(); ++faceIdx) {
-        queueRefineFace(faceIdx, MIN_ANGLE, MIN_AREA, faceQueue);
-    }
+    queueAllRefineFaces(MIN_ANGLE, MIN_AREA, faceQueue);
 
     const auto& edges = conn.getEdges();
     for (uint32_t edgeIdx = 0; edgeIdx < edges.size(); ++edgeIdx) {
@@ -468,6 +483,10 @@ bool iODT::delaunayRefinement(int maxIters, float minAngleDegrees) {
     constexpr int MAX_RECHECK_COUNT = 5;
 
     while (insertions < MAX_REFINEMENT_INSERTIONS) {
+        if (isCancelled()) {
+            return false;
+        }
+
         while (!delaunayQueue.empty()) {
             uint32_t edgeIdx = delaunayQueue.front();
             delaunayQueue.pop_front();
@@ -560,9 +579,13 @@ bool iODT::delaunayRefinement(int maxIters, float minAngleDegrees) {
                 inDelaunayQueue.resize(conn.getEdges().size(), 0);
             }
 
-            for (uint32_t faceIdx : conn.getVertexFaces(newV)) {
+            for (uint32_t faceIdx : conn.vertexFaces(newV)) {
                 queueRefineFace(faceIdx, MIN_ANGLE, MIN_AREA, faceQueue);
-                for (uint32_t he : conn.getFaceHalfEdges(faceIdx)) {
+                std::array<uint32_t, 3> faceHEs;
+                if (!conn.getTriangleHalfEdges(faceIdx, faceHEs)) {
+                    continue;
+                }
+                for (uint32_t he : faceHEs) {
                     queueDelaunayEdge(conn.getEdgeFromHalfEdge(he), delaunayQueue, inDelaunayQueue);
                 }
             }
@@ -604,11 +627,7 @@ bool iODT::delaunayRefinement(int maxIters, float minAngleDegrees) {
             if (recheckCount < MAX_RECHECK_COUNT) {
                 ++recheckCount;
 
-                for (uint32_t faceIdx = 0; faceIdx < conn.getFaces().size(); ++faceIdx) {
-                    const size_t before = faceQueue.size();
-                    queueRefineFace(faceIdx, MIN_ANGLE, MIN_AREA, faceQueue);
-                    anyFound = anyFound || faceQueue.size() != before;
-                }
+                anyFound = queueAllRefineFaces(MIN_ANGLE, MIN_AREA, faceQueue) > 0;
 
                 for (uint32_t edgeIdx = 0; edgeIdx < conn.getEdges().size(); ++edgeIdx) {
                     if (!isValidEdge(edgeIdx)) {
@@ -646,7 +665,8 @@ bool iODT::isValidFace(uint32_t faceIdx) const {
         return false;
     }
 
-    return conn.getFaceHalfEdges(faceIdx).size() == 3;
+    std::array<uint32_t, 3> faceHEs;
+    return conn.getTriangleHalfEdges(faceIdx, faceHEs);
 }
 
 bool iODT::isValidEdge(uint32_t edgeIdx) const {
@@ -670,8 +690,8 @@ bool iODT::needsRefinement(uint32_t faceIdx, float minAngleThreshold, float minA
 
     const auto& conn = intrinsicMesh.getConnectivity();
     const auto& halfEdges = conn.getHalfEdges();
-    std::vector<uint32_t> faceHEs = conn.getFaceHalfEdges(faceIdx);
-    if (faceHEs.size() != 3) {
+    std::array<uint32_t, 3> faceHEs;
+    if (!conn.getTriangleHalfEdges(faceIdx, faceHEs)) {
         return false;
     }
 
@@ -727,7 +747,11 @@ bool iODT::needsRefinement(uint32_t faceIdx, float minAngleThreshold, float minA
 
 float iODT::refinementPriority(uint32_t faceIdx) {
     auto& conn = intrinsicMesh.getConnectivity();
-    for (uint32_t he : conn.getFaceHalfEdges(faceIdx)) {
+    std::array<uint32_t, 3> faceHEs;
+    if (!conn.getTriangleHalfEdges(faceIdx, faceHEs)) {
+        return intrinsicMesh.computeFaceArea(faceIdx);
+    }
+    for (uint32_t he : faceHEs) {
         uint32_t edgeIdx = conn.getEdgeFromHalfEdge(he);
         if (isFixedRefinementEdge(conn, edgeIdx)) {
             return std::numeric_limits<float>::infinity();
@@ -749,6 +773,32 @@ void iODT::queueRefineFace(uint32_t faceIdx, float minAngleThreshold, float minA
     faceQueue.push(candidate);
 }
 
+size_t iODT::queueAllRefineFaces(float minAngleThreshold, float minAreaThreshold, std::priority_queue<FaceCandidate>& faceQueue) {
+    // The per-face tests only read the mesh, so evaluate them in parallel and push in face order
+    const int faceCount = static_cast<int>(intrinsicMesh.getConnectivity().getFaces().size());
+    std::vector<FaceCandidate> candidates(static_cast<size_t>(faceCount));
+
+    #pragma omp parallel for schedule(dynamic, 64)
+    for (int faceIdx = 0; faceIdx < faceCount; ++faceIdx) {
+        const uint32_t face = static_cast<uint32_t>(faceIdx);
+        if (!needsRefinement(face, minAngleThreshold, minAreaThreshold)) {
+            continue;
+        }
+        candidates[faceIdx].faceIdx = face;
+        candidates[faceIdx].area = intrinsicMesh.computeFaceArea(face);
+        candidates[faceIdx].priority = refinementPriority(face);
+    }
+
+    size_t queuedCount = 0;
+    for (const FaceCandidate& candidate : candidates) {
+        if (candidate.faceIdx != INVALID_INDEX) {
+            faceQueue.push(candidate);
+            ++queuedCount;
+        }
+    }
+    return queuedCount;
+}
+
 void iODT::queueDelaunayEdge(uint32_t edgeIdx, std::deque<uint32_t>& edgeQueue, std::vector<uint8_t>& inQueue) {
     if (!isValidEdge(edgeIdx)) {
         return;
@@ -772,13 +822,17 @@ std::vector<uint32_t> iODT::collectLocalDelaunayEdges(HalfEdgeMesh& conn, uint32
     }
 
     const auto& halfEdges = conn.getHalfEdges();
-    for (uint32_t faceIdx : conn.getVertexFaces(vertexIdx)) {
+    for (uint32_t faceIdx : conn.vertexFaces(vertexIdx)) {
         if (faceIdx == HalfEdgeMesh::INVALID_INDEX) {
             continue;
         }
 
         patchFaces.insert(faceIdx);
-        for (uint32_t he : conn.getFaceHalfEdges(faceIdx)) {
+        std::array<uint32_t, 3> faceHEs;
+        if (!conn.getTriangleHalfEdges(faceIdx, faceHEs)) {
+            continue;
+        }
+        for (uint32_t he : faceHEs) {
             if (he == HalfEdgeMesh::INVALID_INDEX || he >= halfEdges.size()) {
                 continue;
             }
@@ -794,7 +848,11 @@ std::vector<uint32_t> iODT::collectLocalDelaunayEdges(HalfEdgeMesh& conn, uint32
     }
 
     for (uint32_t faceIdx : patchFaces) {
-        for (uint32_t he : conn.getFaceHalfEdges(faceIdx)) {
+        std::array<uint32_t, 3> faceHEs;
+        if (!conn.getTriangleHalfEdges(faceIdx, faceHEs)) {
+            continue;
+        }
+        for (uint32_t he : faceHEs) {
             uint32_t edgeIdx = conn.getEdgeFromHalfEdge(he);
             if (edgeIdx != HalfEdgeMesh::INVALID_INDEX) {
                 patchEdges.insert(edgeIdx);
@@ -816,7 +874,11 @@ void iODT::updateLocalFaces(HalfEdgeMesh& conn, const std::vector<uint32_t>& fac
         }
 
         patchFaces.insert(faceIdx);
-        for (uint32_t he : conn.getFaceHalfEdges(faceIdx)) {
+        std::array<uint32_t, 3> faceHEs;
+        if (!conn.getTriangleHalfEdges(faceIdx, faceHEs)) {
+            continue;
+        }
+        for (uint32_t he : faceHEs) {
             if (he != HalfEdgeMesh::INVALID_INDEX && he < halfEdges.size()) {
                 patchVertices.insert(halfEdges[he].origin);
             }
@@ -864,7 +926,11 @@ void iODT::updateLocalEdges(HalfEdgeMesh& conn, const std::vector<uint32_t>& edg
     }
 
     for (uint32_t faceIdx : patchFaces) {
-        for (uint32_t he : conn.getFaceHalfEdges(faceIdx)) {
+        std::array<uint32_t, 3> faceHEs;
+        if (!conn.getTriangleHalfEdges(faceIdx, faceHEs)) {
+            continue;
+        }
+        for (uint32_t he : faceHEs) {
             if (he != HalfEdgeMesh::INVALID_INDEX && he < halfEdges.size()) {
                 patchVertices.insert(halfEdges[he].origin);
             }
@@ -1019,8 +1085,8 @@ bool iODT::insertPoint(uint32_t faceIdx, const glm::dvec3& baryCoords, uint32_t&
     }
     b /= sum;
 
-    std::vector<uint32_t> faceHEs = conn.getFaceHalfEdges(faceIdx);
-    if (faceHEs.size() != 3) {
+    std::array<uint32_t, 3> faceHEs;
+    if (!conn.getTriangleHalfEdges(faceIdx, faceHEs)) {
         return false;
     }
     uint32_t he0 = faceHEs[0]; // v0 -> v1
@@ -1106,7 +1172,8 @@ bool iODT::insertPoint(uint32_t faceIdx, const glm::dvec3& baryCoords, uint32_t&
     intrinsicMesh.getHalfedgeVectorsInVertex().resize(halfEdges.size(), glm::dvec2(0.0));
 
     // Update corner angles for only new faces around the inserted vertex
-    auto newFaces = conn.getVertexFaces(newV);
+    const auto newFaceRange = conn.vertexFaces(newV);
+    const std::vector<uint32_t> newFaces(newFaceRange.begin(), newFaceRange.end());
     for (uint32_t fIdx : newFaces) {
         if (fIdx != HalfEdgeMesh::INVALID_INDEX) {
             intrinsicMesh.updateCornerAnglesForFace(fIdx);
@@ -1215,6 +1282,7 @@ bool iODT::splitEdge(uint32_t heEdge, double tParam, uint32_t& outNewV, bool* ou
 bool iODT::splitEdge(uint32_t edgeIdx, uint32_t& outNewVertex, uint32_t& outDiagFront, uint32_t& outDiagBack, uint32_t HESplit, double t) {
     auto& conn = intrinsicMesh.getConnectivity();
     auto& edges = conn.getEdges();
+    auto& edgeLengths = conn.getEdgeLengths();
     auto& halfEdges = conn.getHalfEdges();
 
     if (edgeIdx >= edges.size()) {
@@ -1300,7 +1368,7 @@ bool iODT::splitEdge(uint32_t edgeIdx, uint32_t& outNewVertex, uint32_t& outDiag
 
         uint32_t diagEdgeIdx = conn.getEdgeFromHalfEdge(diagHE);
         if (diagEdgeIdx != HalfEdgeMesh::INVALID_INDEX && diagEdgeIdx < edges.size()) {
-            edges[diagEdgeIdx].intrinsicLength = L;
+            edgeLengths[diagEdgeIdx] = L;
         }
     }
 
@@ -1315,8 +1383,7 @@ bool iODT::splitEdge(uint32_t edgeIdx, uint32_t& outNewVertex, uint32_t& outDiag
     intrinsicMesh.getVertexAngleSums()[newV] = isBoundary ? glm::pi<double>() : 2.0 * glm::pi<double>();
 
     // Update the corner angles only for affected faces
-    auto adjacentFaces = conn.getVertexFaces(newV);
-    for (uint32_t fIdx : adjacentFaces) {
+    for (uint32_t fIdx : conn.vertexFaces(newV)) {
         if (fIdx != HalfEdgeMesh::INVALID_INDEX) {
             intrinsicMesh.updateCornerAnglesForFace(fIdx);
         }
@@ -1325,8 +1392,7 @@ bool iODT::splitEdge(uint32_t edgeIdx, uint32_t& outNewVertex, uint32_t& outDiag
     // Update supporting halfedges
     if (supportingHalfedge) {
         // Update all halfedges incident to the new vertex
-        auto newVertexHEs = conn.getVertexHalfEdges(newV);
-        for (uint32_t he : newVertexHEs) {
+        for (uint32_t he : conn.vertexHalfEdges(newV)) {
             supportingHalfedge->updateInsertion(he);
             uint32_t opp = halfEdges[he].opposite;
             if (opp != HalfEdgeMesh::INVALID_INDEX) {
@@ -1422,9 +1488,8 @@ bool iODT::resolveVertex(uint32_t newVertexIdx) {
     const auto& halfEdges = conn.getHalfEdges();
 
     // Calculate angular coordinates for the halfedges
-    auto outgoingHEs = conn.getVertexHalfEdges(newVertexIdx);
     std::vector<uint32_t> incomingHEs;
-    for (uint32_t heOut : outgoingHEs) {
+    for (uint32_t heOut : conn.vertexHalfEdges(newVertexIdx)) {
         uint32_t twinHe = halfEdges[heOut].opposite;
         if (twinHe != HalfEdgeMesh::INVALID_INDEX) {
             incomingHEs.push_back(twinHe);
@@ -1521,9 +1586,8 @@ bool iODT::resolveVertex(uint32_t newVertexIdx) {
     GeodesicTracer::GeodesicTraceResult inputTrace;
     if (startPoint.type == GeodesicTracer::SurfacePoint::Type::VERTEX) {
         // Find reference face for vertex tracing
-        auto outgoingHEs_input = inputConn.getVertexHalfEdges(startPoint.elementId);
         uint32_t refFace = HalfEdgeMesh::INVALID_INDEX;
-        for (uint32_t he : outgoingHEs_input) {
+        for (uint32_t he : inputConn.vertexHalfEdges(startPoint.elementId)) {
             uint32_t face = inputConn.getHalfEdges()[he].face;
             if (face != HalfEdgeMesh::INVALID_INDEX) {
                 refFace = face;
@@ -1567,8 +1631,7 @@ bool iODT::resolveVertex(uint32_t newVertexIdx) {
     }
 
     // Set the actual 3D position from the trace result
-    auto& verticesMutable = const_cast<std::vector<HalfEdgeMesh::Vertex>&>(verts);
-    verticesMutable[newVertexIdx].position = inputTrace.position3D;
+    conn.getVertexPositions()[newVertexIdx] = inputTrace.position3D;
 
     // Get the arrival direction from the input mesh trace
     glm::dvec2 outgoingVec(0.0);
@@ -1591,9 +1654,8 @@ bool iODT::resolveVertex(uint32_t newVertexIdx) {
     }
 
     // Set signpost angle for the traced halfedge opposite
-    auto& halfEdgesMutable = const_cast<std::vector<HalfEdgeMesh::HalfEdge>&>(halfEdges);
     if (outgoingTraceHe != HalfEdgeMesh::INVALID_INDEX) {
-        halfEdgesMutable[outgoingTraceHe].signpostAngle = standardizedAngle;
+        conn.getSignpostAngles()[outgoingTraceHe] = standardizedAngle;
     }
 
     uint32_t firstHe = outgoingTraceHe;
@@ -1628,8 +1690,8 @@ double iODT::computeMinAngle(uint32_t faceIdx) {
     }
 
     // Get the halfedges of this face
-    std::vector<uint32_t> faceEdges = conn.getFaceHalfEdges(faceIdx);
-    if (faceEdges.size() != 3) {
+    std::array<uint32_t, 3> faceEdges;
+    if (!conn.getTriangleHalfEdges(faceIdx, faceEdges)) {
         return 0.0f;
     }
 
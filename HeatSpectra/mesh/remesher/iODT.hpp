@@ -7,6 +7,7 @@
 #include "util/Structs.hpp"
 #include "CommonSubdivision.hpp"
 #include "SupportingHalfedge.hpp"
+#include "RemeshJobControl.hpp"
 
 class iODT {
 public:
@@ -16,6 +17,8 @@ public:
     static const uint32_t INVALID_INDEX = static_cast<uint32_t>(-1);
 
     bool optimalDelaunayTriangulation(int iterations, double minAngleDegrees, double maxEdgeLength, double stepSize);
+    // Optional; when set the triangulation reports progress and stops early once cancelled
+    void setJobControl(RemeshJobControl* control) { jobControl = control; }
     bool insertPoint(uint32_t faceIdx, const glm::dvec3& baryCoords, uint32_t& outVertex, bool* outWasInserted = nullptr);
 
     GeodesicTracer::GeodesicTraceResult traceIntrinsicHalfedgeAlongInput(uint32_t intrinsicHalfedgeIdx);
@@ -56,6 +59,7 @@ private:
     bool needsRefinement(uint32_t faceIdx, float minAngleThreshold, float minAreaThreshold);
     float refinementPriority(uint32_t faceIdx);
     void queueRefineFace(uint32_t faceIdx, float minAngleThreshold, float minAreaThreshold, std::priority_queue<FaceCandidate>& faceQueue);
+    size_t queueAllRefineFaces(float minAngleThreshold, float minAreaThreshold, std::priority_queue<FaceCandidate>& faceQueue);
     void queueDelaunayEdge(uint32_t edgeIdx, std::deque<uint32_t>& edgeQueue, std::vector<uint8_t>& inQueue);
 
     bool insertCircumcenter(uint32_t faceIdx, uint32_t& outNewVertex);
@@ -69,6 +73,10 @@ private:
     bool isEdgeOriginal(uint32_t edgeIdx) const;
 
     void initializeVertexLocations();
+    bool isCancelled() const { return jobControl && jobControl->isCancelled(); }
+    void reportProgress(float value) { if (jobControl) { jobControl->reportProgress(value); } }
+
+    RemeshJobControl* jobControl = nullptr;
     SignpostMesh intrinsicMesh;     // Intrinsic mesh 
     SignpostMesh inputMesh;         // Input mesh 
     GeodesicTracer tracer;          // Tracer for the intrinsic mesh
@@ -19,11 +19,62 @@
 #include "runtime/RuntimeVoronoiDisplayTransport.hpp"
 #include "runtime/RuntimeECS.hpp"
 
+namespace {
+
+uint32_t collectPackageTypes(const ECSRegistry& registry, const std::unordered_set<ECSEntity>& entities) {
+    uint32_t packageTypes = 0;
+    for (ECSEntity entity : entities) {
+        if (!registry.valid(entity)) {
+            continue;
+        }
+        if (registry.all_of<ModelPackage>(entity)) { packageTypes |= RuntimePackageCompiler::packageTypeBit(NodePayloadType::Geometry); }
+        if (registry.all_of<RemeshPackage>(entity)) { packageTypes |= RuntimePackageCompiler::packageTypeBit(NodePayloadType::Remesh); }
+        if (registry.all_of<VoronoiPackage>(entity)) { packageTypes |= RuntimePackageCompiler::packageTypeBit(NodePayloadType::Voronoi); }
+        if (registry.all_of<ContactPackage>(entity)) { packageTypes |= RuntimePackageCompiler::packageTypeBit(NodePayloadType::Contact); }
+        if (registry.all_of<HeatPackage>(entity)) { packageTypes |= RuntimePackageCompiler::packageTypeBit(NodePayloadType::Heat); }
+    }
+    return packageTypes;
+}
+
+template <typename PackageT, typename ProductT>
+bool hasUnpublishedPackages(const ECSRegistry& registry) {
+    for (auto entity : registry.view<PackageT>()) {
+        if (!registry.all_of<ProductT>(entity)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}
+
+template <typename TransportT>
+bool NodeGraphController::syncTransport(TransportT* transport, TransportSyncState& syncState, bool wake) {
+    if (!transport) {
+        return false;
+    }
+
+    if (!wake && syncState.hasSynced && !syncState.needsResync && syncState.productSignature == productSignature) {
+        return false;
+    }
+
+    transport->sync(ecsRegistry);
+    transport->finalizeSync();
+
+    // Record the signature after our own publishes so they do not wake us again
+    syncState.hasSynced = true;
+    syncState.needsResync = false;
+    productSignature = buildProductSignature(ecsRegistry);
+    syncState.productSignature = productSignature;
+    return true;
+}
+
 NodeGraphController::NodeGraphController(NodeGraphBridge* bridge, const NodeRuntimeServices& services)
     : bridge(bridge),
       runtimeServices(services),
       runtime(bridge, services) {
     plan.isValid = false;
+    packageCompiler.setRuntimeBridge(runtimeServices.runtimeBridge);
     if (runtimeServices.modelComputeTransport) { runtimeServices.modelComputeTransport->setECSRegistry(&ecsRegistry); }
     if (runtimeServices.remeshComputeTransport) { runtimeServices.remeshComputeTransport->setECSRegistry(&ecsRegistry); }
     if (runtimeServices.voronoiComputeTransport) { runtimeServices.voronoiComputeTransport->setECSRegistry(&ecsRegistry); }
@@ -72,44 +123,66 @@ void NodeGraphController::tick() {
         runtimeServices.heatDisplayTransport;
 
     if (hasComputeTransports || hasDisplayTransports) {
-        RuntimePackageCompiler packageCompiler{};
-        packageCompiler.setRuntimeBridge(runtimeServices.runtimeBridge);
-
         // Snapshot all package entities as stale before compilation
         std::unordered_set<ECSEntity> staleEntities = collectPackageEntities(ecsRegistry);
 
-        // Compile and apply packages directly to registry 
-        packageCompiler.compileAndApply(runtime.state(), execState, runtimeServices.payloadRegistry, ecsRegistry, staleEntities);
+        // Compile and apply packages directly to registry; unchanged outputs keep their package
+        productSignature = buildProductSignature(ecsRegistry);
+        const uint32_t compiledPackageTypes = packageCompiler.compileAndApply(
+            runtime.state(),
+            execState,
+            runtimeServices.payloadRegistry,
+            ecsRegistry,
+            productSignature,
+            staleEntities);
+
+        uint32_t touchedPackageTypes = compiledPackageTypes | collectPackageTypes(ecsRegistry, staleEntities);
+        if (!staleEntities.empty()) {
+            // Destroying an entity also drops any product published on it
+            destroyStaleEntities(ecsRegistry, staleEntities);
+            productSignature = buildProductSignature(ecsRegistry);
+        }
 
-        destroyStaleEntities(ecsRegistry, staleEntities);
+        // Transports only resync when their packages changed, a product they may
+        // resolve was republished, or their previous sync left work outstanding
+        const auto touched = [&](NodePayloadType type) {
+            return (touchedPackageTypes & RuntimePackageCompiler::packageTypeBit(type)) != 0;
+        };
 
-        // Sync compute transports 
-        if (runtimeServices.modelComputeTransport) {
-            runtimeServices.modelComputeTransport->sync(ecsRegistry);
-            runtimeServices.modelComputeTransport->finalizeSync();
+        if (syncTransport(runtimeServices.modelComputeTransport, modelComputeSync, touched(NodePayloadType::Geometry))) {
+            modelComputeSync.needsResync = hasUnpublishedPackages<ModelPackage, ModelProduct>(ecsRegistry);
         }
-        if (runtimeServices.remeshComputeTransport) {
-            runtimeServices.remeshComputeTransport->sync(ecsRegistry);
-            runtimeServices.remeshComputeTransport->finalizeSync();
+        if (syncTransport(runtimeServices.remeshComputeTransport, remeshComputeSync, touched(NodePayloadType::Remesh))) {
+            remeshComputeSync.needsResync = runtimeServices.remeshComputeTransport->hasPendingWork() ||
+                hasUnpublishedPackages<RemeshPackage, RemeshProduct>(ecsRegistry);
         }
-        if (runtimeServices.voronoiComputeTransport) {
-            runtimeServices.voronoiComputeTransport->sync(ecsRegistry);
-            runtimeServices.voronoiComputeTransport->finalizeSync();
+        if (syncTransport(runtimeServices.voronoiComputeTransport, voronoiComputeSync, touched(NodePayloadType::Voronoi))) {
+            voronoiComputeSync.needsResync = hasUnpublishedPackages<VoronoiPackage, VoronoiProduct>(ecsRegistry);
         }
-        if (runtimeServices.contactComputeTransport) {
-            runtimeServices.contactComputeTransport->sync(ecsRegistry);
-            runtimeServices.contactComputeTransport->finalizeSync();
+        if (syncTransport(runtimeServices.contactComputeTransport, contactComputeSync, touched(NodePayloadType::Contact))) {
+            contactComputeSync.needsResync = hasUnpublishedPackages<ContactPackage, ContactProduct>(ecsRegistry);
         }
-        if (runtimeServices.heatComputeTransport) {
-            runtimeServices.heatComputeTransport->sync(ecsRegistry);
-            runtimeServices.heatComputeTransport->finalizeSync();
+        if (syncTransport(runtimeServices.heatComputeTransport, heatComputeSync, touched(NodePayloadType::Heat))) {
+            heatComputeSync.needsResync = hasUnpublishedPackages<HeatPackage, HeatProduct>(ecsRegistry);
         }
 
         if (hasDisplayTransports) {
-            const std::unordered_set<uint64_t> visibleKeys =
-                nodeGraphDisplay.computeDisplaySelectedKeys(
-                    runtime.state(),
-                    ecsRegistry);
+            // Display selection follows the graph and whatever is published
+            bool visibleKeysChanged = false;
+            if (!hasVisibleKeys ||
+                touchedPackageTypes != 0 ||
+                visibleKeysRevision != runtime.state().revision ||
+                visibleKeysProductSignature != productSignature) {
+                std::unordered_set<uint64_t> nextVisibleKeys =
+                    nodeGraphDisplay.computeDisplaySelectedKeys(
+                        runtime.state(),
+                        ecsRegistry);
+                visibleKeysChanged = !hasVisibleKeys || nextVisibleKeys != visibleKeys;
+                visibleKeys = std::move(nextVisibleKeys);
+                hasVisibleKeys = true;
+                visibleKeysRevision = runtime.state().revision;
+                visibleKeysProductSignature = productSignature;
+            }
 
             if (runtimeServices.modelDisplayTransport) { runtimeServices.modelDisplayTransport->setVisibleKeys(&visibleKeys); }
             if (runtimeServices.remeshDisplayTransport) { runtimeServices.remeshDisplayTransport->setVisibleKeys(&visibleKeys); }
@@ -117,29 +190,14 @@ void NodeGraphController::tick() {
             if (runtimeServices.contactDisplayTransport) { runtimeServices.contactDisplayTransport->setVisibleKeys(&visibleKeys); }
             if (runtimeServices.heatDisplayTransport) { runtimeServices.heatDisplayTransport->setVisibleKeys(&visibleKeys); }
 
-            if (runtimeServices.modelDisplayTransport) {
-                runtimeServices.modelDisplayTransport->sync(ecsRegistry);
-                runtimeServices.modelDisplayTransport->finalizeSync();
-            }
-            if (runtimeServices.remeshDisplayTransport) {
-                runtimeServices.remeshDisplayTransport->sync(ecsRegistry);
-                runtimeServices.remeshDisplayTransport->finalizeSync();
-            }
-            if (runtimeServices.voronoiDisplayTransport) {
-                runtimeServices.voronoiDisplayTransport->sync(ecsRegistry);
-                runtimeServices.voronoiDisplayTransport->finalizeSync();
-            }
-            if (runtimeServices.contactDisplayTransport) {
-                runtimeServices.contactDisplayTransport->sync(ecsRegistry);
-                runtimeServices.contactDisplayTransport->finalizeSync();
-            }
-            if (runtimeServices.heatDisplayTransport) {
-                runtimeServices.heatDisplayTransport->sync(ecsRegistry);
-                runtimeServices.heatDisplayTransport->finalizeSync();
-            }
+            syncTransport(runtimeServices.modelDisplayTransport, modelDisplaySync, visibleKeysChanged || touched(NodePayloadType::Geometry));
+            syncTransport(runtimeServices.remeshDisplayTransport, remeshDisplaySync, visibleKeysChanged || touched(NodePayloadType::Remesh));
+            syncTransport(runtimeServices.voronoiDisplayTransport, voronoiDisplaySync, visibleKeysChanged || touched(NodePayloadType::Voronoi));
+            syncTransport(runtimeServices.contactDisplayTransport, contactDisplaySync, visibleKeysChanged || touched(NodePayloadType::Contact));
+            syncTransport(runtimeServices.heatDisplayTransport, heatDisplaySync, visibleKeysChanged || touched(NodePayloadType::Heat));
         }
 
-        if (runtimeServices.runtimeBridge) {
+        if (runtimeServices.runtimeBridge && touched(NodePayloadType::Remesh)) {
             runtimeServices.runtimeBridge->clear();
             for (auto entity : ecsRegistry.view<RemeshPackage>()) {
                 uint64_t socketKey = static_cast<uint64_t>(entity);
@@ -4,8 +4,10 @@
 #include "NodeGraphCompiler.hpp"
 #include "NodeGraphRuntime.hpp"
 #include "runtime/RuntimeECS.hpp"
+#include "runtime/RuntimePackageCompiler.hpp"
 
 #include <cstdint>
+#include <unordered_set>
 
 class NodeGraphBridge;
 
@@ -21,8 +23,18 @@ public:
     const NodeGraphCompiled& compiledState() const;
 
 private:
+    struct TransportSyncState {
+        bool hasSynced = false;
+        // Set when the last sync left work behind, e.g. a package without a product
+        bool needsResync = false;
+        uint64_t productSignature = 0;
+    };
+
     static bool allChangesAreLayout(const NodeGraphDelta& delta);
 
+    template <typename TransportT>
+    bool syncTransport(TransportT* transport, TransportSyncState& syncState, bool wake);
+
     NodeGraphBridge* bridge = nullptr;
     NodeRuntimeServices runtimeServices{};
     NodeGraphRuntime runtime;
@@ -30,4 +42,23 @@ private:
     NodeGraphCompiled plan{};
     NodeGraphDisplay nodeGraphDisplay{};
     ECSRegistry ecsRegistry{};
+    RuntimePackageCompiler packageCompiler{};
+    // Digest of the published products, refreshed whenever a tick may have changed them
+    uint64_t productSignature = 0;
+
+    TransportSyncState modelComputeSync{};
+    TransportSyncState remeshComputeSync{};
+    TransportSyncState voronoiComputeSync{};
+    TransportSyncState contactComputeSync{};
+    TransportSyncState heatComputeSync{};
+    TransportSyncState modelDisplaySync{};
+    TransportSyncState remeshDisplaySync{};
+    TransportSyncState voronoiDisplaySync{};
+    TransportSyncState contactDisplaySync{};
+    TransportSyncState heatDisplaySync{};
+
+    std::unordered_set<uint64_t> visibleKeys;
+    bool hasVisibleKeys = false;
+    uint64_t visibleKeysRevision = 0;
+    uint64_t visibleKeysProductSignature = 0;
 };
@@ -22,8 +22,8 @@ void populateMetadata(NodeDataBlock& dataBlock, const NodePayloadRegistry* regis
         } else {
             dataBlock.metadata["geometry.model_path"] = geometry->baseModelPath;
         }
-        const size_t pointCount = geometry ? geometry->pointPositions.size() / 3 : 0u;
-        const size_t triangleCount = geometry ? geometry->triangleIndices.size() / 3 : 0u;
+        const size_t pointCount = geometry ? geometry->pointPositions().size() / 3 : 0u;
+        const size_t triangleCount = geometry ? geometry->triangleIndices().size() / 3 : 0u;
         dataBlock.metadata.erase("geometry.model_id");
         dataBlock.metadata["geometry.point_count"] = std::to_string(pointCount);
         dataBlock.metadata["geometry.triangle_count"] = std::to_string(triangleCount);
@@ -207,6 +207,15 @@ NodeTypeDefinition NodeGraphRegistry::buildHeatSolveNode() {
             {nodegraphparams::heatsolve::VoxelResolution, "Voxel Resolution", NodeGraphParamType::Int, 0.0, 128, false, "", false},
             {nodegraphparams::heatsolve::ShowHeatOverlay, "Show Heat Overlay", NodeGraphParamType::Bool, 0.0, 0, false, "", false},
             {nodegraphparams::heatsolve::ContactThermalConductance, "Contact Thermal Conductance", NodeGraphParamType::Float, 16000.0, 0, false, "", false},
+            {nodegraphparams::heatsolve::ClockMode, "Clock Mode", NodeGraphParamType::Int, 0.0, 0, false, "", false},
+            {nodegraphparams::heatsolve::FixedTimeStep, "Fixed Time Step", NodeGraphParamType::Float, 1.0 / 60.0, 0, false, "", false},
+            {nodegraphparams::heatsolve::StepsPerSubmission, "Steps Per Submission", NodeGraphParamType::Int, 0.0, 16, false, "", false},
+            {nodegraphparams::heatsolve::RecordTemperatures, "Record Temperatures", NodeGraphParamType::Bool, 0.0, 0, false, "", false},
+            {nodegraphparams::heatsolve::RecordPath, "Record Path", NodeGraphParamType::String, 0.0, 0, false, "", false},
+            {nodegraphparams::heatsolve::RecordInterval, "Record Interval", NodeGraphParamType::Int, 0.0, 10, false, "", false},
+            {nodegraphparams::heatsolve::SolverMode, "Solver", NodeGraphParamType::Int, 0.0, 0, false, "", false},
+            {nodegraphparams::heatsolve::SolverTolerance, "Solver Tolerance", NodeGraphParamType::Float, 1e-4, 0, false, "", false},
+            {nodegraphparams::heatsolve::SolverMaxIterations, "Solver Max Iterations", NodeGraphParamType::Int, 0.0, 500, false, "", false},
         },
     };
 }
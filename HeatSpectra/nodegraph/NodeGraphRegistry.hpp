@@ -68,6 +68,15 @@ constexpr uint32_t CellSize = 6;
 constexpr uint32_t VoxelResolution = 7;
 constexpr uint32_t ShowHeatOverlay = 8;
 constexpr uint32_t ContactThermalConductance = 9;
+constexpr uint32_t ClockMode = 10;
+constexpr uint32_t FixedTimeStep = 11;
+constexpr uint32_t StepsPerSubmission = 12;
+constexpr uint32_t RecordTemperatures = 13;
+constexpr uint32_t RecordPath = 14;
+constexpr uint32_t RecordInterval = 15;
+constexpr uint32_t SolverMode = 16;
+constexpr uint32_t SolverTolerance = 17;
+constexpr uint32_t SolverMaxIterations = 18;
 }
 
 namespace voronoi {
@@ -126,13 +126,20 @@ bool NodeGroup::applyAssignment(
     const uint32_t targetGroupId = resolveTargetGroupId(geometry, targetGroupName);
     bool changed = false;
 
-    for (uint32_t& triangleGroupId : geometry.triangleGroupIds) {
-        if (matchingGroupIds.find(triangleGroupId) != matchingGroupIds.end()) {
-            if (triangleGroupId != targetGroupId) {
+    const auto needsReassignment = [&](uint32_t triangleGroupId) {
+        return triangleGroupId != targetGroupId &&
+            matchingGroupIds.find(triangleGroupId) != matchingGroupIds.end();
+    };
+
+    // Only unshare the mesh block when a triangle actually moves
+    const std::vector<uint32_t>& triangleGroupIds = geometry.triangleGroupIds();
+    if (std::any_of(triangleGroupIds.begin(), triangleGroupIds.end(), needsReassignment)) {
+        for (uint32_t& triangleGroupId : geometry.editMesh().triangleGroupIds) {
+            if (needsReassignment(triangleGroupId)) {
                 triangleGroupId = targetGroupId;
-                changed = true;
             }
         }
+        changed = true;
     }
 
     auto existingIt = std::find_if(
@@ -80,6 +80,9 @@ void NodeHeatSolve::execute(NodeGraphKernelContext& context) const {
             0,
             0,
             16000.0f,
+            SimulationClockSettings{},
+            TemperatureRecordSettings{},
+            HeatSolverSettings{},
             false,
             false,
             false);
@@ -102,6 +105,9 @@ void NodeHeatSolve::execute(NodeGraphKernelContext& context) const {
         voronoiInput->payloadHash,
         contactInput->payloadHash,
         static_cast<float>(params.contactThermalConductance),
+        makeHeatPayloadClockSettings(params),
+        makeHeatPayloadRecordSettings(params),
+        makeHeatPayloadSolverSettings(params),
         active,
         active ? wantsPaused : false,
         active ? params.resetRequested : false);
@@ -115,6 +121,9 @@ void NodeHeatSolve::populateOutputPayloads(
     uint64_t voronoiPayloadHash,
     uint64_t contactPayloadHash,
     float contactThermalConductance,
+    const SimulationClockSettings& clockSettings,
+    const TemperatureRecordSettings& recordSettings,
+    const HeatSolverSettings& solverSettings,
     bool active,
     bool paused,
     bool resetRequested) {
@@ -139,6 +148,9 @@ void NodeHeatSolve::populateOutputPayloads(
             heatData.receiverMeshHandles = receiverMeshHandles;
             heatData.materialBindings = materialBindings;
             heatData.contactThermalConductance = contactThermalConductance;
+            heatData.clockSettings = clockSettings;
+            heatData.recordSettings = recordSettings;
+            heatData.solverSettings = solverSettings;
             heatData.active = active;
             heatData.paused = paused;
             heatData.resetRequested = resetRequested;
@@ -175,6 +187,18 @@ bool NodeHeatSolve::computeInputHash(const NodeGraphKernelHashContext& context,
         NodeGraphHash::combine(outHash, static_cast<uint64_t>(binding.presetId));
     }
     NodeGraphHash::combineFloat(outHash, static_cast<float>(params.contactThermalConductance));
+    const SimulationClockSettings clockSettings = makeHeatPayloadClockSettings(params);
+    NodeGraphHash::combine(outHash, static_cast<uint64_t>(clockSettings.mode));
+    NodeGraphHash::combineFloat(outHash, clockSettings.fixedDeltaTime);
+    NodeGraphHash::combine(outHash, static_cast<uint64_t>(clockSettings.stepsPerSubmission));
+    const TemperatureRecordSettings recordSettings = makeHeatPayloadRecordSettings(params);
+    NodeGraphHash::combine(outHash, static_cast<uint64_t>(recordSettings.enabled ? 1u : 0u));
+    NodeGraphHash::combineString(outHash, recordSettings.path);
+    NodeGraphHash::combine(outHash, static_cast<uint64_t>(recordSettings.stepInterval));
+    const HeatSolverSettings solverSettings = makeHeatPayloadSolverSettings(params);
+    NodeGraphHash::combine(outHash, static_cast<uint64_t>(solverSettings.mode));
+    NodeGraphHash::combineFloat(outHash, solverSettings.residualTolerance);
+    NodeGraphHash::combine(outHash, static_cast<uint64_t>(solverSettings.maxIterations));
     const bool active = activeNodeId.isValid() && activeNodeId == context.node.id;
     NodeGraphHash::combine(outHash, static_cast<uint64_t>(active ? 1u : 0u));
     NodeGraphHash::combine(outHash, static_cast<uint64_t>(active && params.paused ? 1u : 0u));
@@ -21,6 +21,9 @@ private:
         uint64_t voronoiPayloadHash,
         uint64_t contactPayloadHash,
         float contactThermalConductance,
+        const SimulationClockSettings& clockSettings,
+        const TemperatureRecordSettings& recordSettings,
+        const HeatSolverSettings& solverSettings,
         bool active,
         bool paused,
         bool resetRequested);
@@ -5,6 +5,8 @@
 #include "NodeGraphUtils.hpp"
 #include "nodegraph/ui/widgets/NodePanelUtils.hpp"
 
+#include <algorithm>
+
 HeatSolveNodeParams readHeatSolveNodeParams(const NodeGraphNode& node) {
     HeatSolveNodeParams params{};
     params.enabled = NodePanelUtils::readBoolParam(node, nodegraphparams::heatsolve::Enabled, false);
@@ -13,6 +15,15 @@ HeatSolveNodeParams readHeatSolveNodeParams(const NodeGraphNode& node) {
     params.cellSize = NodePanelUtils::readFloatParam(node, nodegraphparams::heatsolve::CellSize, 0.005);
     params.voxelResolution = NodePanelUtils::readIntParam(node, nodegraphparams::heatsolve::VoxelResolution, 128);
     params.contactThermalConductance = NodePanelUtils::readFloatParam(node, nodegraphparams::heatsolve::ContactThermalConductance, 16000.0);
+    params.clockMode = NodePanelUtils::readIntParam(node, nodegraphparams::heatsolve::ClockMode, 0);
+    params.fixedTimeStep = NodePanelUtils::readFloatParam(node, nodegraphparams::heatsolve::FixedTimeStep, 1.0 / 60.0);
+    params.stepsPerSubmission = NodePanelUtils::readIntParam(node, nodegraphparams::heatsolve::StepsPerSubmission, 16);
+    params.recordTemperatures = NodePanelUtils::readBoolParam(node, nodegraphparams::heatsolve::RecordTemperatures, false);
+    params.recordPath = NodePanelUtils::readStringParam(node, nodegraphparams::heatsolve::RecordPath);
+    params.recordInterval = NodePanelUtils::readIntParam(node, nodegraphparams::heatsolve::RecordInterval, 10);
+    params.solverMode = NodePanelUtils::readIntParam(node, nodegraphparams::heatsolve::SolverMode, 0);
+    params.solverTolerance = NodePanelUtils::readFloatParam(node, nodegraphparams::heatsolve::SolverTolerance, 1e-4);
+    params.solverMaxIterations = NodePanelUtils::readIntParam(node, nodegraphparams::heatsolve::SolverMaxIterations, 500);
     params.preview.showHeatOverlay = NodePanelUtils::readBoolParam(node, nodegraphparams::heatsolve::ShowHeatOverlay, false);
 
     const NodeGraphParamValue* materialBindingsValue = findNodeParamValue(node, nodegraphparams::heatsolve::MaterialBindings);
@@ -30,6 +41,15 @@ bool writeHeatSolveNodeParams(NodeGraphEditor& editor, NodeGraphNodeId nodeId, c
         editor.setNodeParameter(nodeId, NodeGraphParamValue{nodegraphparams::heatsolve::CellSize, NodeGraphParamType::Float, params.cellSize}) &&
         editor.setNodeParameter(nodeId, NodeGraphParamValue{nodegraphparams::heatsolve::VoxelResolution, NodeGraphParamType::Int, 0.0, params.voxelResolution}) &&
         editor.setNodeParameter(nodeId, NodeGraphParamValue{nodegraphparams::heatsolve::ContactThermalConductance, NodeGraphParamType::Float, params.contactThermalConductance}) &&
+        editor.setNodeParameter(nodeId, NodeGraphParamValue{nodegraphparams::heatsolve::ClockMode, NodeGraphParamType::Int, 0.0, params.clockMode}) &&
+        editor.setNodeParameter(nodeId, NodeGraphParamValue{nodegraphparams::heatsolve::FixedTimeStep, NodeGraphParamType::Float, params.fixedTimeStep}) &&
+        editor.setNodeParameter(nodeId, NodeGraphParamValue{nodegraphparams::heatsolve::StepsPerSubmission, NodeGraphParamType::Int, 0.0, params.stepsPerSubmission}) &&
+        editor.setNodeParameter(nodeId, NodeGraphParamValue{nodegraphparams::heatsolve::RecordTemperatures, NodeGraphParamType::Bool, 0.0, 0, params.recordTemperatures}) &&
+        editor.setNodeParameter(nodeId, NodeGraphParamValue{nodegraphparams::heatsolve::RecordPath, NodeGraphParamType::String, 0.0, 0, false, params.recordPath}) &&
+        editor.setNodeParameter(nodeId, NodeGraphParamValue{nodegraphparams::heatsolve::RecordInterval, NodeGraphParamType::Int, 0.0, params.recordInterval}) &&
+        editor.setNodeParameter(nodeId, NodeGraphParamValue{nodegraphparams::heatsolve::SolverMode, NodeGraphParamType::Int, 0.0, params.solverMode}) &&
+        editor.setNodeParameter(nodeId, NodeGraphParamValue{nodegraphparams::heatsolve::SolverTolerance, NodeGraphParamType::Float, params.solverTolerance}) &&
+        editor.setNodeParameter(nodeId, NodeGraphParamValue{nodegraphparams::heatsolve::SolverMaxIterations, NodeGraphParamType::Int, 0.0, params.solverMaxIterations}) &&
         editor.setNodeParameter(nodeId, NodeGraphParamValue{nodegraphparams::heatsolve::ShowHeatOverlay, NodeGraphParamType::Bool, 0.0, 0, params.preview.showHeatOverlay}) &&
         editor.updateNodeParameter(
             nodeId,
@@ -42,3 +62,57 @@ bool writeHeatSolveNodeParams(NodeGraphEditor& editor, NodeGraphNodeId nodeId, c
 std::vector<HeatMaterialBinding> makeHeatPayloadMaterialBindings(const HeatSolveNodeParams& params) {
     return makeHeatMaterialBindings(params.materialBindingRows);
 }
+
+SimulationClockSettings makeHeatPayloadClockSettings(const HeatSolveNodeParams& params) {
+    SimulationClockSettings settings{};
+    switch (params.clockMode) {
+    case 1:
+        settings.mode = SimulationClockMode::FixedStep;
+        break;
+    case 2:
+        settings.mode = SimulationClockMode::AsFastAsPossible;
+        break;
+    default:
+        settings.mode = SimulationClockMode::RealTime;
+        break;
+    }
+    settings.fixedDeltaTime = params.fixedTimeStep > 0.0
+        ? static_cast<float>(params.fixedTimeStep)
+        : settings.fixedDeltaTime;
+    settings.stepsPerSubmission = static_cast<uint32_t>(std::clamp(
+        params.stepsPerSubmission,
+        1,
+        static_cast<int>(SimulationClock::MAX_STEPS_PER_SUBMISSION)));
+    return settings;
+}
+
+TemperatureRecordSettings makeHeatPayloadRecordSettings(const HeatSolveNodeParams& params) {
+    TemperatureRecordSettings settings{};
+    settings.enabled = params.recordTemperatures && !params.recordPath.empty();
+    settings.path = params.recordPath;
+    settings.stepInterval = static_cast<uint32_t>(std::max(params.recordInterval, 1));
+    return settings;
+}
+
+HeatSolverSettings makeHeatPayloadSolverSettings(const HeatSolveNodeParams& params) {
+    HeatSolverSettings settings{};
+    switch (params.solverMode) {
+    case 1:
+        settings.mode = HeatSolverMode::CpuJacobi;
+        break;
+    case 2:
+        settings.mode = HeatSolverMode::CpuGaussSeidel;
+        break;
+    case 3:
+        settings.mode = HeatSolverMode::CpuBiCGStab;
+        break;
+    default:
+        settings.mode = HeatSolverMode::GpuSubsteps;
+        break;
+    }
+    settings.residualTolerance = params.solverTolerance > 0.0
+        ? static_cast<float>(params.solverTolerance)
+        : settings.residualTolerance;
+    settings.maxIterations = static_cast<uint32_t>(std::max(params.solverMaxIterations, 1));
+    return settings;
+}
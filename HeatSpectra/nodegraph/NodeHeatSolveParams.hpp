@@ -2,7 +2,11 @@
 
 #include "NodeGraphTypes.hpp"
 #include "NodeHeatMaterialPresets.hpp"
+#include "heat/HeatCpuSolver.hpp"
+#include "heat/SimulationClock.hpp"
+#include "heat/TemperatureRecordFormat.hpp"
 
+#include <string>
 #include <vector>
 
 class NodeGraphEditor;
@@ -19,6 +23,15 @@ struct HeatSolveNodeParams {
     double cellSize = 0.005;
     int voxelResolution = 128;
     double contactThermalConductance = 16000.0;
+    int clockMode = 0;
+    double fixedTimeStep = 1.0 / 60.0;
+    int stepsPerSubmission = 16;
+    bool recordTemperatures = false;
+    std::string recordPath;
+    int recordInterval = 10;
+    int solverMode = 0;
+    double solverTolerance = 1e-4;
+    int solverMaxIterations = 500;
     HeatPreviewSettings preview{};
     std::vector<HeatMaterialBindingRow> materialBindingRows;
 };
@@ -26,3 +39,6 @@ struct HeatSolveNodeParams {
 HeatSolveNodeParams readHeatSolveNodeParams(const NodeGraphNode& node);
 bool writeHeatSolveNodeParams(NodeGraphEditor& editor, NodeGraphNodeId nodeId, const HeatSolveNodeParams& params);
 std::vector<HeatMaterialBinding> makeHeatPayloadMaterialBindings(const HeatSolveNodeParams& params);
+SimulationClockSettings makeHeatPayloadClockSettings(const HeatSolveNodeParams& params);
+TemperatureRecordSettings makeHeatPayloadRecordSettings(const HeatSolveNodeParams& params);
+HeatSolverSettings makeHeatPayloadSolverSettings(const HeatSolveNodeParams& params);
@@ -76,12 +76,13 @@ bool NodeModel::parseObjGeometry(const std::string& modelPath, GeometryData& geo
         return false;
     }
 
-    geometry.pointPositions = attrib.vertices;
-    geometry.triangleIndices.clear();
-    geometry.triangleGroupIds.clear();
+    GeometryMesh& mesh = geometry.editMesh();
+    mesh.pointPositions = attrib.vertices;
+    mesh.triangleIndices.clear();
+    mesh.triangleGroupIds.clear();
     geometry.groups.clear();
 
-    const std::size_t pointCount = geometry.pointPositions.size() / 3;
+    const std::size_t pointCount = mesh.pointPositions.size() / 3;
     std::unordered_map<std::string, uint32_t> groupIdByKey;
 
     const auto getGroupIdForFace = [&](const std::string& shapeName, int materialId) -> uint32_t {
@@ -172,10 +173,10 @@ bool NodeModel::parseObjGeometry(const std::string& modelPath, GeometryData& geo
                     continue;
                 }
 
-                geometry.triangleIndices.push_back(static_cast<uint32_t>(firstCorner.vertex_index));
-                geometry.triangleIndices.push_back(static_cast<uint32_t>(secondCorner.vertex_index));
-                geometry.triangleIndices.push_back(static_cast<uint32_t>(thirdCorner.vertex_index));
-                geometry.triangleGroupIds.push_back(groupId);
+                mesh.triangleIndices.push_back(static_cast<uint32_t>(firstCorner.vertex_index));
+                mesh.triangleIndices.push_back(static_cast<uint32_t>(secondCorner.vertex_index));
+                mesh.triangleIndices.push_back(static_cast<uint32_t>(thirdCorner.vertex_index));
+                mesh.triangleGroupIds.push_back(groupId);
             }
 
             indexOffset += faceVertexCountSize;
@@ -183,7 +184,7 @@ bool NodeModel::parseObjGeometry(const std::string& modelPath, GeometryData& geo
         }
     }
 
-    if (geometry.triangleIndices.empty()) {
+    if (mesh.triangleIndices.empty()) {
         return false;
     }
 
@@ -224,6 +225,8 @@ bool NodeModel::loadGeometryFromModelPath(const std::string& modelPath, Geometry
             continue;
         }
 
+        // Hash once here; every evaluation shares the cached mesh block and its hash
+        candidateGeometry.ensureContentHash();
         geometry = candidateGeometry;
         cachedGeometryByPath.emplace(candidatePath, std::move(candidateGeometry));
         return true;
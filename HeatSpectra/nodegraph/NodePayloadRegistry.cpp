@@ -6,6 +6,7 @@
 #include "domain/HeatData.hpp"
 #include "domain/RemeshData.hpp"
 #include "domain/VoronoiData.hpp"
+#include "util/ContentHash.hpp"
 
 void GeometryData::sealPayload() {
     uint64_t hash = NodeGraphHash::start();
@@ -13,18 +14,8 @@ void GeometryData::sealPayload() {
     for (float value : localToWorld) {
         NodeGraphHash::combineFloat(hash, value);
     }
-    NodeGraphHash::combine(hash, static_cast<uint64_t>(pointPositions.size()));
-    for (float value : pointPositions) {
-        NodeGraphHash::combineFloat(hash, value);
-    }
-    NodeGraphHash::combine(hash, static_cast<uint64_t>(triangleIndices.size()));
-    for (uint32_t value : triangleIndices) {
-        NodeGraphHash::combine(hash, static_cast<uint64_t>(value));
-    }
-    NodeGraphHash::combine(hash, static_cast<uint64_t>(triangleGroupIds.size()));
-    for (uint32_t value : triangleGroupIds) {
-        NodeGraphHash::combine(hash, static_cast<uint64_t>(value));
-    }
+    ensureContentHash();
+    NodeGraphHash::combine(hash, contentHash);
     NodeGraphHash::combine(hash, static_cast<uint64_t>(groups.size()));
     for (const GeometryGroup& group : groups) {
         NodeGraphHash::combine(hash, static_cast<uint64_t>(group.id));
@@ -34,6 +25,32 @@ void GeometryData::sealPayload() {
     payloadHash = hash;
 }
 
+void GeometryData::ensureContentHash() {
+    if (contentHash != 0) {
+        return;
+    }
+
+    const GeometryMesh& source = meshOrEmpty();
+    uint64_t hash = NodeGraphHash::start();
+    NodeGraphHash::combine(hash, static_cast<uint64_t>(source.pointPositions.size()));
+    hash = ContentHash::hashBytes(source.pointPositions.data(), source.pointPositions.size() * sizeof(float), hash);
+    NodeGraphHash::combine(hash, static_cast<uint64_t>(source.triangleIndices.size()));
+    hash = ContentHash::hashBytes(source.triangleIndices.data(), source.triangleIndices.size() * sizeof(uint32_t), hash);
+    NodeGraphHash::combine(hash, static_cast<uint64_t>(source.triangleGroupIds.size()));
+    hash = ContentHash::hashBytes(source.triangleGroupIds.data(), source.triangleGroupIds.size() * sizeof(uint32_t), hash);
+    contentHash = hash;
+}
+
+GeometryMesh& GeometryData::editMesh() {
+    contentHash = 0;
+    if (!mesh || mesh.use_count() > 1) {
+        mesh = mesh ? std::make_shared<GeometryMesh>(*mesh) : std::make_shared<GeometryMesh>();
+    }
+
+    // Every block is created non-const by make_shared above, and this one is unshared
+    return const_cast<GeometryMesh&>(*mesh);
+}
+
 void RemeshData::sealPayload() {
     uint64_t hash = NodeGraphHash::start();
     NodeGraphHash::combine(hash, static_cast<uint64_t>(active ? 1u : 0u));
@@ -66,6 +83,15 @@ void HeatData::sealPayload() {
     NodeGraphHash::combine(hash, static_cast<uint64_t>(paused ? 1u : 0u));
     NodeGraphHash::combine(hash, static_cast<uint64_t>(resetRequested ? 1u : 0u));
     NodeGraphHash::combineFloat(hash, contactThermalConductance);
+    NodeGraphHash::combine(hash, static_cast<uint64_t>(clockSettings.mode));
+    NodeGraphHash::combineFloat(hash, clockSettings.fixedDeltaTime);
+    NodeGraphHash::combine(hash, static_cast<uint64_t>(clockSettings.stepsPerSubmission));
+    NodeGraphHash::combine(hash, static_cast<uint64_t>(recordSettings.enabled ? 1u : 0u));
+    NodeGraphHash::combineString(hash, recordSettings.path);
+    NodeGraphHash::combine(hash, static_cast<uint64_t>(recordSettings.stepInterval));
+    NodeGraphHash::combine(hash, static_cast<uint64_t>(solverSettings.mode));
+    NodeGraphHash::combineFloat(hash, solverSettings.residualTolerance);
+    NodeGraphHash::combine(hash, static_cast<uint64_t>(solverSettings.maxIterations));
     NodeGraphHash::combine(hash, static_cast<uint64_t>(materialBindings.size()));
     for (const HeatMaterialBinding& binding : materialBindings) {
         NodeGraphHash::combine(hash, static_cast<uint64_t>(binding.receiverModelNodeId));
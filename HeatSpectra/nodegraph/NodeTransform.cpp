@@ -94,6 +94,8 @@ void NodeTransform::execute(NodeGraphKernelContext& context) const {
             continue;
         }
 
+        // Shares the input's mesh block, so sealing only mixes the new matrix into
+        // the already cached content hash
         GeometryData forwardedGeometry = *inputGeometry;
         forwardedGeometry.localToWorld = NodeModelTransform::toMatrixArray(
             NodeModelTransform::toMat4(forwardedGeometry.localToWorld) *
@@ -66,6 +66,64 @@ NodeHeatSolverPanel::NodeHeatSolverPanel(QWidget* parent)
     heatContactThermalConductanceRow->setValue(16000.0);
     layout->addWidget(heatContactThermalConductanceRow);
 
+    QHBoxLayout* clockModeRow = new QHBoxLayout();
+    clockModeRow->addWidget(new QLabel("Clock Mode:", this));
+    heatClockModeComboBox = new QComboBox(this);
+    heatClockModeComboBox->addItem("Real Time");
+    heatClockModeComboBox->addItem("Fixed Step");
+    heatClockModeComboBox->addItem("As Fast As Possible");
+    clockModeRow->addWidget(heatClockModeComboBox, 1);
+    layout->addLayout(clockModeRow);
+
+    heatFixedTimeStepRow = new NodeGraphSliderRow("Fixed Time Step", this);
+    heatFixedTimeStepRow->setRange(0.0001, 0.1);
+    heatFixedTimeStepRow->setDecimals(4);
+    heatFixedTimeStepRow->setValue(1.0 / 60.0);
+    layout->addWidget(heatFixedTimeStepRow);
+
+    heatStepsPerSubmissionRow = new NodeGraphSliderRow("Steps Per Submission", this);
+    heatStepsPerSubmissionRow->setRange(1.0, static_cast<double>(SimulationClock::MAX_STEPS_PER_SUBMISSION));
+    heatStepsPerSubmissionRow->setDecimals(0);
+    heatStepsPerSubmissionRow->setValue(16.0);
+    layout->addWidget(heatStepsPerSubmissionRow);
+
+    QHBoxLayout* solverModeRow = new QHBoxLayout();
+    solverModeRow->addWidget(new QLabel("Solver:", this));
+    heatSolverModeComboBox = new QComboBox(this);
+    heatSolverModeComboBox->addItem("GPU Substeps");
+    heatSolverModeComboBox->addItem("CPU Jacobi");
+    heatSolverModeComboBox->addItem("CPU Gauss-Seidel");
+    heatSolverModeComboBox->addItem("CPU BiCGSTAB");
+    solverModeRow->addWidget(heatSolverModeComboBox, 1);
+    layout->addLayout(solverModeRow);
+
+    heatSolverToleranceRow = new NodeGraphSliderRow("Solver Tolerance", this);
+    heatSolverToleranceRow->setRange(0.000001, 0.1);
+    heatSolverToleranceRow->setDecimals(6);
+    heatSolverToleranceRow->setValue(1e-4);
+    layout->addWidget(heatSolverToleranceRow);
+
+    heatSolverMaxIterationsRow = new NodeGraphSliderRow("Solver Max Iterations", this);
+    heatSolverMaxIterationsRow->setRange(1.0, 20000.0);
+    heatSolverMaxIterationsRow->setDecimals(0);
+    heatSolverMaxIterationsRow->setValue(500.0);
+    layout->addWidget(heatSolverMaxIterationsRow);
+
+    heatRecordCheckBox = new QCheckBox("Record Temperatures", this);
+    layout->addWidget(heatRecordCheckBox);
+
+    layout->addWidget(new QLabel("Record Path:", this));
+    heatRecordPathLineEdit = new QLineEdit(this);
+    nodegraphwidgets::styleLineEdit(heatRecordPathLineEdit);
+    heatRecordPathLineEdit->setPlaceholderText("temperatures.hstr");
+    layout->addWidget(heatRecordPathLineEdit);
+
+    heatRecordIntervalRow = new NodeGraphSliderRow("Record Interval", this);
+    heatRecordIntervalRow->setRange(1.0, 1000.0);
+    heatRecordIntervalRow->setDecimals(0);
+    heatRecordIntervalRow->setValue(10.0);
+    layout->addWidget(heatRecordIntervalRow);
+
     heatSolveSettingsApplyButton = new QPushButton("Apply Solver Settings", this);
     layout->addWidget(heatSolveSettingsApplyButton);
 
@@ -215,6 +273,15 @@ void NodeHeatSolverPanel::refreshFromNode() {
     heatCellSizeRow->setValue(params.cellSize);
     heatVoxelResolutionRow->setValue(static_cast<double>(params.voxelResolution));
     heatContactThermalConductanceRow->setValue(params.contactThermalConductance);
+    heatClockModeComboBox->setCurrentIndex(std::clamp(params.clockMode, 0, heatClockModeComboBox->count() - 1));
+    heatFixedTimeStepRow->setValue(params.fixedTimeStep);
+    heatStepsPerSubmissionRow->setValue(static_cast<double>(params.stepsPerSubmission));
+    heatSolverModeComboBox->setCurrentIndex(std::clamp(params.solverMode, 0, heatSolverModeComboBox->count() - 1));
+    heatSolverToleranceRow->setValue(params.solverTolerance);
+    heatSolverMaxIterationsRow->setValue(static_cast<double>(params.solverMaxIterations));
+    heatRecordCheckBox->setChecked(params.recordTemperatures);
+    heatRecordPathLineEdit->setText(QString::fromStdString(params.recordPath));
+    heatRecordIntervalRow->setValue(static_cast<double>(params.recordInterval));
     heatOverlayCheckBox->setChecked(params.preview.showHeatOverlay);
 
     const std::vector<HeatMaterialBindingRow>& bindingRows = params.materialBindingRows;
@@ -475,6 +542,15 @@ void NodeHeatSolverPanel::applySolveSettings() {
     params.cellSize = heatCellSizeRow->value();
     params.voxelResolution = static_cast<int>(heatVoxelResolutionRow->value());
     params.contactThermalConductance = heatContactThermalConductanceRow->value();
+    params.clockMode = heatClockModeComboBox->currentIndex();
+    params.fixedTimeStep = heatFixedTimeStepRow->value();
+    params.stepsPerSubmission = static_cast<int>(heatStepsPerSubmissionRow->value());
+    params.solverMode = heatSolverModeComboBox->currentIndex();
+    params.solverTolerance = heatSolverToleranceRow->value();
+    params.solverMaxIterations = static_cast<int>(heatSolverMaxIterationsRow->value());
+    params.recordTemperatures = heatRecordCheckBox->isChecked();
+    params.recordPath = heatRecordPathLineEdit->text().trimmed().toStdString();
+    params.recordInterval = static_cast<int>(heatRecordIntervalRow->value());
     if (!writeNodeParams(params)) {
         setStatus("Failed to update solver settings.");
         return;
@@ -6,6 +6,7 @@
 class QCheckBox;
 class QComboBox;
 class QLabel;
+class QLineEdit;
 class QPushButton;
 class QTableWidget;
 class QTimer;
@@ -45,6 +46,15 @@ private:
     NodeGraphSliderRow* heatCellSizeRow = nullptr;
     NodeGraphSliderRow* heatVoxelResolutionRow = nullptr;
     NodeGraphSliderRow* heatContactThermalConductanceRow = nullptr;
+    QComboBox* heatClockModeComboBox = nullptr;
+    NodeGraphSliderRow* heatFixedTimeStepRow = nullptr;
+    NodeGraphSliderRow* heatStepsPerSubmissionRow = nullptr;
+    QComboBox* heatSolverModeComboBox = nullptr;
+    NodeGraphSliderRow* heatSolverToleranceRow = nullptr;
+    NodeGraphSliderRow* heatSolverMaxIterationsRow = nullptr;
+    QCheckBox* heatRecordCheckBox = nullptr;
+    QLineEdit* heatRecordPathLineEdit = nullptr;
+    NodeGraphSliderRow* heatRecordIntervalRow = nullptr;
     QCheckBox* heatOverlayCheckBox = nullptr;
     QPushButton* heatSolveSettingsApplyButton = nullptr;
     QComboBox* heatBindingGroupComboBox = nullptr;
@@ -2,6 +2,9 @@
 
 #include "vulkan/MemoryAllocator.hpp"
 
+#include <algorithm>
+#include <thread>
+
 RemeshController::OperatingScope::OperatingScope(std::atomic<bool>& isOperating)
     : isOperating(isOperating) {
     previousState = isOperating.exchange(true, std::memory_order_acq_rel);
@@ -19,7 +22,20 @@ RemeshController::RemeshController(
     : vulkanDevice(vulkanDevice),
       resourceManager(resourceManager),
       isOperating(isOperating),
-      remesher(vulkanDevice, memoryAllocator) {
+      remesher(vulkanDevice, memoryAllocator),
+      workerPool(chooseWorkerCount()) {
+    remeshCache.setDirectory(RemeshCache::defaultDirectory());
+}
+
+RemeshController::~RemeshController() {
+    // Cancel running jobs before the pool joins its workers
+    disable();
+    workerPool.shutdown();
+}
+
+uint32_t RemeshController::chooseWorkerCount() {
+    const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+    return std::clamp(hardwareThreads > 1 ? hardwareThreads - 1 : 1u, 1u, MAX_WORKER_COUNT);
 }
 
 void RemeshController::configure(const Config& config) {
@@ -29,7 +45,7 @@ void RemeshController::configure(const Config& config) {
 
     auto& system = activeSystems[config.socketKey];
     if (!system) {
-        system = std::make_unique<RemeshSystem>(remesher, vulkanDevice, resourceManager);
+        system = std::make_unique<RemeshSystem>(remesher, remeshCache, vulkanDevice, resourceManager);
     }
 
     const auto configIt = configuredConfigs.find(config.socketKey);
@@ -42,13 +58,42 @@ void RemeshController::configure(const Config& config) {
     system->setSourceGeometry(config.pointPositions, config.triangleIndices);
     system->setParams(config.iterations, config.minAngleDegrees, config.maxEdgeLength, config.stepSize);
     system->setRuntimeModelId(config.runtimeModelId);
+    system->setCacheKey(buildRemeshCacheKey(config));
 
-    OperatingScope operatingScope(isOperating);
-    if (!system->ensureConfigured() && !system->isReady()) {
+    if (!system->startRemesh(workerPool) && !system->isReady()) {
         activeSystems.erase(config.socketKey);
     }
 }
 
+void RemeshController::poll() {
+    std::vector<uint64_t> failedKeys;
+    for (auto& [socketKey, system] : activeSystems) {
+        if (!system || !system->isRemeshing()) {
+            continue;
+        }
+
+        OperatingScope operatingScope(isOperating);
+        bool succeeded = false;
+        if (system->pollRemesh(succeeded) && !succeeded && !system->isReady()) {
+            failedKeys.push_back(socketKey);
+        }
+    }
+
+    for (uint64_t socketKey : failedKeys) {
+        activeSystems.erase(socketKey);
+    }
+}
+
+bool RemeshController::hasPendingJobs() const {
+    for (const auto& [socketKey, system] : activeSystems) {
+        (void)socketKey;
+        if (system && system->isRemeshing()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void RemeshController::disable(uint64_t socketKey) {
     if (socketKey == 0) {
         return;
@@ -94,3 +139,24 @@ bool RemeshController::exportProduct(uint64_t socketKey, RemeshProduct& outProdu
 
     return systemIt->second->exportProduct(outProduct);
 }
+
+bool RemeshController::isRemeshing(uint64_t socketKey) const {
+    const auto systemIt = activeSystems.find(socketKey);
+    return systemIt != activeSystems.end() && systemIt->second && systemIt->second->isRemeshing();
+}
+
+float RemeshController::getRemeshProgress(uint64_t socketKey) const {
+    const auto systemIt = activeSystems.find(socketKey);
+    if (systemIt == activeSystems.end() || !systemIt->second) {
+        return 0.0f;
+    }
+    return systemIt->second->getRemeshProgress();
+}
+
+uint64_t RemeshController::getPublishedRevision(uint64_t socketKey) const {
+    const auto systemIt = activeSystems.find(socketKey);
+    if (systemIt == activeSystems.end() || !systemIt->second) {
+        return 0;
+    }
+    return systemIt->second->getPublishedRevision();
+}
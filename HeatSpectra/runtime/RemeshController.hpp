@@ -6,9 +6,11 @@
 #include <unordered_map>
 #include <vector>
 
+#include "mesh/remesher/RemeshCache.hpp"
 #include "mesh/remesher/Remesher.hpp"
 #include "runtime/RemeshSystem.hpp"
 #include "runtime/RuntimeProducts.hpp"
+#include "util/WorkerPool.hpp"
 
 class MemoryAllocator;
 class ModelRegistry;
@@ -25,18 +27,34 @@ public:
         float maxEdgeLength = 0.1f;
         float stepSize = 0.25f;
         uint32_t runtimeModelId = 0;
+        // GeometryData::contentHash of the source; when set it stands in for hashing the arrays
+        uint64_t sourceGeometryHash = 0;
         uint64_t computeHash = 0;
     };
 
     RemeshController(VulkanDevice& vulkanDevice, MemoryAllocator& memoryAllocator, ModelRegistry& resourceManager, std::atomic<bool>& isOperating);
+    ~RemeshController();
 
+    // Queues a background remesh when the config changed; the previous product
+    // stays exported until poll() publishes the new one.
     void configure(const Config& config);
+    // Uploads finished remesh jobs on the calling thread.
+    void poll();
     void disable(uint64_t socketKey);
     void disable();
     bool exportProduct(uint64_t socketKey, RemeshProduct& outProduct) const;
 
+    bool isRemeshing(uint64_t socketKey) const;
+    // True while any background job still has to be picked up by poll().
+    bool hasPendingJobs() const;
+    float getRemeshProgress(uint64_t socketKey) const;
+    // Increments each time a new mesh is published for socketKey.
+    uint64_t getPublishedRevision(uint64_t socketKey) const;
+
     Remesher& getRemesher() { return remesher; }
     const Remesher& getRemesher() const { return remesher; }
+    // Set an empty directory to disable the on-disk cache. Applies to jobs started afterwards.
+    RemeshCache& getRemeshCache() { return remeshCache; }
 
 private:
     class OperatingScope {
@@ -49,19 +67,32 @@ private:
         bool previousState = false;
     };
 
+    static constexpr uint32_t MAX_WORKER_COUNT = 2;
+
+    static uint32_t chooseWorkerCount();
+
     VulkanDevice& vulkanDevice;
     ModelRegistry& resourceManager;
     std::atomic<bool>& isOperating;
     Remesher remesher;
+    RemeshCache remeshCache;
+    WorkerPool workerPool;
     std::unordered_map<uint64_t, std::unique_ptr<RemeshSystem>> activeSystems;
     std::unordered_map<uint64_t, Config> configuredConfigs;
 };
 
+inline uint64_t mixRemeshSourceGeometry(uint64_t hash, const RemeshController::Config& config) {
+    if (config.sourceGeometryHash != 0) {
+        return RuntimeProductHash::mix(hash, config.sourceGeometryHash);
+    }
+    hash = RuntimeProductHash::mixPodVector(hash, config.pointPositions);
+    return RuntimeProductHash::mixPodVector(hash, config.triangleIndices);
+}
+
 inline uint64_t buildComputeHash(const RemeshController::Config& config) {
     uint64_t hash = 1469598103934665603ull;
     hash = RuntimeProductHash::mixPod(hash, config.socketKey);
-    hash = RuntimeProductHash::mixPodVector(hash, config.pointPositions);
-    hash = RuntimeProductHash::mixPodVector(hash, config.triangleIndices);
+    hash = mixRemeshSourceGeometry(hash, config);
     hash = RuntimeProductHash::mixPod(hash, config.iterations);
     hash = RuntimeProductHash::mixPod(hash, config.minAngleDegrees);
     hash = RuntimeProductHash::mixPod(hash, config.maxEdgeLength);
@@ -69,3 +100,16 @@ inline uint64_t buildComputeHash(const RemeshController::Config& config) {
     hash = RuntimeProductHash::mixPod(hash, config.runtimeModelId);
     return hash;
 }
+
+// Content key for RemeshCache. Unlike buildComputeHash it leaves out the socket and
+// runtime model ids, which differ between sessions for the same geometry.
+inline uint64_t buildRemeshCacheKey(const RemeshController::Config& config) {
+    uint64_t hash = 1469598103934665603ull;
+    hash = RuntimeProductHash::mixPod(hash, RemeshCache::ALGORITHM_VERSION);
+    hash = mixRemeshSourceGeometry(hash, config);
+    hash = RuntimeProductHash::mixPod(hash, config.iterations);
+    hash = RuntimeProductHash::mixPod(hash, config.minAngleDegrees);
+    hash = RuntimeProductHash::mixPod(hash, config.maxEdgeLength);
+    hash = RuntimeProductHash::mixPod(hash, config.stepSize);
+    return hash;
+}
@@ -1,5 +1,6 @@
 #include "RemeshSystem.hpp"
 
+#include "util/WorkerPool.hpp"
 #include "vulkan/MemoryAllocator.hpp"
 #include "vulkan/ModelRegistry.hpp"
 #include "vulkan/VulkanDevice.hpp"
@@ -22,11 +23,13 @@ std::vector<glm::vec3> buildGeometryPositions(const std::vector<float>& pointPos
 
 RemeshSystem::RemeshSystem(
     Remesher& remesher,
+    const RemeshCache& remeshCache,
     VulkanDevice& vulkanDevice,
     ModelRegistry& resourceManager)
     : vulkanDevice(vulkanDevice),
       resourceManager(resourceManager),
-      remesher(remesher) {
+      remesher(remesher),
+      remeshCache(remeshCache) {
 }
 
 RemeshSystem::~RemeshSystem() {
@@ -49,37 +52,111 @@ void RemeshSystem::setRuntimeModelId(uint32_t nextRuntimeModelId) {
     runtimeModelId = nextRuntimeModelId;
 }
 
-bool RemeshSystem::ensureConfigured() {
-    resetState(true);
+void RemeshSystem::setCacheKey(uint64_t nextCacheKey) {
+    cacheKey = nextCacheKey;
+}
 
-    RemeshResult remeshResult{};
-    if (!remesher.remesh(
-            pointPositions,
-            triangleIndices,
-            iterations,
-            minAngleDegrees,
-            maxEdgeLength,
-            stepSize,
-            remeshResult)) {
+bool RemeshSystem::startRemesh(WorkerPool& workerPool) {
+    cancelRemesh();
+    if (pointPositions.empty() || triangleIndices.empty()) {
         return false;
     }
 
+    auto nextJob = std::make_shared<RemeshJob>();
+    nextJob->pointPositions = pointPositions;
+    nextJob->triangleIndices = triangleIndices;
+    nextJob->iterations = iterations;
+    nextJob->minAngleDegrees = minAngleDegrees;
+    nextJob->maxEdgeLength = maxEdgeLength;
+    nextJob->stepSize = stepSize;
+    nextJob->runtimeModelId = runtimeModelId;
+    nextJob->cache = remeshCache;
+    nextJob->cacheKey = cacheKey;
+
+    job = nextJob;
+    workerPool.submit([nextJob]() {
+        if (!nextJob->control.isCancelled()) {
+            RemeshCache::Params params{};
+            params.iterations = nextJob->iterations;
+            params.minAngleDegrees = nextJob->minAngleDegrees;
+            params.maxEdgeLength = nextJob->maxEdgeLength;
+            params.stepSize = nextJob->stepSize;
+
+            if (nextJob->cache.load(nextJob->cacheKey, nextJob->pointPositions, nextJob->triangleIndices, params, nextJob->geometry)) {
+                nextJob->succeeded = true;
+            } else {
+                nextJob->succeeded = Remesher::remeshGeometry(
+                    nextJob->pointPositions,
+                    nextJob->triangleIndices,
+                    nextJob->iterations,
+                    nextJob->minAngleDegrees,
+                    nextJob->maxEdgeLength,
+                    nextJob->stepSize,
+                    &nextJob->control,
+                    nextJob->geometry);
+                if (nextJob->succeeded) {
+                    nextJob->cache.store(nextJob->cacheKey, nextJob->pointPositions, nextJob->triangleIndices, params, nextJob->geometry);
+                }
+            }
+        }
+        nextJob->finished.store(true, std::memory_order_release);
+    });
+    return true;
+}
+
+bool RemeshSystem::pollRemesh(bool& outSucceeded) {
+    outSucceeded = false;
+    if (!job || !job->finished.load(std::memory_order_acquire)) {
+        return false;
+    }
+
+    const std::shared_ptr<RemeshJob> finishedJob = std::move(job);
+    job.reset();
+    if (!finishedJob->succeeded) {
+        return true;
+    }
+
+    RemeshResult remeshResult{};
+    if (!remesher.uploadGeometry(finishedJob->geometry, remeshResult)) {
+        return true;
+    }
+
     if (remeshResult.intrinsicGpuResources.viewS == VK_NULL_HANDLE ||
         remeshResult.intrinsicGpuResources.intrinsicTriangleBuffer == VK_NULL_HANDLE ||
         remeshResult.intrinsicGpuResources.intrinsicVertexBuffer == VK_NULL_HANDLE) {
         remesher.cleanupGpuResources(remeshResult.intrinsicGpuResources);
-        return false;
+        return true;
     }
 
-    geometryPositions = buildGeometryPositions(pointPositions);
-    geometryTriangleIndices = triangleIndices;
-    intrinsicMesh = remeshResult.intrinsicMesh;
+    // The previous buffers stay bound until here, so consumers never see a partial mesh
+    resetState(true);
+    geometryPositions = buildGeometryPositions(finishedJob->pointPositions);
+    geometryTriangleIndices = std::move(finishedJob->triangleIndices);
+    intrinsicMesh = std::move(remeshResult.intrinsicMesh);
     intrinsicGpuResources = remeshResult.intrinsicGpuResources;
+    publishedRuntimeModelId = finishedJob->runtimeModelId;
     ready = true;
+    ++publishedRevision;
+    outSucceeded = true;
     return true;
 }
 
+void RemeshSystem::cancelRemesh() {
+    if (job) {
+        job->control.cancelRequested.store(true, std::memory_order_relaxed);
+        job.reset();
+    }
+}
+
+float RemeshSystem::getRemeshProgress() const {
+    if (!job) {
+        return ready ? 1.0f : 0.0f;
+    }
+    return job->control.progress.load(std::memory_order_relaxed);
+}
+
 void RemeshSystem::disable() {
+    cancelRemesh();
     resetState(true);
 }
 
@@ -90,7 +167,7 @@ bool RemeshSystem::exportProduct(RemeshProduct& outProduct) const {
         return false;
     }
 
-    outProduct.runtimeModelId = runtimeModelId;
+    outProduct.runtimeModelId = publishedRuntimeModelId;
     outProduct.geometryPositions = geometryPositions;
     outProduct.geometryTriangleIndices = geometryTriangleIndices;
     outProduct.intrinsicMesh = intrinsicMesh;
@@ -124,5 +201,6 @@ void RemeshSystem::resetState(bool waitForDevice) {
     geometryPositions.clear();
     geometryTriangleIndices.clear();
     intrinsicMesh = {};
+    publishedRuntimeModelId = 0;
     ready = false;
 }
@@ -1,20 +1,25 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 #include <glm/vec3.hpp>
 
+#include "mesh/remesher/RemeshCache.hpp"
 #include "mesh/remesher/Remesher.hpp"
 #include "runtime/RuntimeProducts.hpp"
 
 class ModelRegistry;
 class VulkanDevice;
+class WorkerPool;
 
 class RemeshSystem {
 public:
     RemeshSystem(
         Remesher& remesher,
+        const RemeshCache& remeshCache,
         VulkanDevice& vulkanDevice,
         ModelRegistry& resourceManager);
     ~RemeshSystem();
@@ -22,17 +27,47 @@ public:
     void setSourceGeometry(const std::vector<float>& pointPositions, const std::vector<uint32_t>& triangleIndices);
     void setParams(int iterations, float minAngleDegrees, float maxEdgeLength, float stepSize);
     void setRuntimeModelId(uint32_t runtimeModelId);
-    bool ensureConfigured();
+    void setCacheKey(uint64_t cacheKey);
+
+    // Snapshots the current geometry and params into a job on workerPool, cancelling
+    // any job still in flight. The last published mesh stays exported meanwhile.
+    bool startRemesh(WorkerPool& workerPool);
+    // Uploads and publishes a finished job on the calling thread. Returns true when
+    // a job completed this call, whether or not it succeeded.
+    bool pollRemesh(bool& outSucceeded);
+    void cancelRemesh();
+    bool isRemeshing() const { return job != nullptr; }
+    float getRemeshProgress() const;
+    uint64_t getPublishedRevision() const { return publishedRevision; }
+
     void disable();
     bool exportProduct(RemeshProduct& outProduct) const;
     bool isReady() const { return ready; }
 
 private:
+    struct RemeshJob {
+        RemeshJobControl control;
+        std::atomic<bool> finished{false};
+        bool succeeded = false;
+
+        std::vector<float> pointPositions;
+        std::vector<uint32_t> triangleIndices;
+        int iterations = 1;
+        float minAngleDegrees = 20.0f;
+        float maxEdgeLength = 0.1f;
+        float stepSize = 0.25f;
+        uint32_t runtimeModelId = 0;
+        RemeshCache cache;
+        uint64_t cacheKey = 0;
+        RemeshGeometry geometry;
+    };
+
     void resetState(bool waitForDevice);
 
     VulkanDevice& vulkanDevice;
     ModelRegistry& resourceManager;
     Remesher& remesher;
+    const RemeshCache& remeshCache;
 
     std::vector<float> pointPositions;
     std::vector<uint32_t> triangleIndices;
@@ -41,9 +76,15 @@ private:
     float maxEdgeLength = 0.1f;
     float stepSize = 0.25f;
     uint32_t runtimeModelId = 0;
+    uint32_t publishedRuntimeModelId = 0;
+    uint64_t cacheKey = 0;
     std::vector<glm::vec3> geometryPositions;
     std::vector<uint32_t> geometryTriangleIndices;
     SupportingHalfedge::IntrinsicMesh intrinsicMesh;
     SupportingHalfedge::GPUResources intrinsicGpuResources;
     bool ready = false;
+    uint64_t publishedRevision = 0;
+
+    // Shared with the worker task so a cancelled job can finish after being dropped here
+    std::shared_ptr<RemeshJob> job;
 };
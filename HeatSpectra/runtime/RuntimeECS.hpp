@@ -74,6 +74,28 @@ ProductHandle getPublishedHandle(const ECSRegistry& registry, uint64_t outputSoc
     return handle;
 }
 
+template <typename ProductT>
+void accumulateProductSignature(const ECSRegistry& registry, uint64_t& signature) {
+    for (auto entity : registry.view<ProductT>()) {
+        uint64_t hash = RuntimeProductHash::mix(1469598103934665603ull, static_cast<uint64_t>(productTypeFor<ProductT>()));
+        hash = RuntimeProductHash::mix(hash, static_cast<uint64_t>(entity));
+        hash = RuntimeProductHash::mix(hash, registry.get<ProductT>(entity).productHash);
+        signature += hash;
+    }
+}
+
+// Order-independent digest of every published product; it changes whenever a
+// product is published, replaced or removed
+inline uint64_t buildProductSignature(const ECSRegistry& registry) {
+    uint64_t signature = 0;
+    accumulateProductSignature<ModelProduct>(registry, signature);
+    accumulateProductSignature<RemeshProduct>(registry, signature);
+    accumulateProductSignature<VoronoiProduct>(registry, signature);
+    accumulateProductSignature<ContactProduct>(registry, signature);
+    accumulateProductSignature<HeatProduct>(registry, signature);
+    return signature;
+}
+
 inline std::unordered_set<ECSEntity> collectPackageEntities(const ECSRegistry& registry) {
     std::unordered_set<ECSEntity> entities;
     for (auto entity : registry.view<ModelPackage>()) entities.insert(entity);
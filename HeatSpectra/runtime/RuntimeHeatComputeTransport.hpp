@@ -103,6 +103,9 @@ private:
         outConfig.paused = package.authored.paused;
         outConfig.resetRequested = package.authored.resetRequested;
         outConfig.contactThermalConductance = package.authored.contactThermalConductance;
+        outConfig.clockSettings = package.authored.clockSettings;
+        outConfig.recordSettings = package.authored.recordSettings;
+        outConfig.solverSettings = package.authored.solverSettings;
         outConfig.sourceIntrinsicMeshes.reserve(package.sourceRemeshProducts.size());
         outConfig.sourceRuntimeModelIds.reserve(package.sourceRemeshProducts.size());
 
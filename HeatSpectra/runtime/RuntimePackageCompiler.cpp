@@ -459,27 +459,40 @@ ContactPackage RuntimePackageCompiler::buildContactPackage(
 }
 
 template <typename PackageT>
-void RuntimePackageCompiler::applyPackage(ECSRegistry& registry, uint64_t socketKey, const PackageT& pkg, std::unordered_set<ECSEntity>& staleEntities) {
+bool RuntimePackageCompiler::applyPackage(ECSRegistry& registry, uint64_t socketKey, const PackageT& pkg, std::unordered_set<ECSEntity>& staleEntities) {
     auto entity = static_cast<ECSEntity>(socketKey);
     if (!registry.valid(entity)) {
         static_cast<void>(registry.create(entity));
     }
+    staleEntities.erase(entity);
     if (registry.all_of<PackageT>(entity)) {
-        if (!registry.get<PackageT>(entity).matches(pkg)) {
-            registry.replace<PackageT>(entity, pkg);
+        if (registry.get<PackageT>(entity).matches(pkg)) {
+            return false;
         }
+        registry.replace<PackageT>(entity, pkg);
     } else {
         registry.emplace<PackageT>(entity, pkg);
     }
-    staleEntities.erase(entity);
+    return true;
 }
 
-void RuntimePackageCompiler::compileAndApply(
+uint32_t RuntimePackageCompiler::compileAndApply(
     const NodeGraphState& graphState,
     const NodeGraphEvaluationState& evaluationState,
     const NodePayloadRegistry* payloadRegistry,
     ECSRegistry& registry,
-    std::unordered_set<ECSEntity>& staleEntities) const {
+    uint64_t productSignature,
+    std::unordered_set<ECSEntity>& staleEntities) {
+    uint32_t touchedPackageTypes = 0;
+
+    // Node parameters and edges feed package builders directly, so any authored
+    // change invalidates every cached signature
+    if (!hasCompiled || graphState.revision != compiledRevision) {
+        inputSignatureBySocket.clear();
+    }
+
+    std::unordered_map<uint64_t, uint64_t> nextInputSignatureBySocket;
+    nextInputSignatureBySocket.reserve(inputSignatureBySocket.size());
 
     for (const NodeGraphNode& node : graphState.nodes) {
         for (const NodeGraphSocket& output : node.outputs) {
@@ -492,6 +505,24 @@ void RuntimePackageCompiler::compileAndApply(
                 continue;
             }
 
+            // Payload handles get a new revision whenever a node re-executes; every
+            // package other than Model also resolves published products
+            uint64_t inputSignature = NodeGraphHash::start();
+            NodeGraphHash::combine(inputSignature, static_cast<uint64_t>(output.contract.producedPayloadType));
+            NodeGraphHash::combine(inputSignature, outputValue->block->payloadHandle.key);
+            NodeGraphHash::combine(inputSignature, outputValue->block->payloadHandle.revision);
+            if (output.contract.producedPayloadType != NodePayloadType::Geometry) {
+                NodeGraphHash::combine(inputSignature, productSignature);
+            }
+            nextInputSignatureBySocket[outputValue->socketKey] = inputSignature;
+
+            const auto signatureIt = inputSignatureBySocket.find(outputValue->socketKey);
+            if (signatureIt != inputSignatureBySocket.end() && signatureIt->second == inputSignature) {
+                staleEntities.erase(static_cast<ECSEntity>(outputValue->socketKey));
+                continue;
+            }
+
+            const uint32_t typeBit = packageTypeBit(output.contract.producedPayloadType);
             switch (output.contract.producedPayloadType) {
             case NodePayloadType::Geometry: {
                 const GeometryData* geometry = resolvePayload<GeometryData>(payloadRegistry, outputValue);
@@ -500,7 +531,9 @@ void RuntimePackageCompiler::compileAndApply(
                 }
 
                 ModelPackage package = buildModelPackage(*geometry);
-                applyPackage<ModelPackage>(registry, outputValue->socketKey, package, staleEntities);
+                if (applyPackage<ModelPackage>(registry, outputValue->socketKey, package, staleEntities)) {
+                    touchedPackageTypes |= typeBit;
+                }
                 break;
             }
             case NodePayloadType::Remesh: {
@@ -511,7 +544,9 @@ void RuntimePackageCompiler::compileAndApply(
 
                 RemeshPackage package =
                     buildRemeshPackage(node, *remesh, payloadRegistry, registry, outputValue->block->payloadHandle);
-                applyPackage<RemeshPackage>(registry, outputValue->socketKey, package, staleEntities);
+                if (applyPackage<RemeshPackage>(registry, outputValue->socketKey, package, staleEntities)) {
+                    touchedPackageTypes |= typeBit;
+                }
                 break;
             }
             case NodePayloadType::Voronoi: {
@@ -521,7 +556,9 @@ void RuntimePackageCompiler::compileAndApply(
                 }
 
                 VoronoiPackage package = buildVoronoiPackage(node, payloadRegistry, registry, *voronoi);
-                applyPackage<VoronoiPackage>(registry, outputValue->socketKey, package, staleEntities);
+                if (applyPackage<VoronoiPackage>(registry, outputValue->socketKey, package, staleEntities)) {
+                    touchedPackageTypes |= typeBit;
+                }
                 break;
             }
             case NodePayloadType::Contact: {
@@ -531,7 +568,9 @@ void RuntimePackageCompiler::compileAndApply(
                 }
 
                 ContactPackage package = buildContactPackage(node, payloadRegistry, registry, *contact);
-                applyPackage<ContactPackage>(registry, outputValue->socketKey, package, staleEntities);
+                if (applyPackage<ContactPackage>(registry, outputValue->socketKey, package, staleEntities)) {
+                    touchedPackageTypes |= typeBit;
+                }
                 break;
             }
             case NodePayloadType::Heat: {
@@ -551,7 +590,9 @@ void RuntimePackageCompiler::compileAndApply(
                     *heat,
                     voronoiProduct,
                     contactProduct);
-                applyPackage<HeatPackage>(registry, outputValue->socketKey, package, staleEntities);
+                if (applyPackage<HeatPackage>(registry, outputValue->socketKey, package, staleEntities)) {
+                    touchedPackageTypes |= typeBit;
+                }
                 break;
             }
             default:
@@ -559,4 +600,9 @@ void RuntimePackageCompiler::compileAndApply(
             }
         }
     }
+
+    inputSignatureBySocket = std::move(nextInputSignatureBySocket);
+    compiledRevision = graphState.revision;
+    hasCompiled = true;
+    return touchedPackageTypes;
 }
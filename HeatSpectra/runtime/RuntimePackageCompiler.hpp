@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "domain/HeatData.hpp"
 #include "nodegraph/NodeGraphProductTypes.hpp"
@@ -41,16 +43,29 @@ public:
         const ECSRegistry& registry,
         const ContactData& contact) const;
 
-    void compileAndApply(
+    static uint32_t packageTypeBit(NodePayloadType type) {
+        return 1u << static_cast<uint32_t>(type);
+    }
+
+    // Rebuilds only the packages whose output payload handle or upstream products
+    // changed since the previous call. A graph revision change rebuilds them all.
+    // productSignature is buildProductSignature(registry) for the current products.
+    // Returns the packageTypeBit of each package type that was emplaced or replaced.
+    uint32_t compileAndApply(
         const NodeGraphState& graphState,
         const NodeGraphEvaluationState& evaluationState,
         const NodePayloadRegistry* payloadRegistry,
         ECSRegistry& registry,
-        std::unordered_set<ECSEntity>& staleEntities) const;
+        uint64_t productSignature,
+        std::unordered_set<ECSEntity>& staleEntities);
 
 private:
+    // Returns true when the component was emplaced or replaced
     template <typename PackageT>
-    static void applyPackage(ECSRegistry& registry, uint64_t socketKey, const PackageT& pkg, std::unordered_set<ECSEntity>& staleEntities);
+    static bool applyPackage(ECSRegistry& registry, uint64_t socketKey, const PackageT& pkg, std::unordered_set<ECSEntity>& staleEntities);
 
     const NodeGraphRuntimeBridge* runtimeBridge = nullptr;
+    bool hasCompiled = false;
+    uint64_t compiledRevision = 0;
+    std::unordered_map<uint64_t, uint64_t> inputSignatureBySocket;
 };
@@ -14,6 +14,7 @@
 #include "nodegraph/NodeGraphCoreTypes.hpp"
 #include "contact/ContactTypes.hpp"
 #include "voronoi/VoronoiGpuStructs.hpp"
+#include "util/ContentHash.hpp"
 
 namespace RuntimeProductHash {
 
@@ -23,11 +24,7 @@ inline uint64_t mix(uint64_t hash, uint64_t value) {
 }
 
 inline uint64_t mixBytes(uint64_t hash, const void* data, size_t size) {
-    const auto* bytes = static_cast<const unsigned char*>(data);
-    for (size_t index = 0; index < size; ++index) {
-        hash = mix(hash, static_cast<uint64_t>(bytes[index]));
-    }
-    return hash;
+    return mix(hash, ContentHash::hashBytes(data, size, hash));
 }
 
 template <typename T>
@@ -22,6 +22,8 @@ public:
             return;
         }
 
+        controller->poll();
+
         std::unordered_set<uint64_t> nextSocketKeys;
 
         auto view = registry.view<RemeshPackage>();
@@ -35,6 +37,10 @@ public:
             if (product && hashIt != appliedPackageHash.end() && hashIt->second == package.packageHash) {
                 continue;
             }
+            auto queuedIt = queuedPackageHash.find(socketKey);
+            if (queuedIt != queuedPackageHash.end() && queuedIt->second == package.packageHash && controller->isRemeshing(socketKey)) {
+                continue;
+            }
 
             RemeshController::Config config{};
             if (!tryBuildConfig(socketKey, package, config)) {
@@ -42,6 +48,7 @@ public:
             }
 
             controller->configure(config);
+            queuedPackageHash[socketKey] = package.packageHash;
             nextSocketKeys.insert(socketKey);
         }
 
@@ -49,12 +56,18 @@ public:
             if (nextSocketKeys.find(socketKey) == nextSocketKeys.end()) {
                 controller->disable(socketKey);
                 appliedPackageHash.erase(socketKey);
+                appliedRevision.erase(socketKey);
+                queuedPackageHash.erase(socketKey);
             }
         }
 
         activeSocketKeys = std::move(nextSocketKeys);
     }
 
+    bool hasPendingWork() const {
+        return controller && controller->hasPendingJobs();
+    }
+
     void finalizeSync() {
         if (!controller) {
             return;
@@ -76,7 +89,13 @@ public:
             const auto& package = ecsRegistry->get<RemeshPackage>(entity);
             auto hashIt = appliedPackageHash.find(socketKey);
             const RemeshProduct* product = tryGetProduct<RemeshProduct>(*ecsRegistry, socketKey);
-            if (!product || hashIt == appliedPackageHash.end() || hashIt->second != package.packageHash) {
+            auto revisionIt = appliedRevision.find(socketKey);
+            const bool revisionChanged = revisionIt == appliedRevision.end() ||
+                revisionIt->second != controller->getPublishedRevision(socketKey);
+            const bool stale = hashIt == appliedPackageHash.end() || hashIt->second != package.packageHash;
+            // A running job will bump the revision when it lands; until then the
+            // previous mesh stays published under its own package hash
+            if (!product || revisionChanged || (stale && !controller->isRemeshing(socketKey))) {
                 publishProduct(socketKey);
             }
         }
@@ -90,8 +109,9 @@ private:
 
         outConfig = {};
         outConfig.socketKey = socketKey;
-        outConfig.pointPositions = package.sourceGeometry.pointPositions;
-        outConfig.triangleIndices = package.sourceGeometry.triangleIndices;
+        outConfig.pointPositions = package.sourceGeometry.pointPositions();
+        outConfig.triangleIndices = package.sourceGeometry.triangleIndices();
+        outConfig.sourceGeometryHash = package.sourceGeometry.contentHash;
         outConfig.iterations = package.iterations;
         outConfig.minAngleDegrees = package.minAngleDegrees;
         outConfig.maxEdgeLength = package.maxEdgeLength;
@@ -125,13 +145,25 @@ private:
         }
 
         auto entity = static_cast<ECSEntity>(socketKey);
-        const auto& package = ecsRegistry->get<RemeshPackage>(entity);
         ecsRegistry->emplace_or_replace<RemeshProduct>(entity, product);
-        appliedPackageHash[socketKey] = package.packageHash;
+        appliedRevision[socketKey] = controller->getPublishedRevision(socketKey);
+
+        // The exported mesh only belongs to the queued package once its job is done
+        if (!controller->isRemeshing(socketKey)) {
+            auto queuedIt = queuedPackageHash.find(socketKey);
+            if (queuedIt != queuedPackageHash.end()) {
+                appliedPackageHash[socketKey] = queuedIt->second;
+            } else {
+                appliedPackageHash[socketKey] = ecsRegistry->get<RemeshPackage>(entity).packageHash;
+            }
+        }
     }
 
     RemeshController* controller = nullptr;
     ECSRegistry* ecsRegistry = nullptr;
     std::unordered_set<uint64_t> activeSocketKeys;
     std::unordered_map<uint64_t, uint64_t> appliedPackageHash;
+    // Remesh jobs finish after their package was applied; a new revision republishes
+    std::unordered_map<uint64_t, uint64_t> appliedRevision;
+    std::unordered_map<uint64_t, uint64_t> queuedPackageHash;
 };
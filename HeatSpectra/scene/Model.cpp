@@ -27,6 +27,7 @@ bool Model::init(const std::string modelPath) {
     createIndexBuffer();
     createRenderVertexBuffer();
     createRenderIndexBuffer();
+    commandPool.uploads().publish();
     return true;
 }
 
@@ -47,6 +48,7 @@ void Model::recreateBuffers() {
     createIndexBuffer();
     createRenderVertexBuffer();
     createRenderIndexBuffer();
+    commandPool.uploads().publish();
 }
 
 std::array<glm::vec3, 8> Model::calculateBoundingBox(const std::vector<Vertex>& vertices, glm::vec3& minBound, glm::vec3& maxBound) {
@@ -236,15 +238,6 @@ void Model::createVertexBuffer() {
 
     VkDeviceSize bufferSize = sizeof(vertices[0]) * vertices.size();
 
-    auto [stagingBuffer, stagingOffset] = memoryAllocator.allocate(
-        bufferSize, 
-        VK_BUFFER_USAGE_TRANSFER_SRC_BIT, 
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
-    );
-
-    void* stagingData = memoryAllocator.getMappedPointer(stagingBuffer, stagingOffset);
-    memcpy(stagingData, vertices.data(), static_cast<size_t>(bufferSize));
-
     auto [vertexBufferHandle, vertexBufferOffset] = memoryAllocator.allocate(
         bufferSize,
         VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
@@ -252,8 +245,7 @@ void Model::createVertexBuffer() {
         vulkanDevice.getPhysicalDeviceProperties().limits.minUniformBufferOffsetAlignment
     );
 
-    commandPool.copyBuffer(stagingBuffer, stagingOffset, vertexBufferHandle, vertexBufferOffset, bufferSize);
-    memoryAllocator.free(stagingBuffer, stagingOffset);
+    uploadTicket = commandPool.uploads().enqueueBufferCopy(vertices.data(), bufferSize, vertexBufferHandle, vertexBufferOffset);
 
     vertexBuffer = vertexBufferHandle;
     vertexBufferOffset_ = vertexBufferOffset; 
@@ -268,15 +260,6 @@ void Model::createIndexBuffer() {
 
     VkDeviceSize bufferSize = sizeof(indices[0]) * indices.size();
 
-    auto [stagingBuffer, stagingOffset] = memoryAllocator.allocate(
-        bufferSize,
-        VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
-    );
-
-    void* stagingData = memoryAllocator.getMappedPointer(stagingBuffer, stagingOffset);
-    memcpy(stagingData, indices.data(), static_cast<size_t>(bufferSize));
-
     auto [indexBufferHandle, indexBufferOffset] = memoryAllocator.allocate(
         bufferSize,
         VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
@@ -284,8 +267,7 @@ void Model::createIndexBuffer() {
         vulkanDevice.getPhysicalDeviceProperties().limits.minStorageBufferOffsetAlignment
     );
 
-    commandPool.copyBuffer(stagingBuffer, stagingOffset, indexBufferHandle, indexBufferOffset, bufferSize);
-    memoryAllocator.free(stagingBuffer, stagingOffset);
+    uploadTicket = commandPool.uploads().enqueueBufferCopy(indices.data(), bufferSize, indexBufferHandle, indexBufferOffset);
 
     indexBuffer = indexBufferHandle;
     indexBufferOffset_ = indexBufferOffset;
@@ -300,15 +282,6 @@ void Model::createRenderVertexBuffer() {
 
     VkDeviceSize bufferSize = sizeof(renderVertices[0]) * renderVertices.size();
 
-    auto [stagingBuffer, stagingOffset] = memoryAllocator.allocate(
-        bufferSize,
-        VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
-    );
-
-    void* stagingData = memoryAllocator.getMappedPointer(stagingBuffer, stagingOffset);
-    memcpy(stagingData, renderVertices.data(), static_cast<size_t>(bufferSize));
-
     auto [bufferHandle, bufferOffset] = memoryAllocator.allocate(
         bufferSize,
         VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
@@ -316,8 +289,7 @@ void Model::createRenderVertexBuffer() {
         vulkanDevice.getPhysicalDeviceProperties().limits.minUniformBufferOffsetAlignment
     );
 
-    commandPool.copyBuffer(stagingBuffer, stagingOffset, bufferHandle, bufferOffset, bufferSize);
-    memoryAllocator.free(stagingBuffer, stagingOffset);
+    uploadTicket = commandPool.uploads().enqueueBufferCopy(renderVertices.data(), bufferSize, bufferHandle, bufferOffset);
 
     renderVertexBuffer = bufferHandle;
     renderVertexBufferOffset_ = bufferOffset;
@@ -332,15 +304,6 @@ void Model::createRenderIndexBuffer() {
 
     VkDeviceSize bufferSize = sizeof(renderIndices[0]) * renderIndices.size();
 
-    auto [stagingBuffer, stagingOffset] = memoryAllocator.allocate(
-        bufferSize,
-        VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
-    );
-
-    void* stagingData = memoryAllocator.getMappedPointer(stagingBuffer, stagingOffset);
-    memcpy(stagingData, renderIndices.data(), static_cast<size_t>(bufferSize));
-
     auto [bufferHandle, bufferOffset] = memoryAllocator.allocate(
         bufferSize,
         VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
@@ -348,8 +311,7 @@ void Model::createRenderIndexBuffer() {
         vulkanDevice.getPhysicalDeviceProperties().limits.minStorageBufferOffsetAlignment
     );
 
-    commandPool.copyBuffer(stagingBuffer, stagingOffset, bufferHandle, bufferOffset, bufferSize);
-    memoryAllocator.free(stagingBuffer, stagingOffset);
+    uploadTicket = commandPool.uploads().enqueueBufferCopy(renderIndices.data(), bufferSize, bufferHandle, bufferOffset);
 
     renderIndexBuffer = bufferHandle;
     renderIndexBufferOffset_ = bufferOffset;
@@ -422,6 +384,7 @@ void Model::updateGeometry(const std::vector<Vertex>& newVertices, const std::ve
     updateIndexBuffer();
     updateRenderVertexBuffer();
     updateRenderIndexBuffer();
+    commandPool.uploads().publish();
 }
 
 void Model::translate(const glm::vec3& translation) {    
@@ -451,22 +414,7 @@ void Model::updateVertexBuffer() {
 
     VkDeviceSize bufferSize = sizeof(vertices[0]) * vertices.size();
 
-    // Create a staging buffer
-    auto [stagingBuffer, stagingOffset] = memoryAllocator.allocate(
-        bufferSize,
-        VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
-    );
-
-    // Copy data to staging buffer
-    void* stagingData = memoryAllocator.getMappedPointer(stagingBuffer, stagingOffset);
-    memcpy(stagingData, vertices.data(), static_cast<size_t>(bufferSize));
-
-    // Copy from staging buffer to vertex buffer
-    commandPool.copyBuffer(stagingBuffer, stagingOffset, vertexBuffer, vertexBufferOffset_, bufferSize);
-
-    // Free staging buffer
-    memoryAllocator.free(stagingBuffer, stagingOffset);
+    uploadTicket = commandPool.uploads().enqueueBufferCopy(vertices.data(), bufferSize, vertexBuffer, vertexBufferOffset_);
 }
 
 void Model::updateIndexBuffer() {
@@ -476,22 +424,7 @@ void Model::updateIndexBuffer() {
 
     VkDeviceSize bufferSize = sizeof(indices[0]) * indices.size();
 
-    // Create a staging buffer
-    auto [stagingBuffer, stagingOffset] = memoryAllocator.allocate(
-        bufferSize,
-        VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
-    );
-
-    // Copy data to staging buffer
-    void* stagingData = memoryAllocator.getMappedPointer(stagingBuffer, stagingOffset);
-    memcpy(stagingData, indices.data(), static_cast<size_t>(bufferSize));
-
-    // Copy from staging buffer to index buffer
-    commandPool.copyBuffer(stagingBuffer, stagingOffset, indexBuffer, indexBufferOffset_, bufferSize);
-
-    // Free staging buffer
-    memoryAllocator.free(stagingBuffer, stagingOffset);
+    uploadTicket = commandPool.uploads().enqueueBufferCopy(indices.data(), bufferSize, indexBuffer, indexBufferOffset_);
 }
 
 void Model::updateRenderVertexBuffer() {
@@ -501,17 +434,7 @@ void Model::updateRenderVertexBuffer() {
 
     VkDeviceSize bufferSize = sizeof(renderVertices[0]) * renderVertices.size();
 
-    auto [stagingBuffer, stagingOffset] = memoryAllocator.allocate(
-        bufferSize,
-        VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
-    );
-
-    void* stagingData = memoryAllocator.getMappedPointer(stagingBuffer, stagingOffset);
-    memcpy(stagingData, renderVertices.data(), static_cast<size_t>(bufferSize));
-
-    commandPool.copyBuffer(stagingBuffer, stagingOffset, renderVertexBuffer, renderVertexBufferOffset_, bufferSize);
-    memoryAllocator.free(stagingBuffer, stagingOffset);
+    uploadTicket = commandPool.uploads().enqueueBufferCopy(renderVertices.data(), bufferSize, renderVertexBuffer, renderVertexBufferOffset_);
 }
 
 void Model::updateRenderIndexBuffer() {
@@ -521,17 +444,7 @@ void Model::updateRenderIndexBuffer() {
 
     VkDeviceSize bufferSize = sizeof(renderIndices[0]) * renderIndices.size();
 
-    auto [stagingBuffer, stagingOffset] = memoryAllocator.allocate(
-        bufferSize,
-        VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
-    );
-
-    void* stagingData = memoryAllocator.getMappedPointer(stagingBuffer, stagingOffset);
-    memcpy(stagingData, renderIndices.data(), static_cast<size_t>(bufferSize));
-
-    commandPool.copyBuffer(stagingBuffer, stagingOffset, renderIndexBuffer, renderIndexBufferOffset_, bufferSize);
-    memoryAllocator.free(stagingBuffer, stagingOffset);
+    uploadTicket = commandPool.uploads().enqueueBufferCopy(renderIndices.data(), bufferSize, renderIndexBuffer, renderIndexBufferOffset_);
 }
 
 void Model::saveOBJ(const std::string& path) const {
@@ -548,6 +461,10 @@ void Model::saveOBJ(const std::string& path) const {
 }
 
 void Model::cleanup() {
+    // Copies into these buffers may still be queued or in flight
+    commandPool.uploads().wait(uploadTicket);
+    uploadTicket = 0;
+
     if (vertexBuffer != VK_NULL_HANDLE) {
         memoryAllocator.free(vertexBuffer, vertexBufferOffset_);
         vertexBuffer = VK_NULL_HANDLE;
@@ -17,6 +17,7 @@
 
 #include "util/File_utils.h"
 #include "util/Structs.hpp"
+#include "vulkan/UploadQueue.hpp"
 
 class Camera;
 class VulkanDevice;
@@ -231,6 +232,7 @@ private:
     MemoryAllocator& memoryAllocator;
     Camera& camera;
     CommandPool& commandPool;
+    UploadQueue::Ticket uploadTicket = 0;
 
     std::vector<Vertex> vertices;
     std::vector<uint32_t> indices;
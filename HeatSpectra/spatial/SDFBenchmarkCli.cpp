@@ -0,0 +1,125 @@
+#include "SDFBenchmarkCli.hpp"
+
+#include "SDFGridBuilder.hpp"
+#include "TriangleHashGrid.hpp"
+#include "util/ObjMeshLoader.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr const char* BENCH_COMMAND = "--bench-sdf";
+constexpr float GRID_PADDING_CELLS = 3.0f;
+// Band vertices run the same query as the previous builder, so any deviation there
+// is a regression rather than approximation error
+constexpr float MAX_BAND_DEVIATION_CELLS = 1e-4f;
+
+void printUsage() {
+    std::cerr << "Usage:\n"
+              << "  HeatSpectra " << BENCH_COMMAND << " [--model <file.obj>]... [--resolution <cells>]" << std::endl;
+}
+
+bool parsePositive(const char* text, uint32_t& outValue) {
+    if (!text || *text == '\0') {
+        return false;
+    }
+    char* end = nullptr;
+    const unsigned long long value = std::strtoull(text, &end, 10);
+    if (*end != '\0' || value == 0 || value > UINT32_MAX) {
+        return false;
+    }
+    outValue = static_cast<uint32_t>(value);
+    return true;
+}
+
+}
+
+bool isSDFBenchmarkCliInvocation(int argc, char** argv) {
+    return argc > 1 && argv[1] && std::strcmp(argv[1], BENCH_COMMAND) == 0;
+}
+
+int runSDFBenchmarkCli(int argc, char** argv) {
+    std::vector<std::string> modelPaths;
+    uint32_t resolution = 64;
+    for (int argIndex = 2; argIndex < argc; argIndex += 2) {
+        const char* option = argv[argIndex];
+        const char* value = argIndex + 1 < argc ? argv[argIndex + 1] : nullptr;
+        bool parsed = false;
+        if (std::strcmp(option, "--model") == 0 && value) {
+            modelPaths.push_back(value);
+            parsed = true;
+        } else if (std::strcmp(option, "--resolution") == 0) {
+            parsed = parsePositive(value, resolution);
+        }
+        if (!parsed) {
+            printUsage();
+            return 1;
+        }
+    }
+    if (modelPaths.empty()) {
+        modelPaths = { "models/heatsink.obj", "models/channel_tube.obj", "models/cube.obj" };
+    }
+
+    bool allWithinTolerance = true;
+    for (const std::string& modelPath : modelPaths) {
+        std::vector<glm::vec3> positions;
+        std::vector<uint32_t> indices;
+        if (!loadObjTriangles(modelPath, positions, indices)) {
+            return 1;
+        }
+
+        // Same grid layout VoronoiSeeder::generateSeeds builds around the mesh
+        glm::vec3 minBounds(FLT_MAX);
+        glm::vec3 maxBounds(-FLT_MAX);
+        for (const glm::vec3& position : positions) {
+            minBounds = glm::min(minBounds, position);
+            maxBounds = glm::max(maxBounds, position);
+        }
+        const glm::vec3 extent = maxBounds - minBounds;
+        const float cellSize = std::max(std::max(extent.x, extent.y), std::max(extent.z, 1e-6f)) / resolution;
+        const glm::vec3 gridMin = minBounds - glm::vec3(cellSize * GRID_PADDING_CELLS);
+        const glm::vec3 gridSize = maxBounds + glm::vec3(cellSize * GRID_PADDING_CELLS) - gridMin;
+
+        SDFGridBuilder::GridSpec spec;
+        spec.gridMin = gridMin;
+        spec.cellSize = cellSize;
+        spec.gridDim = glm::max(glm::ivec3(glm::ceil(gridSize / cellSize)), glm::ivec3(2));
+        const glm::vec3 gridMax = gridMin + glm::vec3(spec.gridDim) * cellSize;
+
+        TriangleHashGrid triangleGrid;
+        triangleGrid.build(positions, indices, gridMin, gridMax, cellSize);
+
+        SDFGridBuilder builder;
+        const SDFGridBuilder::BenchmarkResult result = builder.benchmark(positions, indices, triangleGrid, spec);
+        const bool withinTolerance = result.maxBandDeviation <= MAX_BAND_DEVIATION_CELLS * cellSize;
+        allWithinTolerance = allWithinTolerance && withinTolerance;
+
+        std::cout << modelPath << ": " << indices.size() / 3 << " triangles, grid "
+                  << spec.gridDim.x << "x" << spec.gridDim.y << "x" << spec.gridDim.z
+                  << ", cell " << cellSize << "\n"
+                  << std::fixed << std::setprecision(1)
+                  << "  exact     " << std::setw(9) << result.exactMs << " ms\n"
+                  << "  previous  " << std::setw(9) << result.referenceMs << " ms, reached "
+                  << result.referenceReachedCount << "/" << result.vertexCount << " vertices, max error "
+                  << std::setprecision(4) << result.referenceMaxError / cellSize << " cells\n"
+                  << std::setprecision(1)
+                  << "  swept     " << std::setw(9) << result.sweptMs << " ms, band "
+                  << result.bandVertexCount << " vertices, deviation from previous "
+                  << std::setprecision(4) << result.maxBandDeviation / cellSize << " cells\n"
+                  << "  swept max error " << result.maxBandError / cellSize << " cells in band, "
+                  << result.maxFarError / cellSize << " cells outside, mean "
+                  << result.meanError / cellSize << " cells"
+                  << (withinTolerance ? "" : "  (band differs from previous)") << std::defaultfloat << "\n";
+    }
+    std::cout << std::flush;
+    return allWithinTolerance ? 0 : 1;
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+// Times SDFGridBuilder's swept narrow band against the previous per-vertex query
+// and checks both against exact distances to every triangle, handled before the
+// UI starts:
+//   --bench-sdf [--model <file.obj>]... [--resolution <cells>]
+bool isSDFBenchmarkCliInvocation(int argc, char** argv);
+int runSDFBenchmarkCli(int argc, char** argv);
@@ -0,0 +1,432 @@
+#include "SDFGridBuilder.hpp"
+
+#include "TriangleHashGrid.hpp"
+#include "util/GeometryUtils.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <omp.h>
+
+namespace {
+
+const float farDistance = std::sqrt(FLT_MAX);
+
+bool isValidTriangle(const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& indices, size_t triangleIndex) {
+    const size_t indexBase = triangleIndex * 3;
+    return indexBase + 2 < indices.size() &&
+        indices[indexBase] < positions.size() &&
+        indices[indexBase + 1] < positions.size() &&
+        indices[indexBase + 2] < positions.size();
+}
+
+float distanceSqToTriangle(const glm::vec3& point, const glm::vec3& v0, const glm::vec3& v1, const glm::vec3& v2) {
+    const glm::vec3 delta = point - closestPointOnTriangle(point, v0, v1, v2);
+    return glm::dot(delta, delta);
+}
+
+float distanceToTriangle(
+    const glm::vec3& point,
+    const std::vector<glm::vec3>& positions,
+    const std::vector<uint32_t>& indices,
+    int32_t triangleIndex) {
+    const size_t indexBase = static_cast<size_t>(triangleIndex) * 3;
+    return std::sqrt(distanceSqToTriangle(
+        point,
+        positions[indices[indexBase]],
+        positions[indices[indexBase + 1]],
+        positions[indices[indexBase + 2]]));
+}
+
+size_t vertexIndex(const glm::ivec3& dim, int x, int y, int z) {
+    return static_cast<size_t>(z) * static_cast<size_t>(dim.y) * static_cast<size_t>(dim.x) +
+        static_cast<size_t>(y) * static_cast<size_t>(dim.x) +
+        static_cast<size_t>(x);
+}
+
+glm::vec3 vertexPosition(const SDFGridBuilder::GridSpec& spec, int x, int y, int z) {
+    return spec.gridMin + glm::vec3(x, y, z) * spec.cellSize;
+}
+
+}
+
+void SDFGridBuilder::build(
+    const std::vector<glm::vec3>& positions,
+    const std::vector<uint32_t>& indices,
+    const TriangleHashGrid& triangleGrid,
+    const GridSpec& spec,
+    std::vector<float>& outDistances) {
+    buildWithBand(positions, indices, triangleGrid, spec, outDistances);
+    releaseScratch();
+}
+
+void SDFGridBuilder::buildWithBand(
+    const std::vector<glm::vec3>& positions,
+    const std::vector<uint32_t>& indices,
+    const TriangleHashGrid& triangleGrid,
+    const GridSpec& spec,
+    std::vector<float>& outDistances) {
+    const size_t totalVertices =
+        static_cast<size_t>(std::max(spec.gridDim.x, 0)) *
+        static_cast<size_t>(std::max(spec.gridDim.y, 0)) *
+        static_cast<size_t>(std::max(spec.gridDim.z, 0));
+    outDistances.assign(totalVertices, farDistance);
+    nearestTriangles.assign(totalVertices, -1);
+    bandFlags.assign(totalVertices, 0u);
+    if (totalVertices == 0) {
+        return;
+    }
+
+    buildNarrowBand(positions, indices, triangleGrid, spec, outDistances);
+    propagate(positions, indices, spec, outDistances);
+}
+
+void SDFGridBuilder::releaseScratch() {
+    nearestTriangles.clear();
+    nearestTriangles.shrink_to_fit();
+    bandFlags.clear();
+    bandFlags.shrink_to_fit();
+}
+
+void SDFGridBuilder::buildNarrowBand(
+    const std::vector<glm::vec3>& positions,
+    const std::vector<uint32_t>& indices,
+    const TriangleHashGrid& triangleGrid,
+    const GridSpec& spec,
+    std::vector<float>& outDistances) {
+    const glm::ivec3 dim = spec.gridDim;
+    const glm::ivec3 cellDim = triangleGrid.getGridDim();
+    const glm::ivec3 tileCounts = (dim + glm::ivec3(TILE_SIZE - 1)) / TILE_SIZE;
+    const int tileCount = tileCounts.x * tileCounts.y * tileCounts.z;
+
+    #pragma omp parallel
+    {
+        std::vector<uint32_t> tileTriangles;
+        std::vector<glm::vec3> tileVertices;
+        std::vector<uint32_t> cellOffsets;
+        std::vector<uint32_t> cellEntries;
+        std::vector<uint32_t> visitStamps;
+
+        #pragma omp for schedule(dynamic, 1)
+        for (int tile = 0; tile < tileCount; ++tile) {
+            const int tx = tile % tileCounts.x;
+            const int ty = (tile / tileCounts.x) % tileCounts.y;
+            const int tz = tile / (tileCounts.x * tileCounts.y);
+            const glm::ivec3 vertexMin(tx * TILE_SIZE, ty * TILE_SIZE, tz * TILE_SIZE);
+            const glm::ivec3 vertexMax = glm::min(vertexMin + glm::ivec3(TILE_SIZE), dim) - glm::ivec3(1);
+
+            // Hash cells touched by the 3x3x3 neighbourhood of any vertex in this tile
+            const glm::ivec3 cellMin = glm::max(
+                triangleGrid.worldToCell(vertexPosition(spec, vertexMin.x, vertexMin.y, vertexMin.z)) - glm::ivec3(1),
+                glm::ivec3(0));
+            const glm::ivec3 cellMax = glm::min(
+                triangleGrid.worldToCell(vertexPosition(spec, vertexMax.x, vertexMax.y, vertexMax.z)) + glm::ivec3(1),
+                cellDim - glm::ivec3(1));
+            const glm::ivec3 boxDim = cellMax - cellMin + glm::ivec3(1);
+
+            tileTriangles.clear();
+            for (int cz = cellMin.z; cz <= cellMax.z; ++cz) {
+                for (int cy = cellMin.y; cy <= cellMax.y; ++cy) {
+                    for (int cx = cellMin.x; cx <= cellMax.x; ++cx) {
+                        triangleGrid.forEachCellTriangle(cx, cy, cz, [&](size_t triangleIndex) {
+                            if (isValidTriangle(positions, indices, triangleIndex)) {
+                                tileTriangles.push_back(static_cast<uint32_t>(triangleIndex));
+                            }
+                        });
+                    }
+                }
+            }
+            if (tileTriangles.empty()) {
+                continue;
+            }
+
+            std::sort(tileTriangles.begin(), tileTriangles.end());
+            tileTriangles.erase(std::unique(tileTriangles.begin(), tileTriangles.end()), tileTriangles.end());
+
+            // Tile-local copy of triangle corners keeps the inner loop on contiguous memory
+            tileVertices.resize(tileTriangles.size() * 3);
+            for (size_t local = 0; local < tileTriangles.size(); ++local) {
+                const size_t indexBase = static_cast<size_t>(tileTriangles[local]) * 3;
+                tileVertices[local * 3 + 0] = positions[indices[indexBase]];
+                tileVertices[local * 3 + 1] = positions[indices[indexBase + 1]];
+                tileVertices[local * 3 + 2] = positions[indices[indexBase + 2]];
+            }
+
+            cellOffsets.assign(static_cast<size_t>(boxDim.x) * boxDim.y * boxDim.z + 1, 0u);
+            cellEntries.clear();
+            size_t boxCell = 0;
+            for (int cz = cellMin.z; cz <= cellMax.z; ++cz) {
+                for (int cy = cellMin.y; cy <= cellMax.y; ++cy) {
+                    for (int cx = cellMin.x; cx <= cellMax.x; ++cx) {
+                        cellOffsets[boxCell++] = static_cast<uint32_t>(cellEntries.size());
+                        triangleGrid.forEachCellTriangle(cx, cy, cz, [&](size_t triangleIndex) {
+                            const auto it = std::lower_bound(
+                                tileTriangles.begin(), tileTriangles.end(), static_cast<uint32_t>(triangleIndex));
+                            if (it != tileTriangles.end() && *it == triangleIndex) {
+                                cellEntries.push_back(static_cast<uint32_t>(it - tileTriangles.begin()));
+                            }
+                        });
+                    }
+                }
+            }
+            cellOffsets[boxCell] = static_cast<uint32_t>(cellEntries.size());
+
+            visitStamps.assign(tileTriangles.size(), 0u);
+            uint32_t generation = 0;
+
+            for (int z = vertexMin.z; z <= vertexMax.z; ++z) {
+                for (int y = vertexMin.y; y <= vertexMax.y; ++y) {
+                    for (int x = vertexMin.x; x <= vertexMax.x; ++x) {
+                        const glm::vec3 point = vertexPosition(spec, x, y, z);
+                        const glm::ivec3 cell = triangleGrid.worldToCell(point);
+                        ++generation;
+
+                        float minDistSq = FLT_MAX;
+                        int32_t nearest = -1;
+                        for (int dz = -1; dz <= 1; ++dz) {
+                            for (int dy = -1; dy <= 1; ++dy) {
+                                for (int dx = -1; dx <= 1; ++dx) {
+                                    const glm::ivec3 neighborCell = cell + glm::ivec3(dx, dy, dz);
+                                    if (glm::any(glm::lessThan(neighborCell, glm::ivec3(0))) ||
+                                        glm::any(glm::greaterThanEqual(neighborCell, cellDim))) {
+                                        continue;
+                                    }
+
+                                    const glm::ivec3 local = neighborCell - cellMin;
+                                    const size_t localCell =
+                                        (static_cast<size_t>(local.z) * boxDim.y + local.y) * boxDim.x + local.x;
+                                    for (uint32_t entry = cellOffsets[localCell]; entry < cellOffsets[localCell + 1]; ++entry) {
+                                        const uint32_t localTriangle = cellEntries[entry];
+                                        if (visitStamps[localTriangle] == generation) {
+                                            continue;
+                                        }
+                                        visitStamps[localTriangle] = generation;
+
+                                        const float distSq = distanceSqToTriangle(
+                                            point,
+                                            tileVertices[localTriangle * 3 + 0],
+                                            tileVertices[localTriangle * 3 + 1],
+                                            tileVertices[localTriangle * 3 + 2]);
+                                        if (distSq < minDistSq) {
+                                            minDistSq = distSq;
+                                            nearest = static_cast<int32_t>(tileTriangles[localTriangle]);
+                                        }
+                                    }
+                                }
+                            }
+                        }
+
+                        if (nearest < 0) {
+                            continue;
+                        }
+
+                        const size_t idx = vertexIndex(dim, x, y, z);
+                        outDistances[idx] = std::sqrt(minDistSq);
+                        nearestTriangles[idx] = nearest;
+                        bandFlags[idx] = 1u;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void SDFGridBuilder::propagate(
+    const std::vector<glm::vec3>& positions,
+    const std::vector<uint32_t>& indices,
+    const GridSpec& spec,
+    std::vector<float>& outDistances) {
+    const glm::ivec3 dim = spec.gridDim;
+
+    // Band vertices keep their exact value; others adopt a neighbour's nearest triangle if it is closer.
+    auto relax = [&](int x, int y, int z, size_t idx, size_t fromIdx) {
+        if (bandFlags[idx] != 0u) {
+            return;
+        }
+        const int32_t candidate = nearestTriangles[fromIdx];
+        if (candidate < 0 || candidate == nearestTriangles[idx]) {
+            return;
+        }
+        const float distance = distanceToTriangle(vertexPosition(spec, x, y, z), positions, indices, candidate);
+        if (distance < outDistances[idx]) {
+            outDistances[idx] = distance;
+            nearestTriangles[idx] = candidate;
+        }
+    };
+
+    const size_t strideY = static_cast<size_t>(dim.x);
+    const size_t strideZ = static_cast<size_t>(dim.x) * static_cast<size_t>(dim.y);
+    const int lineCountX = dim.y * dim.z;
+
+    for (int round = 0; round < PROPAGATION_ROUNDS; ++round) {
+        #pragma omp parallel for schedule(static)
+        for (int line = 0; line < lineCountX; ++line) {
+            const int y = line % dim.y;
+            const int z = line / dim.y;
+            const size_t base = vertexIndex(dim, 0, y, z);
+            for (int x = 1; x < dim.x; ++x) {
+                relax(x, y, z, base + x, base + x - 1);
+            }
+            for (int x = dim.x - 2; x >= 0; --x) {
+                relax(x, y, z, base + x, base + x + 1);
+            }
+        }
+
+        #pragma omp parallel for schedule(static)
+        for (int z = 0; z < dim.z; ++z) {
+            for (int y = 1; y < dim.y; ++y) {
+                const size_t base = vertexIndex(dim, 0, y, z);
+                for (int x = 0; x < dim.x; ++x) {
+                    relax(x, y, z, base + x, base + x - strideY);
+                }
+            }
+            for (int y = dim.y - 2; y >= 0; --y) {
+                const size_t base = vertexIndex(dim, 0, y, z);
+                for (int x = 0; x < dim.x; ++x) {
+                    relax(x, y, z, base + x, base + x + strideY);
+                }
+            }
+        }
+
+        #pragma omp parallel for schedule(static)
+        for (int y = 0; y < dim.y; ++y) {
+            for (int z = 1; z < dim.z; ++z) {
+                const size_t base = vertexIndex(dim, 0, y, z);
+                for (int x = 0; x < dim.x; ++x) {
+                    relax(x, y, z, base + x, base + x - strideZ);
+                }
+            }
+            for (int z = dim.z - 2; z >= 0; --z) {
+                const size_t base = vertexIndex(dim, 0, y, z);
+                for (int x = 0; x < dim.x; ++x) {
+                    relax(x, y, z, base + x, base + x + strideZ);
+                }
+            }
+        }
+    }
+}
+
+void SDFGridBuilder::buildReference(
+    const std::vector<glm::vec3>& positions,
+    const std::vector<uint32_t>& indices,
+    const TriangleHashGrid& triangleGrid,
+    const GridSpec& spec,
+    std::vector<float>& outDistances) const {
+    const glm::ivec3 dim = spec.gridDim;
+    outDistances.assign(static_cast<size_t>(dim.x) * dim.y * dim.z, farDistance);
+
+    #pragma omp parallel for
+    for (int z = 0; z < dim.z; z++) {
+        std::vector<size_t> nearbyTriangles;
+        for (int y = 0; y < dim.y; y++) {
+            for (int x = 0; x < dim.x; x++) {
+                const glm::vec3 point = vertexPosition(spec, x, y, z);
+                triangleGrid.getNearbyTriangles(point, nearbyTriangles);
+                if (nearbyTriangles.empty()) {
+                    triangleGrid.getNearbyTriangles(point, REFERENCE_FALLBACK_RADIUS, nearbyTriangles);
+                }
+
+                float minDistSq = FLT_MAX;
+                for (size_t triIdx : nearbyTriangles) {
+                    if (!isValidTriangle(positions, indices, triIdx)) {
+                        continue;
+                    }
+                    const size_t indexBase = triIdx * 3;
+                    minDistSq = std::min(minDistSq, distanceSqToTriangle(
+                        point,
+                        positions[indices[indexBase]],
+                        positions[indices[indexBase + 1]],
+                        positions[indices[indexBase + 2]]));
+                }
+                outDistances[vertexIndex(dim, x, y, z)] = std::sqrt(minDistSq);
+            }
+        }
+    }
+}
+
+void SDFGridBuilder::buildExact(
+    const std::vector<glm::vec3>& positions,
+    const std::vector<uint32_t>& indices,
+    const GridSpec& spec,
+    std::vector<float>& outDistances) const {
+    const glm::ivec3 dim = spec.gridDim;
+    outDistances.assign(static_cast<size_t>(dim.x) * dim.y * dim.z, farDistance);
+    const size_t triangleCount = indices.size() / 3;
+
+    #pragma omp parallel for schedule(dynamic, 1)
+    for (int z = 0; z < dim.z; z++) {
+        for (int y = 0; y < dim.y; y++) {
+            for (int x = 0; x < dim.x; x++) {
+                const glm::vec3 point = vertexPosition(spec, x, y, z);
+                float minDistSq = FLT_MAX;
+                for (size_t triIdx = 0; triIdx < triangleCount; ++triIdx) {
+                    if (!isValidTriangle(positions, indices, triIdx)) {
+                        continue;
+                    }
+                    const size_t indexBase = triIdx * 3;
+                    minDistSq = std::min(minDistSq, distanceSqToTriangle(
+                        point,
+                        positions[indices[indexBase]],
+                        positions[indices[indexBase + 1]],
+                        positions[indices[indexBase + 2]]));
+                }
+                outDistances[vertexIndex(dim, x, y, z)] = std::sqrt(minDistSq);
+            }
+        }
+    }
+}
+
+SDFGridBuilder::BenchmarkResult SDFGridBuilder::benchmark(
+    const std::vector<glm::vec3>& positions,
+    const std::vector<uint32_t>& indices,
+    const TriangleHashGrid& triangleGrid,
+    const GridSpec& spec) {
+    BenchmarkResult result{};
+
+    std::vector<float> exactDistances;
+    const auto exactStart = std::chrono::steady_clock::now();
+    buildExact(positions, indices, spec, exactDistances);
+    const auto exactEnd = std::chrono::steady_clock::now();
+    result.exactMs = std::chrono::duration<double, std::milli>(exactEnd - exactStart).count();
+
+    std::vector<float> referenceDistances;
+    const auto referenceStart = std::chrono::steady_clock::now();
+    buildReference(positions, indices, triangleGrid, spec, referenceDistances);
+    const auto referenceEnd = std::chrono::steady_clock::now();
+    result.referenceMs = std::chrono::duration<double, std::milli>(referenceEnd - referenceStart).count();
+
+    std::vector<float> sweptDistances;
+    const auto sweptStart = std::chrono::steady_clock::now();
+    buildWithBand(positions, indices, triangleGrid, spec, sweptDistances);
+    const auto sweptEnd = std::chrono::steady_clock::now();
+    result.sweptMs = std::chrono::duration<double, std::milli>(sweptEnd - sweptStart).count();
+
+    double errorSum = 0.0;
+    result.vertexCount = static_cast<uint32_t>(exactDistances.size());
+    for (size_t idx = 0; idx < exactDistances.size(); ++idx) {
+        const float error = std::abs(sweptDistances[idx] - exactDistances[idx]);
+        errorSum += error;
+        if (bandFlags[idx] != 0u) {
+            ++result.bandVertexCount;
+            result.maxBandError = std::max(result.maxBandError, error);
+            result.maxBandDeviation = std::max(
+                result.maxBandDeviation,
+                std::abs(sweptDistances[idx] - referenceDistances[idx]));
+        } else {
+            result.maxFarError = std::max(result.maxFarError, error);
+        }
+        if (referenceDistances[idx] < farDistance) {
+            ++result.referenceReachedCount;
+            result.referenceMaxError = std::max(
+                result.referenceMaxError,
+                std::abs(referenceDistances[idx] - exactDistances[idx]));
+        }
+    }
+    if (!exactDistances.empty()) {
+        result.meanError = static_cast<float>(errorSum / exactDistances.size());
+    }
+
+    releaseScratch();
+    return result;
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+class TriangleHashGrid;
+
+// Unsigned distance grid sampled at grid vertices gridMin + (x, y, z) * cellSize.
+// Vertices with triangles in their 3x3x3 hash-cell neighbourhood (the narrow band)
+// get the exact distance to those triangles; the remaining vertices inherit their
+// nearest triangle through axis-aligned sweeps from the band.
+class SDFGridBuilder {
+public:
+    struct GridSpec {
+        glm::vec3 gridMin = glm::vec3(0.0f);
+        glm::ivec3 gridDim = glm::ivec3(0);
+        float cellSize = 1.0f;
+    };
+
+    // Errors are against buildExact(). Band vertices should match the previous
+    // per-vertex query exactly; both inherit the hash-cell neighbourhood's miss
+    // of a closer triangle, so the band error against the exact grid is shared.
+    struct BenchmarkResult {
+        double exactMs = 0.0;
+        double referenceMs = 0.0;
+        double sweptMs = 0.0;
+        uint32_t vertexCount = 0;
+        uint32_t bandVertexCount = 0;
+        float maxBandDeviation = 0.0f;
+        float maxBandError = 0.0f;
+        float maxFarError = 0.0f;
+        float meanError = 0.0f;
+        uint32_t referenceReachedCount = 0;
+        float referenceMaxError = 0.0f;
+    };
+
+    void build(
+        const std::vector<glm::vec3>& positions,
+        const std::vector<uint32_t>& indices,
+        const TriangleHashGrid& triangleGrid,
+        const GridSpec& spec,
+        std::vector<float>& outDistances);
+
+    // Per-vertex hash grid query with a 4-cell fallback radius; kept as the
+    // baseline for benchmark().
+    void buildReference(
+        const std::vector<glm::vec3>& positions,
+        const std::vector<uint32_t>& indices,
+        const TriangleHashGrid& triangleGrid,
+        const GridSpec& spec,
+        std::vector<float>& outDistances) const;
+
+    // Distance to every triangle from every vertex, for checking the other paths.
+    void buildExact(
+        const std::vector<glm::vec3>& positions,
+        const std::vector<uint32_t>& indices,
+        const GridSpec& spec,
+        std::vector<float>& outDistances) const;
+
+    BenchmarkResult benchmark(
+        const std::vector<glm::vec3>& positions,
+        const std::vector<uint32_t>& indices,
+        const TriangleHashGrid& triangleGrid,
+        const GridSpec& spec);
+
+private:
+    static constexpr int TILE_SIZE = 8;
+    static constexpr int PROPAGATION_ROUNDS = 2;
+    static constexpr int REFERENCE_FALLBACK_RADIUS = 4;
+
+    void buildWithBand(
+        const std::vector<glm::vec3>& positions,
+        const std::vector<uint32_t>& indices,
+        const TriangleHashGrid& triangleGrid,
+        const GridSpec& spec,
+        std::vector<float>& outDistances);
+    void releaseScratch();
+    void buildNarrowBand(
+        const std::vector<glm::vec3>& positions,
+        const std::vector<uint32_t>& indices,
+        const TriangleHashGrid& triangleGrid,
+        const GridSpec& spec,
+        std::vector<float>& outDistances);
+    void propagate(
+        const std::vector<glm::vec3>& positions,
+        const std::vector<uint32_t>& indices,
+        const GridSpec& spec,
+        std::vector<float>& outDistances);
+
+    std::vector<int32_t> nearestTriangles;
+    std::vector<uint8_t> bandFlags;
+};
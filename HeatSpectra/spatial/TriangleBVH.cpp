@@ -0,0 +1,248 @@
+#include "TriangleBVH.hpp"
+
+#include <iostream>
+#include <omp.h>
+
+namespace {
+
+float surfaceArea(const glm::vec3& boundsMin, const glm::vec3& boundsMax) {
+    const glm::vec3 extent = glm::max(boundsMax - boundsMin, glm::vec3(0.0f));
+    return 2.0f * (extent.x * extent.y + extent.y * extent.z + extent.z * extent.x);
+}
+
+}
+
+void TriangleBVH::build(const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& indices) {
+    clear();
+
+    const size_t triangleTotal = indices.size() / 3;
+    if (triangleTotal == 0) {
+        return;
+    }
+    if (triangleTotal > std::numeric_limits<uint32_t>::max() / 2) {
+        std::cerr << "[TriangleBVH] Triangle count exceeds 32-bit node range" << std::endl;
+        return;
+    }
+
+    std::vector<glm::vec3> centroids(triangleTotal);
+    std::vector<glm::vec3> boundsMins(triangleTotal);
+    std::vector<glm::vec3> boundsMaxs(triangleTotal);
+    triangleIndices.reserve(triangleTotal);
+    for (size_t triangleIndex = 0; triangleIndex < triangleTotal; ++triangleIndex) {
+        const uint32_t i0 = indices[triangleIndex * 3];
+        const uint32_t i1 = indices[triangleIndex * 3 + 1];
+        const uint32_t i2 = indices[triangleIndex * 3 + 2];
+        if (i0 >= positions.size() || i1 >= positions.size() || i2 >= positions.size()) {
+            continue;
+        }
+
+        const glm::vec3& v0 = positions[i0];
+        const glm::vec3& v1 = positions[i1];
+        const glm::vec3& v2 = positions[i2];
+        boundsMins[triangleIndex] = glm::min(glm::min(v0, v1), v2);
+        boundsMaxs[triangleIndex] = glm::max(glm::max(v0, v1), v2);
+        centroids[triangleIndex] = (v0 + v1 + v2) * (1.0f / 3.0f);
+        triangleIndices.push_back(static_cast<uint32_t>(triangleIndex));
+    }
+
+    const uint32_t triangleCount = static_cast<uint32_t>(triangleIndices.size());
+    if (triangleCount == 0) {
+        return;
+    }
+
+    nodes.reserve(static_cast<size_t>(triangleCount) * 2 - 1);
+    nodes.push_back(Node{});
+    buildNode(0, 0, triangleCount, 0, centroids, boundsMins, boundsMaxs);
+
+    // Store vertices in leaf order so traversal reads them contiguously
+    triangleV0.resize(triangleCount);
+    triangleV1.resize(triangleCount);
+    triangleV2.resize(triangleCount);
+
+    #pragma omp parallel for
+    for (int slot = 0; slot < static_cast<int>(triangleCount); ++slot) {
+        const size_t indexBase = static_cast<size_t>(triangleIndices[slot]) * 3;
+        triangleV0[slot] = positions[indices[indexBase]];
+        triangleV1[slot] = positions[indices[indexBase + 1]];
+        triangleV2[slot] = positions[indices[indexBase + 2]];
+    }
+}
+
+bool TriangleBVH::hasTriangleWithin(const glm::vec3& point, float radius) const {
+    if (nodes.empty() || radius < 0.0f) {
+        return false;
+    }
+
+    const float radiusSquared = radius * radius;
+    uint32_t stack[STACK_SIZE];
+    int stackSize = 0;
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0) {
+        const Node& node = nodes[stack[--stackSize]];
+        const glm::vec3 offset = point - glm::clamp(point, node.boundsMin, node.boundsMax);
+        if (glm::dot(offset, offset) > radiusSquared) {
+            continue;
+        }
+
+        if (node.triangleCount > 0) {
+            const uint32_t end = node.leftFirst + node.triangleCount;
+            for (uint32_t slot = node.leftFirst; slot < end; ++slot) {
+                const glm::vec3 closest = closestPointOnTriangle(point, triangleV0[slot], triangleV1[slot], triangleV2[slot]);
+                const glm::vec3 delta = point - closest;
+                if (glm::dot(delta, delta) <= radiusSquared) {
+                    return true;
+                }
+            }
+            continue;
+        }
+
+        if (stackSize + 2 <= STACK_SIZE) {
+            stack[stackSize++] = node.leftFirst + 1;
+            stack[stackSize++] = node.leftFirst;
+        }
+    }
+
+    return false;
+}
+
+void TriangleBVH::clear() {
+    nodes.clear();
+    triangleIndices.clear();
+    triangleV0.clear();
+    triangleV1.clear();
+    triangleV2.clear();
+}
+
+void TriangleBVH::buildNode(uint32_t nodeIndex, uint32_t first, uint32_t count, uint32_t depth,
+    const std::vector<glm::vec3>& centroids, const std::vector<glm::vec3>& boundsMins, const std::vector<glm::vec3>& boundsMaxs) {
+    glm::vec3 nodeMin(std::numeric_limits<float>::infinity());
+    glm::vec3 nodeMax(-std::numeric_limits<float>::infinity());
+    glm::vec3 centroidMin(std::numeric_limits<float>::infinity());
+    glm::vec3 centroidMax(-std::numeric_limits<float>::infinity());
+    for (uint32_t slot = first; slot < first + count; ++slot) {
+        const uint32_t triangleIndex = triangleIndices[slot];
+        nodeMin = glm::min(nodeMin, boundsMins[triangleIndex]);
+        nodeMax = glm::max(nodeMax, boundsMaxs[triangleIndex]);
+        centroidMin = glm::min(centroidMin, centroids[triangleIndex]);
+        centroidMax = glm::max(centroidMax, centroids[triangleIndex]);
+    }
+
+    nodes[nodeIndex].boundsMin = nodeMin;
+    nodes[nodeIndex].boundsMax = nodeMax;
+    nodes[nodeIndex].leftFirst = first;
+    nodes[nodeIndex].triangleCount = count;
+    if (count <= LEAF_TRIANGLE_COUNT) {
+        return;
+    }
+
+    const glm::vec3 centroidExtent = centroidMax - centroidMin;
+    int splitAxis = -1;
+    int splitBin = 0;
+
+    if (depth < MAX_SAH_DEPTH) {
+        float bestCost = surfaceArea(nodeMin, nodeMax) * static_cast<float>(count);
+        for (int axis = 0; axis < 3; ++axis) {
+            if (centroidExtent[axis] <= 0.0f) {
+                continue;
+            }
+
+            uint32_t binCounts[SAH_BIN_COUNT] = {};
+            glm::vec3 binMins[SAH_BIN_COUNT];
+            glm::vec3 binMaxs[SAH_BIN_COUNT];
+            for (int bin = 0; bin < SAH_BIN_COUNT; ++bin) {
+                binMins[bin] = glm::vec3(std::numeric_limits<float>::infinity());
+                binMaxs[bin] = glm::vec3(-std::numeric_limits<float>::infinity());
+            }
+
+            const float binScale = static_cast<float>(SAH_BIN_COUNT) / centroidExtent[axis];
+            for (uint32_t slot = first; slot < first + count; ++slot) {
+                const uint32_t triangleIndex = triangleIndices[slot];
+                const int bin = std::min(SAH_BIN_COUNT - 1,
+                    static_cast<int>((centroids[triangleIndex][axis] - centroidMin[axis]) * binScale));
+                ++binCounts[bin];
+                binMins[bin] = glm::min(binMins[bin], boundsMins[triangleIndex]);
+                binMaxs[bin] = glm::max(binMaxs[bin], boundsMaxs[triangleIndex]);
+            }
+
+            // Sweep from the right to get suffix costs, then from the left to evaluate each plane
+            float rightCosts[SAH_BIN_COUNT] = {};
+            glm::vec3 sweepMin(std::numeric_limits<float>::infinity());
+            glm::vec3 sweepMax(-std::numeric_limits<float>::infinity());
+            uint32_t sweepCount = 0;
+            for (int bin = SAH_BIN_COUNT - 1; bin > 0; --bin) {
+                sweepMin = glm::min(sweepMin, binMins[bin]);
+                sweepMax = glm::max(sweepMax, binMaxs[bin]);
+                sweepCount += binCounts[bin];
+                rightCosts[bin] = sweepCount > 0 ? surfaceArea(sweepMin, sweepMax) * static_cast<float>(sweepCount) : 0.0f;
+            }
+
+            sweepMin = glm::vec3(std::numeric_limits<float>::infinity());
+            sweepMax = glm::vec3(-std::numeric_limits<float>::infinity());
+            sweepCount = 0;
+            for (int bin = 0; bin < SAH_BIN_COUNT - 1; ++bin) {
+                sweepMin = glm::min(sweepMin, binMins[bin]);
+                sweepMax = glm::max(sweepMax, binMaxs[bin]);
+                sweepCount += binCounts[bin];
+                if (sweepCount == 0 || sweepCount == count) {
+                    continue;
+                }
+
+                const float cost = surfaceArea(sweepMin, sweepMax) * static_cast<float>(sweepCount) + rightCosts[bin + 1];
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    splitAxis = axis;
+                    splitBin = bin;
+                }
+            }
+        }
+    }
+
+    uint32_t leftCount = 0;
+    if (splitAxis >= 0) {
+        const float binScale = static_cast<float>(SAH_BIN_COUNT) / centroidExtent[splitAxis];
+        const auto middle = std::partition(
+            triangleIndices.begin() + first,
+            triangleIndices.begin() + first + count,
+            [&](uint32_t triangleIndex) {
+                const int bin = std::min(SAH_BIN_COUNT - 1,
+                    static_cast<int>((centroids[triangleIndex][splitAxis] - centroidMin[splitAxis]) * binScale));
+                return bin <= splitBin;
+            });
+        leftCount = static_cast<uint32_t>(middle - (triangleIndices.begin() + first));
+    } else if (count <= LEAF_TRIANGLE_COUNT * 4 && depth < MAX_SAH_DEPTH) {
+        // Splitting does not pay off for small ranges
+        return;
+    }
+
+    if (leftCount == 0 || leftCount == count) {
+        // Median split along the widest centroid axis keeps depth bounded
+        int axis = 0;
+        if (centroidExtent.y > centroidExtent[axis]) {
+            axis = 1;
+        }
+        if (centroidExtent.z > centroidExtent[axis]) {
+            axis = 2;
+        }
+        leftCount = count / 2;
+        std::nth_element(
+            triangleIndices.begin() + first,
+            triangleIndices.begin() + first + leftCount,
+            triangleIndices.begin() + first + count,
+            [&](uint32_t lhs, uint32_t rhs) {
+                if (centroids[lhs][axis] != centroids[rhs][axis]) {
+                    return centroids[lhs][axis] < centroids[rhs][axis];
+                }
+                return lhs < rhs;
+            });
+    }
+
+    const uint32_t leftIndex = static_cast<uint32_t>(nodes.size());
+    nodes.push_back(Node{});
+    nodes.push_back(Node{});
+    nodes[nodeIndex].leftFirst = leftIndex;
+    nodes[nodeIndex].triangleCount = 0;
+
+    buildNode(leftIndex, first, leftCount, depth + 1, centroids, boundsMins, boundsMaxs);
+    buildNode(leftIndex + 1, first + leftCount, count - leftCount, depth + 1, centroids, boundsMins, boundsMaxs);
+}
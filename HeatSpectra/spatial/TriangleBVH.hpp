@@ -0,0 +1,188 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "util/GeometryUtils.hpp"
+
+// Binned-SAH bounding volume hierarchy over an indexed triangle list, traversed
+// with small ray packets that share one node stack.
+class TriangleBVH {
+public:
+    static constexpr uint32_t INVALID_TRIANGLE = std::numeric_limits<uint32_t>::max();
+    static constexpr uint32_t MAX_PACKET_RAYS = 8;
+
+    struct Node {
+        glm::vec3 boundsMin;
+        uint32_t leftFirst;     // Left child index for interior nodes, first triangle slot for leaves
+        glm::vec3 boundsMax;
+        uint32_t triangleCount; // Zero for interior nodes
+    };
+
+    struct RayPacket {
+        uint32_t rayCount = 0;
+        glm::vec3 origins[MAX_PACKET_RAYS];
+        glm::vec3 directions[MAX_PACKET_RAYS];
+        float maxDistances[MAX_PACKET_RAYS];
+    };
+
+    struct RayHit {
+        uint32_t triangleIndex = INVALID_TRIANGLE;
+        float t = std::numeric_limits<float>::infinity();
+        float u = 0.0f;
+        float v = 0.0f;
+    };
+
+    void build(const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& indices);
+    void clear();
+
+    bool empty() const { return nodes.empty(); }
+    uint32_t getTriangleCount() const { return static_cast<uint32_t>(triangleIndices.size()); }
+    const std::vector<Node>& getNodes() const { return nodes; }
+
+    // True when any triangle lies within radius of point.
+    bool hasTriangleWithin(const glm::vec3& point, float radius) const;
+
+    // Closest hit per ray within [0, maxDistance]. acceptTriangle(rayIndex, triangleIndex)
+    // rejects candidates before the intersection test; ties on t keep the lower index.
+    template <typename Filter>
+    void intersectPacket(const RayPacket& packet, RayHit* outHits, Filter&& acceptTriangle) const;
+
+private:
+    static constexpr uint32_t LEAF_TRIANGLE_COUNT = 4;
+    static constexpr int SAH_BIN_COUNT = 12;
+    static constexpr int STACK_SIZE = 128;
+    static constexpr uint32_t MAX_SAH_DEPTH = 48;
+    // Smaller direction components count as parallel to that slab. The slab test then
+    // only checks the origin against the bounds, so an origin on a bounds plane never
+    // multiplies zero by an infinite reciprocal into NaN.
+    static constexpr float MIN_DIRECTION_COMPONENT = 1e-20f;
+
+    void buildNode(uint32_t nodeIndex, uint32_t first, uint32_t count, uint32_t depth,
+        const std::vector<glm::vec3>& centroids, const std::vector<glm::vec3>& boundsMins, const std::vector<glm::vec3>& boundsMaxs);
+
+    std::vector<Node> nodes;
+    std::vector<uint32_t> triangleIndices;
+    std::vector<glm::vec3> triangleV0;
+    std::vector<glm::vec3> triangleV1;
+    std::vector<glm::vec3> triangleV2;
+};
+
+template <typename Filter>
+void TriangleBVH::intersectPacket(const RayPacket& packet, RayHit* outHits, Filter&& acceptTriangle) const {
+    const uint32_t rayCount = packet.rayCount < MAX_PACKET_RAYS ? packet.rayCount : MAX_PACKET_RAYS;
+    for (uint32_t ray = 0; ray < rayCount; ++ray) {
+        outHits[ray] = RayHit{};
+    }
+    if (nodes.empty() || rayCount == 0) {
+        return;
+    }
+
+    glm::vec3 inverseDirections[MAX_PACKET_RAYS];
+    uint32_t parallelAxes[MAX_PACKET_RAYS];
+    float rayLimits[MAX_PACKET_RAYS];
+    for (uint32_t ray = 0; ray < rayCount; ++ray) {
+        parallelAxes[ray] = 0;
+        for (int axis = 0; axis < 3; ++axis) {
+            const float component = packet.directions[ray][axis];
+            if (std::abs(component) < MIN_DIRECTION_COMPONENT) {
+                parallelAxes[ray] |= 1u << axis;
+                inverseDirections[ray][axis] = 0.0f;
+            } else {
+                inverseDirections[ray][axis] = 1.0f / component;
+            }
+        }
+        rayLimits[ray] = packet.maxDistances[ray];
+    }
+
+    uint32_t stack[STACK_SIZE];
+    int stackSize = 0;
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0) {
+        const Node& node = nodes[stack[--stackSize]];
+
+        uint32_t rayMask = 0;
+        for (uint32_t ray = 0; ray < rayCount; ++ray) {
+            float tEnter = 0.0f;
+            float tExit = rayLimits[ray];
+            for (int axis = 0; axis < 3 && tEnter <= tExit; ++axis) {
+                const float origin = packet.origins[ray][axis];
+                if ((parallelAxes[ray] & (1u << axis)) != 0) {
+                    if (origin < node.boundsMin[axis] || origin > node.boundsMax[axis]) {
+                        tExit = -1.0f;
+                    }
+                    continue;
+                }
+                const float t0 = (node.boundsMin[axis] - origin) * inverseDirections[ray][axis];
+                const float t1 = (node.boundsMax[axis] - origin) * inverseDirections[ray][axis];
+                tEnter = std::max(tEnter, std::min(t0, t1));
+                tExit = std::min(tExit, std::max(t0, t1));
+            }
+            if (tEnter <= tExit) {
+                rayMask |= 1u << ray;
+            }
+        }
+        if (rayMask == 0) {
+            continue;
+        }
+
+        if (node.triangleCount > 0) {
+            const uint32_t end = node.leftFirst + node.triangleCount;
+            for (uint32_t slot = node.leftFirst; slot < end; ++slot) {
+                const uint32_t triangleIndex = triangleIndices[slot];
+                for (uint32_t ray = 0; ray < rayCount; ++ray) {
+                    if ((rayMask & (1u << ray)) == 0 || !acceptTriangle(ray, triangleIndex)) {
+                        continue;
+                    }
+
+                    float t = 0.0f;
+                    float u = 0.0f;
+                    float v = 0.0f;
+                    if (!intersectRayTriangle(packet.origins[ray], packet.directions[ray],
+                            triangleV0[slot], triangleV1[slot], triangleV2[slot], t, u, v)) {
+                        continue;
+                    }
+                    if (t > packet.maxDistances[ray]) {
+                        continue;
+                    }
+
+                    RayHit& hit = outHits[ray];
+                    if (t < hit.t || (t == hit.t && triangleIndex < hit.triangleIndex)) {
+                        hit.triangleIndex = triangleIndex;
+                        hit.t = t;
+                        hit.u = u;
+                        hit.v = v;
+                        rayLimits[ray] = t;
+                    }
+                }
+            }
+            continue;
+        }
+
+        if (stackSize + 2 > STACK_SIZE) {
+            continue;
+        }
+
+        // Visit the child nearer along the first active ray first so hits shrink the limits early
+        uint32_t firstRay = 0;
+        while ((rayMask & (1u << firstRay)) == 0) {
+            ++firstRay;
+        }
+        const Node& left = nodes[node.leftFirst];
+        const Node& right = nodes[node.leftFirst + 1];
+        const glm::vec3 centerDelta = (right.boundsMin + right.boundsMax) - (left.boundsMin + left.boundsMax);
+        if (glm::dot(centerDelta, packet.directions[firstRay]) >= 0.0f) {
+            stack[stackSize++] = node.leftFirst + 1;
+            stack[stackSize++] = node.leftFirst;
+        } else {
+            stack[stackSize++] = node.leftFirst;
+            stack[stackSize++] = node.leftFirst + 1;
+        }
+    }
+}
@@ -0,0 +1,176 @@
+#include "TriangleBVHCheckCli.hpp"
+
+#include "TriangleBVH.hpp"
+#include "util/GeometryUtils.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+constexpr const char* CHECK_COMMAND = "--check-bvh";
+// Unit boxes on a spacing-2 lattice, so box faces and interior node bounds share
+// the half-integer coordinates the ray origins are placed on
+constexpr int BOXES_PER_AXIS = 3;
+constexpr float BOX_SPACING = 2.0f;
+constexpr float ORIGIN_STEP = 0.5f;
+constexpr int ORIGIN_STEPS = 13;
+
+void appendBox(const glm::vec3& boxMin, std::vector<glm::vec3>& positions, std::vector<uint32_t>& indices) {
+    const uint32_t base = static_cast<uint32_t>(positions.size());
+    for (int corner = 0; corner < 8; ++corner) {
+        positions.push_back(boxMin + glm::vec3(
+            static_cast<float>(corner & 1),
+            static_cast<float>((corner >> 1) & 1),
+            static_cast<float>((corner >> 2) & 1)));
+    }
+
+    static const uint32_t boxIndices[36] = {
+        0, 2, 1, 1, 2, 3,
+        4, 5, 6, 5, 7, 6,
+        0, 1, 4, 1, 5, 4,
+        2, 6, 3, 3, 6, 7,
+        0, 4, 2, 2, 4, 6,
+        1, 3, 5, 3, 7, 5,
+    };
+    for (uint32_t index : boxIndices) {
+        indices.push_back(base + index);
+    }
+}
+
+TriangleBVH::RayHit bruteForceHit(
+    const std::vector<glm::vec3>& positions,
+    const std::vector<uint32_t>& indices,
+    const glm::vec3& origin,
+    const glm::vec3& direction,
+    float maxDistance) {
+    TriangleBVH::RayHit best{};
+    const uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+    for (uint32_t triangleIndex = 0; triangleIndex < triangleCount; ++triangleIndex) {
+        float t = 0.0f;
+        float u = 0.0f;
+        float v = 0.0f;
+        if (!intersectRayTriangle(origin, direction,
+                positions[indices[triangleIndex * 3]],
+                positions[indices[triangleIndex * 3 + 1]],
+                positions[indices[triangleIndex * 3 + 2]],
+                t, u, v) ||
+            t > maxDistance) {
+            continue;
+        }
+        if (t < best.t) {
+            best.triangleIndex = triangleIndex;
+            best.t = t;
+            best.u = u;
+            best.v = v;
+        }
+    }
+    return best;
+}
+
+}
+
+bool isTriangleBVHCheckCliInvocation(int argc, char** argv) {
+    return argc > 1 && argv[1] && std::strcmp(argv[1], CHECK_COMMAND) == 0;
+}
+
+int runTriangleBVHCheckCli(int argc, char** argv) {
+    (void)argv;
+    if (argc != 2) {
+        std::cerr << "Usage:\n"
+                  << "  HeatSpectra " << CHECK_COMMAND << std::endl;
+        return 1;
+    }
+
+    std::vector<glm::vec3> positions;
+    std::vector<uint32_t> indices;
+    for (int x = 0; x < BOXES_PER_AXIS; ++x) {
+        for (int y = 0; y < BOXES_PER_AXIS; ++y) {
+            for (int z = 0; z < BOXES_PER_AXIS; ++z) {
+                appendBox(glm::vec3(x, y, z) * BOX_SPACING, positions, indices);
+            }
+        }
+    }
+
+    TriangleBVH bvh;
+    bvh.build(positions, indices);
+    if (bvh.empty()) {
+        std::cerr << "[TriangleBVHCheck] BVH build produced no nodes" << std::endl;
+        return 1;
+    }
+
+    // Origins start before the lattice, on the first faces it meets, and inside it
+    const float lastCoordinate = BOX_SPACING * static_cast<float>(BOXES_PER_AXIS);
+    const float startOffsets[] = { -1.0f, 0.0f, 1.0f, BOX_SPACING };
+    const float maxDistances[] = { 1.0f, 10.0f };
+
+    std::vector<glm::vec3> origins;
+    std::vector<glm::vec3> directions;
+    std::vector<float> limits;
+    for (int axis = 0; axis < 3; ++axis) {
+        const int uAxis = (axis + 1) % 3;
+        const int vAxis = (axis + 2) % 3;
+        for (float sign : { 1.0f, -1.0f }) {
+            glm::vec3 direction(0.0f);
+            direction[axis] = sign;
+            for (int uStep = 0; uStep < ORIGIN_STEPS; ++uStep) {
+                for (int vStep = 0; vStep < ORIGIN_STEPS; ++vStep) {
+                    for (float startOffset : startOffsets) {
+                        for (float maxDistance : maxDistances) {
+                            glm::vec3 origin(0.0f);
+                            origin[uAxis] = static_cast<float>(uStep - 1) * ORIGIN_STEP;
+                            origin[vAxis] = static_cast<float>(vStep - 1) * ORIGIN_STEP;
+                            origin[axis] = sign > 0.0f ? startOffset : lastCoordinate - 1.0f - startOffset;
+                            origins.push_back(origin);
+                            directions.push_back(direction);
+                            limits.push_back(maxDistance);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    const uint32_t rayTotal = static_cast<uint32_t>(origins.size());
+    uint32_t hitCount = 0;
+    uint32_t mismatchCount = 0;
+    for (uint32_t first = 0; first < rayTotal; first += TriangleBVH::MAX_PACKET_RAYS) {
+        TriangleBVH::RayPacket packet{};
+        packet.rayCount = std::min(TriangleBVH::MAX_PACKET_RAYS, rayTotal - first);
+        for (uint32_t ray = 0; ray < packet.rayCount; ++ray) {
+            packet.origins[ray] = origins[first + ray];
+            packet.directions[ray] = directions[first + ray];
+            packet.maxDistances[ray] = limits[first + ray];
+        }
+
+        TriangleBVH::RayHit hits[TriangleBVH::MAX_PACKET_RAYS];
+        bvh.intersectPacket(packet, hits, [](uint32_t, uint32_t) { return true; });
+
+        for (uint32_t ray = 0; ray < packet.rayCount; ++ray) {
+            const TriangleBVH::RayHit expected =
+                bruteForceHit(positions, indices, packet.origins[ray], packet.directions[ray], packet.maxDistances[ray]);
+            if (expected.triangleIndex != TriangleBVH::INVALID_TRIANGLE) {
+                ++hitCount;
+            }
+            if (hits[ray].triangleIndex == expected.triangleIndex && hits[ray].t == expected.t) {
+                continue;
+            }
+            if (mismatchCount < 8) {
+                const glm::vec3& origin = packet.origins[ray];
+                const glm::vec3& direction = packet.directions[ray];
+                std::cerr << "[TriangleBVHCheck] Ray (" << origin.x << ", " << origin.y << ", " << origin.z
+                          << ") dir (" << direction.x << ", " << direction.y << ", " << direction.z
+                          << "): BVH hit " << hits[ray].triangleIndex << " at " << hits[ray].t
+                          << ", expected " << expected.triangleIndex << " at " << expected.t << std::endl;
+            }
+            ++mismatchCount;
+        }
+    }
+
+    std::cout << "bvh check: " << rayTotal << " axis-aligned rays, " << hitCount << " hits, "
+              << mismatchCount << " mismatches against brute force" << std::endl;
+    return mismatchCount == 0 ? 0 : 1;
+}
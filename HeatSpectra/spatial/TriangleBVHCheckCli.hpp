@@ -0,0 +1,8 @@
+#pragma once
+
+// Traces axis-aligned packets through TriangleBVH over a lattice of boxes, with
+// origins on box faces and node bounds planes, and checks every hit against a
+// brute-force scan of all triangles, handled before the UI starts:
+//   --check-bvh
+bool isTriangleBVHCheckCliInvocation(int argc, char** argv);
+int runTriangleBVHCheckCli(int argc, char** argv);
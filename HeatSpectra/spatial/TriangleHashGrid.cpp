@@ -4,11 +4,38 @@
 #include "util/GeometryUtils.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <iostream>
 #include <limits>
 #include <omp.h>
 
+namespace {
+
+struct TriangleVisitScratch {
+    std::vector<uint32_t> stamps;
+    uint32_t generation = 0;
+};
+
+thread_local TriangleVisitScratch triangleVisitScratch;
+
+// Per-thread generation stamps replace a per-query seen set; the stamp array
+// only grows, so steady-state queries do not allocate.
+uint32_t* beginTriangleVisit(uint32_t triangleCount, uint32_t& outGeneration) {
+    TriangleVisitScratch& scratch = triangleVisitScratch;
+    if (scratch.stamps.size() < triangleCount) {
+        scratch.stamps.resize(triangleCount, 0u);
+    }
+    if (++scratch.generation == 0u) {
+        std::fill(scratch.stamps.begin(), scratch.stamps.end(), 0u);
+        scratch.generation = 1u;
+    }
+    outGeneration = scratch.generation;
+    return scratch.stamps.data();
+}
+
+}
+
 TriangleHashGrid::TriangleHashGrid()
     : cellSize_(1.0f), gridMin_(0.0f), gridMax_(1.0f), gridDim_(1) {
 }
@@ -22,6 +49,7 @@ void TriangleHashGrid::build(const Model& model, const glm::vec3& gridMin, const
         positions.push_back(vertex.pos);
     }
 
+    clear();
     initializeGrid(gridMin, gridMax, cellSize);
     buildTriangles(positions, model.getIndices());
 }
@@ -37,7 +65,8 @@ void TriangleHashGrid::getNearbyTriangles(const glm::vec3& position, std::vector
     outTriangles.clear();
 
     const glm::ivec3 cell = worldToCell(position);
-    std::unordered_set<size_t> seenTriangles;
+    uint32_t generation = 0;
+    uint32_t* visitStamps = beginTriangleVisit(triangleCount_, generation);
 
     for (int dz = -1; dz <= 1; ++dz) {
         for (int dy = -1; dy <= 1; ++dy) {
@@ -53,7 +82,7 @@ void TriangleHashGrid::getNearbyTriangles(const glm::vec3& position, std::vector
                 }
 
                 const size_t hash = hashCell(cx, cy, cz);
-                addCellTriangles(hash, seenTriangles, outTriangles);
+                addCellTriangles(hash, visitStamps, generation, outTriangles);
             }
         }
     }
@@ -68,7 +97,8 @@ void TriangleHashGrid::getNearbyTriangles(const glm::vec3& position, int radiusC
 
     const glm::ivec3 cell = worldToCell(position);
     const int r = radiusCells;
-    std::unordered_set<size_t> seenTriangles;
+    uint32_t generation = 0;
+    uint32_t* visitStamps = beginTriangleVisit(triangleCount_, generation);
 
     for (int dz = -r; dz <= r; ++dz) {
         for (int dy = -r; dy <= r; ++dy) {
@@ -84,7 +114,7 @@ void TriangleHashGrid::getNearbyTriangles(const glm::vec3& position, int radiusC
                 }
 
                 const size_t hash = hashCell(cx, cy, cz);
-                addCellTriangles(hash, seenTriangles, outTriangles);
+                addCellTriangles(hash, visitStamps, generation, outTriangles);
             }
         }
     }
@@ -93,7 +123,7 @@ void TriangleHashGrid::getNearbyTriangles(const glm::vec3& position, int radiusC
 void TriangleHashGrid::getTrianglesAlongRay(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, std::vector<size_t>& outTriangles) const {
     outTriangles.clear();
 
-    if (grid_.empty() || maxDistance <= 0.0f || cellSize_ <= 0.0f) {
+    if (cellTriangles_.empty() || maxDistance <= 0.0f || cellSize_ <= 0.0f) {
         return;
     }
 
@@ -146,12 +176,13 @@ void TriangleHashGrid::getTrianglesAlongRay(const glm::vec3& origin, const glm::
     }
 
     const float travelLimit = endT - startT;
-    std::unordered_set<size_t> seenTriangles;
+    uint32_t generation = 0;
+    uint32_t* visitStamps = beginTriangleVisit(triangleCount_, generation);
 
     while (cell.x >= 0 && cell.x < gridDim_.x &&
            cell.y >= 0 && cell.y < gridDim_.y &&
            cell.z >= 0 && cell.z < gridDim_.z) {
-        addCellTriangles(hashCell(cell.x, cell.y, cell.z), seenTriangles, outTriangles);
+        addCellTriangles(hashCell(cell.x, cell.y, cell.z), visitStamps, generation, outTriangles);
 
         const float nextStepT = std::min(tMax.x, std::min(tMax.y, tMax.z));
         if (nextStepT > travelLimit) {
@@ -172,7 +203,12 @@ void TriangleHashGrid::getTrianglesAlongRay(const glm::vec3& origin, const glm::
 }
 
 void TriangleHashGrid::clear() {
-    grid_.clear();
+    cellOffsets_.clear();
+    cellTriangles_.clear();
+    slotKeys_.clear();
+    slotCells_.clear();
+    denseCells_ = true;
+    triangleCount_ = 0;
 }
 
 void TriangleHashGrid::initializeGrid(const glm::vec3& gridMin, const glm::vec3& gridMax, float cellSize) {
@@ -183,64 +219,179 @@ void TriangleHashGrid::initializeGrid(const glm::vec3& gridMin, const glm::vec3&
 }
 
 void TriangleHashGrid::buildTriangles(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices) {
-    std::vector<std::unordered_map<size_t, std::vector<size_t>>> threadLocalGrids;
+    const size_t triangleTotal = indices.size() / 3;
+    if (triangleTotal == 0) {
+        return;
+    }
+    if (triangleTotal > std::numeric_limits<uint32_t>::max()) {
+        std::cerr << "[TriangleHashGrid] Triangle count exceeds 32-bit index range" << std::endl;
+        return;
+    }
 
-    #pragma omp parallel
-    {
-        #pragma omp single
-        {
-            threadLocalGrids.resize(omp_get_num_threads());
+    // 64-bit loop bounds: pair and dense cell counts may go past INT_MAX
+    const int64_t triangleCount = static_cast<int64_t>(triangleTotal);
+    std::vector<glm::ivec3> cellMins(triangleTotal);
+    std::vector<glm::ivec3> cellMaxs(triangleTotal);
+    std::vector<size_t> pairOffsets(triangleTotal + 1, 0);
+
+    // Count the cells each triangle bounding box covers
+    #pragma omp parallel for
+    for (int64_t triangleIndex = 0; triangleIndex < triangleCount; ++triangleIndex) {
+        const size_t indexBase = static_cast<size_t>(triangleIndex) * 3;
+        const uint32_t i0 = indices[indexBase];
+        const uint32_t i1 = indices[indexBase + 1];
+        const uint32_t i2 = indices[indexBase + 2];
+        if (i0 >= vertices.size() || i1 >= vertices.size() || i2 >= vertices.size()) {
+            continue;
         }
 
-        const int threadId = omp_get_thread_num();
+        const glm::vec3& v0 = vertices[i0];
+        const glm::vec3& v1 = vertices[i1];
+        const glm::vec3& v2 = vertices[i2];
 
-        #pragma omp for
-        for (int indexBase = 0; indexBase < static_cast<int>(indices.size()); indexBase += 3) {
-            const uint32_t i0 = indices[static_cast<size_t>(indexBase)];
-            const uint32_t i1 = indices[static_cast<size_t>(indexBase + 1)];
-            const uint32_t i2 = indices[static_cast<size_t>(indexBase + 2)];
-            if (i0 >= vertices.size() || i1 >= vertices.size() || i2 >= vertices.size()) {
-                continue;
-            }
+        const glm::ivec3 cellMin = worldToCell(glm::min(glm::min(v0, v1), v2));
+        const glm::ivec3 cellMax = worldToCell(glm::max(glm::max(v0, v1), v2));
+        const glm::ivec3 extent = glm::max(cellMax - cellMin + glm::ivec3(1), glm::ivec3(0));
 
-            const glm::vec3& v0 = vertices[i0];
-            const glm::vec3& v1 = vertices[i1];
-            const glm::vec3& v2 = vertices[i2];
+        cellMins[triangleIndex] = cellMin;
+        cellMaxs[triangleIndex] = cellMax;
+        pairOffsets[static_cast<size_t>(triangleIndex) + 1] =
+            static_cast<size_t>(extent.x) * static_cast<size_t>(extent.y) * static_cast<size_t>(extent.z);
+    }
 
-            const glm::vec3 triMin = glm::min(glm::min(v0, v1), v2);
-            const glm::vec3 triMax = glm::max(glm::max(v0, v1), v2);
+    for (size_t triangleIndex = 0; triangleIndex < triangleTotal; ++triangleIndex) {
+        pairOffsets[triangleIndex + 1] += pairOffsets[triangleIndex];
+    }
 
-            const glm::ivec3 cellMin = worldToCell(triMin);
-            const glm::ivec3 cellMax = worldToCell(triMax);
-            const size_t triangleIndex = static_cast<size_t>(indexBase / 3);
+    const size_t pairCount = pairOffsets.back();
+    if (pairCount == 0) {
+        return;
+    }
+    if (pairCount > std::numeric_limits<uint32_t>::max()) {
+        std::cerr << "[TriangleHashGrid] Cell/triangle pair count exceeds 32-bit range, cell size too small" << std::endl;
+        return;
+    }
+
+    std::vector<size_t> pairCells(pairCount);
+
+    #pragma omp parallel for
+    for (int64_t triangleIndex = 0; triangleIndex < triangleCount; ++triangleIndex) {
+        size_t pairIndex = pairOffsets[triangleIndex];
+        if (pairIndex == pairOffsets[static_cast<size_t>(triangleIndex) + 1]) {
+            continue;
+        }
 
-            for (int z = cellMin.z; z <= cellMax.z; ++z) {
-                for (int y = cellMin.y; y <= cellMax.y; ++y) {
-                    for (int x = cellMin.x; x <= cellMax.x; ++x) {
-                        const size_t hash = hashCell(x, y, z);
-                        threadLocalGrids[threadId][hash].push_back(triangleIndex);
-                    }
+        const glm::ivec3& cellMin = cellMins[triangleIndex];
+        const glm::ivec3& cellMax = cellMaxs[triangleIndex];
+        for (int z = cellMin.z; z <= cellMax.z; ++z) {
+            for (int y = cellMin.y; y <= cellMax.y; ++y) {
+                for (int x = cellMin.x; x <= cellMax.x; ++x) {
+                    pairCells[pairIndex++] = hashCell(x, y, z);
                 }
             }
         }
     }
 
-    for (const auto& localGrid : threadLocalGrids) {
-        for (const auto& [hash, triangles] : localGrid) {
-            grid_[hash].insert(grid_[hash].end(), triangles.begin(), triangles.end());
+    std::vector<uint32_t> pairSlots(pairCount);
+    buildCellTable(pairCells, pairSlots);
+
+    const int64_t pairTotal = static_cast<int64_t>(pairCount);
+    const int64_t cellCount = static_cast<int64_t>(cellOffsets_.size() - 1);
+
+    #pragma omp parallel for
+    for (int64_t pairIndex = 0; pairIndex < pairTotal; ++pairIndex) {
+        #pragma omp atomic
+        ++cellOffsets_[static_cast<size_t>(pairSlots[pairIndex]) + 1];
+    }
+
+    for (int64_t cell = 0; cell < cellCount; ++cell) {
+        cellOffsets_[static_cast<size_t>(cell) + 1] += cellOffsets_[cell];
+    }
+
+    std::vector<std::atomic<uint32_t>> cellCursors(static_cast<size_t>(cellCount));
+    for (int64_t cell = 0; cell < cellCount; ++cell) {
+        cellCursors[cell].store(cellOffsets_[cell], std::memory_order_relaxed);
+    }
+
+    cellTriangles_.resize(pairCount);
+
+    #pragma omp parallel for
+    for (int64_t triangleIndex = 0; triangleIndex < triangleCount; ++triangleIndex) {
+        const size_t pairEnd = pairOffsets[static_cast<size_t>(triangleIndex) + 1];
+        for (size_t pairIndex = pairOffsets[triangleIndex]; pairIndex < pairEnd; ++pairIndex) {
+            const uint32_t writeIndex = cellCursors[pairSlots[pairIndex]].fetch_add(1u, std::memory_order_relaxed);
+            cellTriangles_[writeIndex] = static_cast<uint32_t>(triangleIndex);
+        }
+    }
+
+    // Scatter order depends on thread timing; sort each cell so queries stay deterministic
+    #pragma omp parallel for schedule(dynamic, 256)
+    for (int64_t cell = 0; cell < cellCount; ++cell) {
+        const uint32_t begin = cellOffsets_[cell];
+        const uint32_t end = cellOffsets_[static_cast<size_t>(cell) + 1];
+        if (end - begin > 1) {
+            std::sort(cellTriangles_.begin() + begin, cellTriangles_.begin() + end);
+        }
+    }
+
+    triangleCount_ = static_cast<uint32_t>(triangleTotal);
+}
+
+void TriangleHashGrid::buildCellTable(const std::vector<size_t>& pairCells, std::vector<uint32_t>& outPairSlots) {
+    const size_t totalCells =
+        static_cast<size_t>(gridDim_.x) * static_cast<size_t>(gridDim_.y) * static_cast<size_t>(gridDim_.z);
+    const int64_t pairTotal = static_cast<int64_t>(pairCells.size());
+
+    denseCells_ = totalCells <= std::max(DENSE_CELL_LIMIT, pairCells.size() * 4) &&
+        totalCells < std::numeric_limits<uint32_t>::max();
+    if (denseCells_) {
+        cellOffsets_.assign(totalCells + 1, 0u);
+
+        #pragma omp parallel for
+        for (int64_t pairIndex = 0; pairIndex < pairTotal; ++pairIndex) {
+            outPairSlots[pairIndex] = static_cast<uint32_t>(pairCells[pairIndex]);
+        }
+        return;
+    }
+
+    // Sparse grids only store occupied cells; pairs never exceed 32 bits so the
+    // compact cell index fits in uint32_t.
+    size_t slotCount = 16;
+    while (slotCount < pairCells.size() * 2) {
+        slotCount <<= 1;
+    }
+    slotKeys_.assign(slotCount, EMPTY_SLOT);
+    slotCells_.assign(slotCount, 0u);
+
+    const size_t mask = slotCount - 1;
+    uint32_t occupiedCount = 0;
+    for (size_t pairIndex = 0; pairIndex < pairCells.size(); ++pairIndex) {
+        const size_t hash = pairCells[pairIndex];
+        size_t slot = mixCellKey(hash) & mask;
+        while (slotKeys_[slot] != hash && slotKeys_[slot] != EMPTY_SLOT) {
+            slot = (slot + 1) & mask;
+        }
+        if (slotKeys_[slot] == EMPTY_SLOT) {
+            slotKeys_[slot] = hash;
+            slotCells_[slot] = occupiedCount++;
         }
+        outPairSlots[pairIndex] = slotCells_[slot];
     }
 
+    cellOffsets_.assign(static_cast<size_t>(occupiedCount) + 1, 0u);
 }
 
-void TriangleHashGrid::addCellTriangles(size_t hash, std::unordered_set<size_t>& seenTriangles, std::vector<size_t>& outTriangles) const {
-    const auto it = grid_.find(hash);
-    if (it == grid_.end()) {
+void TriangleHashGrid::addCellTriangles(size_t hash, uint32_t* visitStamps, uint32_t generation, std::vector<size_t>& outTriangles) const {
+    uint32_t begin = 0;
+    uint32_t end = 0;
+    if (!findCellRange(hash, begin, end)) {
         return;
     }
 
-    for (size_t triangleIndex : it->second) {
-        if (seenTriangles.insert(triangleIndex).second) {
+    for (uint32_t i = begin; i < end; ++i) {
+        const uint32_t triangleIndex = cellTriangles_[i];
+        if (visitStamps[triangleIndex] != generation) {
+            visitStamps[triangleIndex] = generation;
             outTriangles.push_back(triangleIndex);
         }
     }
@@ -1,8 +1,7 @@
 ﻿#pragma once
 #include <glm/glm.hpp>
+#include <cstdint>
 #include <vector>
-#include <unordered_map>
-#include <unordered_set>
 
 class Model;
 
@@ -22,18 +21,79 @@ public:
     void getNearbyTriangles(const glm::vec3& position, int radiusCells, std::vector<size_t>& outTriangles) const;
     void getTrianglesAlongRay(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, std::vector<size_t>& outTriangles) const;
 
+    // Visits the raw triangle list of one cell without deduplication.
+    template <typename Fn>
+    void forEachCellTriangle(int x, int y, int z, Fn&& fn) const {
+        if (x < 0 || x >= gridDim_.x || y < 0 || y >= gridDim_.y || z < 0 || z >= gridDim_.z) {
+            return;
+        }
+        uint32_t begin = 0;
+        uint32_t end = 0;
+        if (!findCellRange(hashCell(x, y, z), begin, end)) {
+            return;
+        }
+        for (uint32_t i = begin; i < end; ++i) {
+            fn(cellTriangles_[i]);
+        }
+    }
+
+    glm::ivec3 worldToCell(const glm::vec3& pos) const;
+    const glm::ivec3& getGridDim() const { return gridDim_; }
+
 private:
     void clear();
     void initializeGrid(const glm::vec3& gridMin, const glm::vec3& gridMax, float cellSize);
     void buildTriangles(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices);
-    void addCellTriangles(size_t hash, std::unordered_set<size_t>& seenTriangles, std::vector<size_t>& outTriangles) const;
+    void buildCellTable(const std::vector<size_t>& pairCells, std::vector<uint32_t>& outPairSlots);
+    bool findCellRange(size_t hash, uint32_t& outBegin, uint32_t& outEnd) const;
+    void addCellTriangles(size_t hash, uint32_t* visitStamps, uint32_t generation, std::vector<size_t>& outTriangles) const;
     size_t hashCell(int x, int y, int z) const;
-    glm::ivec3 worldToCell(const glm::vec3& pos) const;
+    static size_t mixCellKey(size_t hash) {
+        uint64_t key = static_cast<uint64_t>(hash);
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdull;
+        key ^= key >> 33;
+        return static_cast<size_t>(key);
+    }
 
-    std::unordered_map<size_t, std::vector<size_t>> grid_;  
+    static constexpr size_t EMPTY_SLOT = ~static_cast<size_t>(0);
+    static constexpr size_t DENSE_CELL_LIMIT = size_t(1) << 22;
+
+    // CSR cell storage. Dense grids index cellOffsets_ by hashCell directly;
+    // larger grids map occupied cells through an open-addressed slot table.
+    std::vector<uint32_t> cellOffsets_;
+    std::vector<uint32_t> cellTriangles_;
+    std::vector<size_t> slotKeys_;
+    std::vector<uint32_t> slotCells_;
+    bool denseCells_ = true;
+    uint32_t triangleCount_ = 0;
     glm::vec3 gridMin_;
     glm::vec3 gridMax_;
     float cellSize_;
     glm::ivec3 gridDim_;
 
 };
+
+inline bool TriangleHashGrid::findCellRange(size_t hash, uint32_t& outBegin, uint32_t& outEnd) const {
+    size_t cell = hash;
+    if (!denseCells_) {
+        if (slotKeys_.empty()) {
+            return false;
+        }
+        const size_t mask = slotKeys_.size() - 1;
+        size_t slot = mixCellKey(hash) & mask;
+        while (slotKeys_[slot] != hash) {
+            if (slotKeys_[slot] == EMPTY_SLOT) {
+                return false;
+            }
+            slot = (slot + 1) & mask;
+        }
+        cell = slotCells_[slot];
+    } else if (cell + 1 >= cellOffsets_.size()) {
+        return false;
+    }
+
+    outBegin = cellOffsets_[cell];
+    outEnd = cellOffsets_[cell + 1];
+    return outBegin != outEnd;
+}
@@ -1,14 +1,9 @@
 ﻿#include "VoxelGrid.hpp"
-#include "TriangleHashGrid.hpp"
 #include "util/GeometryUtils.hpp"
 #include <iostream>
 #include <algorithm>
 #include <cmath>
 #include <cfloat>
-#include <climits>
-#include <set>
-#include <unordered_set>
-#include <unordered_map>
 #include <fstream>
 #include <omp.h>
 
@@ -221,6 +216,7 @@ VoxelGrid::VoxelGrid() {
     params.cellSize = 1.0f;
     params.gridDim = glm::ivec3(1);
     params.totalCells = 1;
+    brickDim = glm::ivec3(0);
 }
 
 VoxelGrid::~VoxelGrid() {
@@ -229,7 +225,6 @@ VoxelGrid::~VoxelGrid() {
 void VoxelGrid::build(
     const std::vector<glm::vec3>& positions,
     const std::vector<uint32_t>& indices,
-    const TriangleHashGrid& triangleGrid,
     int gridSize) {
     // Calculate grid parameters from mesh bounding box
     if (positions.empty()) {
@@ -257,361 +252,541 @@ void VoxelGrid::build(
     params.gridDim = glm::ivec3(gridSize);
     params.totalCells = static_cast<uint32_t>(gridSize * gridSize * gridSize);
 
-    float canonicalVoxelSize = CANONICAL_DOMAIN_SIZE / float(gridSize);
-    float worldVoxelSize = canonicalVoxelSize / scale;
+    meshPoints.assign(positions.begin(), positions.end());
+    meshTriangles.assign(indices.begin(), indices.end());
 
-    // Build triangle lists 
-    buildTriangleLists(positions, indices, triangleGrid);
+    // Enough bricks to cover the gridSize + 1 corners per axis
+    brickDim = glm::ivec3((gridSize + BRICK_SIZE) / BRICK_SIZE);
 
-    int numCorners = (gridSize + 1) * (gridSize + 1) * (gridSize + 1);
-    occupancy.assign(numCorners, 0);  // Default: OUTSIDE
+    std::vector<uint32_t> brickCandidateOffsets;
+    std::vector<int32_t> brickCandidates;
+    binTrianglesToBricks(positions, indices, brickCandidateOffsets, brickCandidates);
+    buildSurfaceBricks(positions, indices, brickCandidateOffsets, brickCandidates);
+    classifySurfaceCorners(positions, indices, brickCandidateOffsets, brickCandidates);
+    floodFillUniformBricks(positions, indices, brickCandidateOffsets, brickCandidates);
+}
 
-    int dimX = params.gridDim.x;
-    int dimY = params.gridDim.y;
-    int dimZ = params.gridDim.z;
+void VoxelGrid::binTrianglesToBricks(
+    const std::vector<glm::vec3>& positions,
+    const std::vector<uint32_t>& indices,
+    std::vector<uint32_t>& brickCandidateOffsets,
+    std::vector<int32_t>& brickCandidates) const {
+    const float canonicalVoxelSize = CANONICAL_DOMAIN_SIZE / float(params.gridDim.x);
+    const float brickExtent = BRICK_SIZE * canonicalVoxelSize;
+
+    // Covers the brick's voxels and the border distance of its corners
+    const float margin = 0.125f * canonicalVoxelSize;
+    const float brickHalfSize[3] = {
+        0.5f * brickExtent + margin,
+        0.5f * brickExtent + margin,
+        0.5f * brickExtent + margin,
+    };
+
+    const int triCount = static_cast<int>(indices.size() / 3);
+    std::vector<std::vector<uint64_t>> threadBrickTriangles;
 
-    const float borderThreshold = worldVoxelSize * 0.1f;
+    #pragma omp parallel
+    {
+        #pragma omp single
+        {
+            threadBrickTriangles.resize(static_cast<size_t>(omp_get_num_threads()));
+        }
 
-    int borderCount = 0;
+        auto& localBrickTriangles = threadBrickTriangles[static_cast<size_t>(omp_get_thread_num())];
 
-    // Find border corners using fast distance check
-    #pragma omp parallel for reduction(+:borderCount)
-    for (int z = 0; z <= dimZ; z++) {
-        for (int y = 0; y <= dimY; y++) {
-            for (int x = 0; x <= dimX; x++) {
-                glm::vec3 canonicalCornerPos = glm::vec3(x, y, z) * canonicalVoxelSize;
-                glm::vec3 cornerPos = toWorld(canonicalCornerPos);
-                float dist = distanceToNearestTriangle(cornerPos, positions, indices, triangleGrid);
+        #pragma omp for schedule(static)
+        for (int t = 0; t < triCount; t++) {
+            uint32_t i0 = indices[3 * t + 0];
+            uint32_t i1 = indices[3 * t + 1];
+            uint32_t i2 = indices[3 * t + 2];
+            if (i0 >= positions.size() || i1 >= positions.size() || i2 >= positions.size()) {
+                continue;
+            }
 
-                size_t idx = getCornerIndex(x, y, z);
+            glm::vec3 c0 = toCanonical(positions[i0]);
+            glm::vec3 c1 = toCanonical(positions[i1]);
+            glm::vec3 c2 = toCanonical(positions[i2]);
+            glm::vec3 bbMin = glm::min(glm::min(c0, c1), c2) - glm::vec3(margin);
+            glm::vec3 bbMax = glm::max(glm::max(c0, c1), c2) + glm::vec3(margin);
 
-                if (dist < borderThreshold) {
-                    occupancy[idx] = 1;  // Border
-                    borderCount++;
-                } else {
-                    occupancy[idx] = 255; // OUTSIDE
+            glm::ivec3 b0 = glm::clamp(glm::ivec3(glm::floor(bbMin / brickExtent)), glm::ivec3(0), brickDim - 1);
+            glm::ivec3 b1 = glm::clamp(glm::ivec3(glm::floor(bbMax / brickExtent)), glm::ivec3(0), brickDim - 1);
+
+            float triverts[3][3] = {
+                { c0.x, c0.y, c0.z },
+                { c1.x, c1.y, c1.z },
+                { c2.x, c2.y, c2.z },
+            };
+
+            for (int bz = b0.z; bz <= b1.z; bz++) {
+                for (int by = b0.y; by <= b1.y; by++) {
+                    for (int bx = b0.x; bx <= b1.x; bx++) {
+                        float boxcenter[3] = {
+                            (bx + 0.5f) * brickExtent,
+                            (by + 0.5f) * brickExtent,
+                            (bz + 0.5f) * brickExtent,
+                        };
+                        if (!triBoxOverlap(boxcenter, brickHalfSize, triverts)) {
+                            continue;
+                        }
+                        const uint64_t brickIdx = getBrickIndex(bx, by, bz);
+                        localBrickTriangles.push_back((brickIdx << 32) | static_cast<uint32_t>(t));
+                    }
                 }
             }
         }
     }
 
-    const size_t triCount = indices.size() / 3;
-    const glm::vec3 rayDir(1.0f, 0.0f, 0.0f);
-    const float duplicateHitEpsilon = worldVoxelSize * 1e-3f;
+    std::vector<uint64_t> brickTrianglePairs;
+    for (const auto& localBrickTriangles : threadBrickTriangles) {
+        brickTrianglePairs.insert(brickTrianglePairs.end(), localBrickTriangles.begin(), localBrickTriangles.end());
+    }
+    std::sort(brickTrianglePairs.begin(), brickTrianglePairs.end());
+
+    const size_t brickCount = static_cast<size_t>(brickDim.x) * brickDim.y * brickDim.z;
+    brickCandidateOffsets.assign(brickCount + 1, 0);
+    brickCandidates.resize(brickTrianglePairs.size());
+    for (size_t i = 0; i < brickTrianglePairs.size(); i++) {
+        brickCandidateOffsets[(brickTrianglePairs[i] >> 32) + 1]++;
+        brickCandidates[i] = static_cast<int32_t>(brickTrianglePairs[i] & 0xFFFFFFFFu);
+    }
+    for (size_t b = 0; b < brickCount; b++) {
+        brickCandidateOffsets[b + 1] += brickCandidateOffsets[b];
+    }
+}
 
-    std::vector<glm::vec3> triV0;
-    std::vector<glm::vec3> triV1;
-    std::vector<glm::vec3> triV2;
-    triV0.reserve(triCount);
-    triV1.reserve(triCount);
-    triV2.reserve(triCount);
-    for (size_t t = 0; t < triCount; t++) {
-        const size_t base = t * 3;
-        if (indices[base + 0] >= positions.size() ||
-            indices[base + 1] >= positions.size() ||
-            indices[base + 2] >= positions.size()) {
-            triV0.push_back(glm::vec3(0.0f));
-            triV1.push_back(glm::vec3(0.0f));
-            triV2.push_back(glm::vec3(0.0f));
-            continue;
+void VoxelGrid::buildSurfaceBricks(
+    const std::vector<glm::vec3>& positions,
+    const std::vector<uint32_t>& indices,
+    const std::vector<uint32_t>& brickCandidateOffsets,
+    const std::vector<int32_t>& brickCandidates) {
+    const int gridSize = params.gridDim.x;
+    const float canonicalVoxelSize = CANONICAL_DOMAIN_SIZE / float(gridSize);
+    const float borderThreshold = (canonicalVoxelSize / params.cellSize) * 0.1f;
+    const float canonicalBorderThreshold = canonicalVoxelSize * 0.1f;
+    const float voxelHalfSize[3] = {
+        0.5f * canonicalVoxelSize,
+        0.5f * canonicalVoxelSize,
+        0.5f * canonicalVoxelSize,
+    };
+
+    const size_t brickCount = static_cast<size_t>(brickDim.x) * brickDim.y * brickDim.z;
+    brickSlots.assign(brickCount, BRICK_UNCLASSIFIED);
+    uint32_t slotCount = 0;
+    for (size_t b = 0; b < brickCount; b++) {
+        if (brickCandidateOffsets[b + 1] > brickCandidateOffsets[b]) {
+            brickSlots[b] = slotCount++;
         }
-        triV0.push_back(positions[indices[base + 0]]);
-        triV1.push_back(positions[indices[base + 1]]);
-        triV2.push_back(positions[indices[base + 2]]);
     }
 
-    int insideCount = 0;
-    int outsideCount = 0;
+    brickOccupancy.assign(static_cast<size_t>(slotCount) * BRICK_CELLS, 0);
+    brickVoxelOffsets.assign(static_cast<size_t>(slotCount) * (BRICK_CELLS + 1), 0);
+    std::vector<std::vector<int32_t>> slotTriangles(slotCount);
 
-    // Classify each (y,z) corner column once 
-    #pragma omp parallel reduction(+:insideCount, outsideCount)
+    #pragma omp parallel
     {
-        std::vector<int32_t> candidateTriangles;
-        candidateTriangles.reserve(512);
-        std::vector<int32_t> triStamp(triCount, -1);
-        int stamp = 0;
-        std::vector<float> hitX;
-        std::vector<float> uniqueHitX;
-
-        const int yCount = dimY + 1;
-        const int zCount = dimZ + 1;
-        const int yzCount = yCount * zCount;
+        std::vector<std::pair<int, int32_t>> voxelTriangles;
+        std::vector<int32_t> cellCounts(BRICK_CELLS + 1);
 
-        #pragma omp for schedule(dynamic, 1)
-        for (int yz = 0; yz < yzCount; yz++) {
-                const int y = yz % yCount;
-                const int z = yz / yCount;
-                stamp++;
-                if (stamp == INT_MAX) {
-                    std::fill(triStamp.begin(), triStamp.end(), -1);
-                    stamp = 1;
-                }
+        #pragma omp for schedule(dynamic, 16)
+        for (int b = 0; b < static_cast<int>(brickCount); b++) {
+            const uint32_t slot = brickSlots[static_cast<size_t>(b)];
+            if (slot >= BRICK_UNCLASSIFIED) {
+                continue;
+            }
 
-                candidateTriangles.clear();
-
-                // Corner lies on voxel boundaries in y/z
-                const int yCells[2] = { clampInt(y - 1, 0, dimY - 1), clampInt(y, 0, dimY - 1) };
-                const int zCells[2] = { clampInt(z - 1, 0, dimZ - 1), clampInt(z, 0, dimZ - 1) };
-
-                for (int xCell = 0; xCell < dimX; xCell++) {
-                    for (int yi = 0; yi < 2; yi++) {
-                        for (int zi = 0; zi < 2; zi++) {
-                            const int voxelIdx = xCell + yCells[yi] * dimX + zCells[zi] * dimX * dimY;
-                            const int begin = offsets[voxelIdx];
-                            const int end = offsets[voxelIdx + 1];
-                            for (int it = begin; it < end; it++) {
-                                const int32_t triId = trianglesList[it];
-                                if (triId < 0 || static_cast<size_t>(triId) >= triCount) {
-                                    continue;
-                                }
-                                if (triStamp[static_cast<size_t>(triId)] == stamp) {
-                                    continue;
-                                }
-                                triStamp[static_cast<size_t>(triId)] = stamp;
-                                candidateTriangles.push_back(triId);
+            const glm::ivec3 origin = BRICK_SIZE * glm::ivec3(
+                b % brickDim.x,
+                (b / brickDim.x) % brickDim.y,
+                b / (brickDim.x * brickDim.y));
+            const glm::ivec3 voxelLimit = glm::min(origin + (BRICK_SIZE - 1), glm::ivec3(gridSize - 1));
+            const glm::ivec3 cornerLimit = glm::min(origin + (BRICK_SIZE - 1), glm::ivec3(gridSize));
+            uint8_t* occupancy = brickOccupancy.data() + static_cast<size_t>(slot) * BRICK_CELLS;
+
+            voxelTriangles.clear();
+            for (uint32_t c = brickCandidateOffsets[b]; c < brickCandidateOffsets[b + 1]; c++) {
+                const int32_t t = brickCandidates[c];
+                const glm::vec3& w0 = positions[indices[3 * t + 0]];
+                const glm::vec3& w1 = positions[indices[3 * t + 1]];
+                const glm::vec3& w2 = positions[indices[3 * t + 2]];
+                glm::vec3 c0 = toCanonical(w0);
+                glm::vec3 c1 = toCanonical(w1);
+                glm::vec3 c2 = toCanonical(w2);
+                glm::vec3 bbMin = glm::min(glm::min(c0, c1), c2);
+                glm::vec3 bbMax = glm::max(glm::max(c0, c1), c2);
+
+                float triverts[3][3] = {
+                    { c0.x, c0.y, c0.z },
+                    { c1.x, c1.y, c1.z },
+                    { c2.x, c2.y, c2.z },
+                };
+
+                glm::ivec3 v0 = glm::max(glm::ivec3(glm::floor(bbMin / canonicalVoxelSize)), origin);
+                glm::ivec3 v1 = glm::min(glm::ivec3(glm::ceil(bbMax / canonicalVoxelSize)), voxelLimit);
+                for (int z = v0.z; z <= v1.z; z++) {
+                    for (int y = v0.y; y <= v1.y; y++) {
+                        for (int x = v0.x; x <= v1.x; x++) {
+                            float boxcenter[3] = {
+                                (x + 0.5f) * canonicalVoxelSize,
+                                (y + 0.5f) * canonicalVoxelSize,
+                                (z + 0.5f) * canonicalVoxelSize,
+                            };
+                            if (triBoxOverlap(boxcenter, voxelHalfSize, triverts)) {
+                                voxelTriangles.push_back({ getBrickCellIndex(x, y, z), t });
                             }
                         }
                     }
                 }
 
-                // If no candidates for this column, everything here is outside except borders
-                if (candidateTriangles.empty()) {
-                    for (int x = 0; x <= dimX; x++) {
-                        const size_t idx = getCornerIndex(x, y, z);
-                        if (occupancy[idx] == 1) {
-                            continue;
+                // Border corners lie within a tenth of a voxel of a triangle
+                glm::ivec3 k0 = glm::max(glm::ivec3(glm::ceil((bbMin - canonicalBorderThreshold) / canonicalVoxelSize)), origin);
+                glm::ivec3 k1 = glm::min(glm::ivec3(glm::floor((bbMax + canonicalBorderThreshold) / canonicalVoxelSize)), cornerLimit);
+                for (int z = k0.z; z <= k1.z; z++) {
+                    for (int y = k0.y; y <= k1.y; y++) {
+                        for (int x = k0.x; x <= k1.x; x++) {
+                            uint8_t& occ = occupancy[getBrickCellIndex(x, y, z)];
+                            if (occ == 1) {
+                                continue;
+                            }
+                            const glm::vec3 cornerPos = getCornerPosition(x, y, z);
+                            if (glm::length(cornerPos - closestPointOnTriangle(cornerPos, w0, w1, w2)) < borderThreshold) {
+                                occ = 1;
+                            }
                         }
-                        occupancy[idx] = 0;
-                        outsideCount++;
-                    }
-                    continue;
-                }
-
-                const glm::vec3 canonicalCol = glm::vec3(0.0f, static_cast<float>(y), static_cast<float>(z)) * canonicalVoxelSize;
-                glm::vec3 columnBase = toWorld(canonicalCol);
-                columnBase.x = params.gridMin.x - worldVoxelSize;
-
-                hitX.clear();
-                hitX.reserve(candidateTriangles.size());
-
-                for (int32_t triId : candidateTriangles) {
-                    const size_t triIdx = static_cast<size_t>(triId);
-
-                    float tHit = 0.0f;
-                    float uDummy = 0.0f;
-                    float vDummy = 0.0f;
-                    if (intersectRayTriangle(columnBase, rayDir, triV0[triIdx], triV1[triIdx], triV2[triIdx], tHit, uDummy, vDummy)) {
-                        hitX.push_back(columnBase.x + tHit);
                     }
                 }
+            }
 
-                std::sort(hitX.begin(), hitX.end());
-
-                // Collapse nearly identical hits 
-                uniqueHitX.clear();
-                uniqueHitX.reserve(hitX.size());
-                for (float xHit : hitX) {
-                    if (uniqueHitX.empty() || std::abs(xHit - uniqueHitX.back()) > duplicateHitEpsilon) {
-                        uniqueHitX.push_back(xHit);
+            // Corners still unset are classified by ray parity
+            for (int z = origin.z; z <= cornerLimit.z; z++) {
+                for (int y = origin.y; y <= cornerLimit.y; y++) {
+                    for (int x = origin.x; x <= cornerLimit.x; x++) {
+                        uint8_t& occ = occupancy[getBrickCellIndex(x, y, z)];
+                        if (occ != 1) {
+                            occ = 255;
+                        }
                     }
                 }
+            }
 
-                size_t hitPtr = 0;
-                float cornerX = params.gridMin.x;
-                for (int x = 0; x <= dimX; x++, cornerX += worldVoxelSize) {
-                    const size_t idx = getCornerIndex(x, y, z);
-                    if (occupancy[idx] == 1) {
-                        continue;
-                    }
-
-                    while (hitPtr < uniqueHitX.size() && uniqueHitX[hitPtr] <= cornerX) {
-                        hitPtr++;
-                    }
-                    const int numHitsToLeft = static_cast<int>(hitPtr);
-                    const bool isInside = (numHitsToLeft & 1) == 1;
-
-                    if (isInside) {
-                        occupancy[idx] = 2;
-                        insideCount++;
-                    } else {
-                        occupancy[idx] = 0;
-                        outsideCount++;
-                    }
-                }
+            // Candidates are visited in ascending order, so the stable counting
+            // sort keeps each voxel's triangle list sorted
+            std::fill(cellCounts.begin(), cellCounts.end(), 0);
+            for (const auto& [cell, t] : voxelTriangles) {
+                cellCounts[cell + 1]++;
+            }
+            int32_t* voxelOffsets = brickVoxelOffsets.data() + static_cast<size_t>(slot) * (BRICK_CELLS + 1);
+            for (int cell = 0; cell < BRICK_CELLS; cell++) {
+                voxelOffsets[cell + 1] = voxelOffsets[cell] + cellCounts[cell + 1];
+            }
+            std::vector<int32_t>& triangles = slotTriangles[slot];
+            triangles.resize(voxelTriangles.size());
+            std::copy(voxelOffsets, voxelOffsets + BRICK_CELLS, cellCounts.begin());
+            for (const auto& [cell, t] : voxelTriangles) {
+                triangles[cellCounts[cell]++] = t;
+            }
         }
     }
 
-}
-
-float VoxelGrid::distanceToNearestTriangle(
-    const glm::vec3& point,
-    const std::vector<glm::vec3>& positions,
-    const std::vector<uint32_t>& indices,
-    const TriangleHashGrid& triangleGrid) const {
-    std::vector<size_t> nearbyTriangles;
-    triangleGrid.getNearbyTriangles(point, nearbyTriangles);
-    
-    if (nearbyTriangles.empty()) {
-        return FLT_MAX;
-    }
-    
-    float minDist = FLT_MAX;
-    for (size_t triIdx : nearbyTriangles) {
-        const size_t indexBase = triIdx * 3;
-        if (indexBase + 2 >= indices.size()) {
-            continue;
+    brickTriangles.clear();
+    for (uint32_t slot = 0; slot < slotCount; slot++) {
+        const int32_t base = static_cast<int32_t>(brickTriangles.size());
+        int32_t* voxelOffsets = brickVoxelOffsets.data() + static_cast<size_t>(slot) * (BRICK_CELLS + 1);
+        for (int cell = 0; cell <= BRICK_CELLS; cell++) {
+            voxelOffsets[cell] += base;
         }
-        if (indices[indexBase] >= positions.size() ||
-            indices[indexBase + 1] >= positions.size() ||
-            indices[indexBase + 2] >= positions.size()) {
-            continue;
-        }
-
-        const glm::vec3& v0 = positions[indices[indexBase]];
-        const glm::vec3& v1 = positions[indices[indexBase + 1]];
-        const glm::vec3& v2 = positions[indices[indexBase + 2]];
-        
-        glm::vec3 closest = closestPointOnTriangle(point, v0, v1, v2);
-        float dist = glm::length(point - closest);
-        minDist = std::min(minDist, dist);
+        brickTriangles.insert(brickTriangles.end(), slotTriangles[slot].begin(), slotTriangles[slot].end());
     }
-    
-    return minDist;
 }
 
-
-
-void VoxelGrid::buildTriangleLists(
+void VoxelGrid::collectColumnHits(
+    int y,
+    int z,
     const std::vector<glm::vec3>& positions,
     const std::vector<uint32_t>& indices,
-    const TriangleHashGrid& triangleGrid) {
-    meshPoints.clear();
-    meshTriangles.clear();
-    trianglesList.clear();
-    offsets.clear();
-
-    meshPoints.reserve(positions.size());
-    for (const glm::vec3& position : positions) {
-        meshPoints.push_back(position);
-    }
+    const std::vector<int32_t>& rowTriangles,
+    std::vector<float>& hitX) const {
+    const float worldVoxelSize = (CANONICAL_DOMAIN_SIZE / float(params.gridDim.x)) / params.cellSize;
+    const float duplicateHitEpsilon = worldVoxelSize * 1e-3f;
+    const glm::vec3 rayDir(1.0f, 0.0f, 0.0f);
 
-    meshTriangles.reserve(indices.size());
-    for (uint32_t idx : indices) {
-        meshTriangles.push_back(static_cast<int32_t>(idx));
+    glm::vec3 columnBase = getCornerPosition(0, y, z);
+    columnBase.x = params.gridMin.x - worldVoxelSize;
+
+    hitX.clear();
+    for (int32_t t : rowTriangles) {
+        float tHit = 0.0f;
+        float uDummy = 0.0f;
+        float vDummy = 0.0f;
+        if (intersectRayTriangle(
+                columnBase, rayDir,
+                positions[indices[3 * t + 0]], positions[indices[3 * t + 1]], positions[indices[3 * t + 2]],
+                tHit, uDummy, vDummy)) {
+            hitX.push_back(columnBase.x + tHit);
+        }
     }
 
-    int gridSize = params.gridDim.x;
-    int numVoxels = params.gridDim.x * params.gridDim.y * params.gridDim.z;
-    offsets.resize(numVoxels + 1, 0);
-
-    float canonicalVoxelSize = CANONICAL_DOMAIN_SIZE / float(gridSize);
+    std::sort(hitX.begin(), hitX.end());
 
-    std::vector<std::vector<int32_t>> voxelTriangles(static_cast<size_t>(numVoxels));
-    std::vector<std::unordered_map<int, std::vector<int32_t>>> threadLocalVoxelTriangles;
+    // Collapse nearly identical hits
+    size_t uniqueCount = 0;
+    for (float xHit : hitX) {
+        if (uniqueCount == 0 || std::abs(xHit - hitX[uniqueCount - 1]) > duplicateHitEpsilon) {
+            hitX[uniqueCount++] = xHit;
+        }
+    }
+    hitX.resize(uniqueCount);
+}
 
-    size_t triCount = indices.size() / 3;
+void VoxelGrid::classifySurfaceCorners(
+    const std::vector<glm::vec3>& positions,
+    const std::vector<uint32_t>& indices,
+    const std::vector<uint32_t>& brickCandidateOffsets,
+    const std::vector<int32_t>& brickCandidates) {
+    const int gridSize = params.gridDim.x;
+    const size_t triCount = indices.size() / 3;
+    const int rowCount = brickDim.y * brickDim.z;
 
+    // Every triangle crossing a corner column is a candidate of a brick in the
+    // column's brick row, so each row gathers its triangles once
     #pragma omp parallel
     {
-        #pragma omp single
-        {
-            threadLocalVoxelTriangles.resize(static_cast<size_t>(omp_get_num_threads()));
-        }
-
-        const int threadId = omp_get_thread_num();
-        auto& localVoxelTriangles = threadLocalVoxelTriangles[static_cast<size_t>(threadId)];
+        std::vector<int32_t> triStamp(triCount, -1);
+        std::vector<int32_t> rowTriangles;
+        std::vector<float> hitX;
 
-        #pragma omp for schedule(static)
-        for (int t = 0; t < static_cast<int>(triCount); t++) {
-            uint32_t i0 = indices[3 * t + 0];
-            uint32_t i1 = indices[3 * t + 1];
-            uint32_t i2 = indices[3 * t + 2];
-            if (i0 >= positions.size() || i1 >= positions.size() || i2 >= positions.size()) {
+        #pragma omp for schedule(dynamic, 1)
+        for (int row = 0; row < rowCount; row++) {
+            const int by = row % brickDim.y;
+            const int bz = row / brickDim.y;
+
+            rowTriangles.clear();
+            for (int bx = 0; bx < brickDim.x; bx++) {
+                const size_t brickIdx = getBrickIndex(bx, by, bz);
+                if (brickSlots[brickIdx] >= BRICK_UNCLASSIFIED) {
+                    continue;
+                }
+                for (uint32_t c = brickCandidateOffsets[brickIdx]; c < brickCandidateOffsets[brickIdx + 1]; c++) {
+                    const int32_t t = brickCandidates[c];
+                    if (triStamp[static_cast<size_t>(t)] != row) {
+                        triStamp[static_cast<size_t>(t)] = row;
+                        rowTriangles.push_back(t);
+                    }
+                }
+            }
+            if (rowTriangles.empty()) {
                 continue;
             }
 
-            glm::vec3 w0 = positions[i0];
-            glm::vec3 w1 = positions[i1];
-            glm::vec3 w2 = positions[i2];
-
-            glm::vec3 c0 = toCanonical(w0);
-            glm::vec3 c1 = toCanonical(w1);
-            glm::vec3 c2 = toCanonical(w2);
-
-            glm::vec3 bbMin(FLT_MAX), bbMax(-FLT_MAX);
-            bbMin = glm::min(bbMin, c0); bbMax = glm::max(bbMax, c0);
-            bbMin = glm::min(bbMin, c1); bbMax = glm::max(bbMax, c1);
-            bbMin = glm::min(bbMin, c2); bbMax = glm::max(bbMax, c2);
-
-            int vx0 = clampInt(static_cast<int>(std::floor(bbMin.x / canonicalVoxelSize)), 0, gridSize - 1);
-            int vy0 = clampInt(static_cast<int>(std::floor(bbMin.y / canonicalVoxelSize)), 0, gridSize - 1);
-            int vz0 = clampInt(static_cast<int>(std::floor(bbMin.z / canonicalVoxelSize)), 0, gridSize - 1);
-            int vx1 = clampInt(static_cast<int>(std::ceil (bbMax.x / canonicalVoxelSize)), 0, gridSize - 1);
-            int vy1 = clampInt(static_cast<int>(std::ceil (bbMax.y / canonicalVoxelSize)), 0, gridSize - 1);
-            int vz1 = clampInt(static_cast<int>(std::ceil (bbMax.z / canonicalVoxelSize)), 0, gridSize - 1);
-
-            float triverts[3][3] = {
-                { c0.x, c0.y, c0.z },
-                { c1.x, c1.y, c1.z },
-                { c2.x, c2.y, c2.z },
-            };
-
-            for (int z = vz0; z <= vz1; z++) {
-                for (int y = vy0; y <= vy1; y++) {
-                    for (int x = vx0; x <= vx1; x++) {
-                        float boxcenter[3] = {
-                            (x + 0.5f) * canonicalVoxelSize,
-                            (y + 0.5f) * canonicalVoxelSize,
-                            (z + 0.5f) * canonicalVoxelSize,
-                        };
-                        float boxhalfsize[3] = {
-                            0.5f * canonicalVoxelSize,
-                            0.5f * canonicalVoxelSize,
-                            0.5f * canonicalVoxelSize,
-                        };
+            const int zEnd = std::min(bz * BRICK_SIZE + BRICK_SIZE - 1, gridSize);
+            const int yEnd = std::min(by * BRICK_SIZE + BRICK_SIZE - 1, gridSize);
+            for (int z = bz * BRICK_SIZE; z <= zEnd; z++) {
+                for (int y = by * BRICK_SIZE; y <= yEnd; y++) {
+                    collectColumnHits(y, z, positions, indices, rowTriangles, hitX);
 
-                        if (!triBoxOverlap(boxcenter, boxhalfsize, triverts)) {
+                    size_t hitPtr = 0;
+                    for (int bx = 0; bx < brickDim.x; bx++) {
+                        const uint32_t slot = brickSlots[getBrickIndex(bx, by, bz)];
+                        if (slot >= BRICK_UNCLASSIFIED) {
                             continue;
                         }
+                        uint8_t* occupancy = brickOccupancy.data() + static_cast<size_t>(slot) * BRICK_CELLS;
+                        const int xEnd = std::min(bx * BRICK_SIZE + BRICK_SIZE - 1, gridSize);
+                        for (int x = bx * BRICK_SIZE; x <= xEnd; x++) {
+                            uint8_t& occ = occupancy[getBrickCellIndex(x, y, z)];
+                            if (occ != 255) {
+                                continue;
+                            }
 
-                        int voxelIdx = x + y * gridSize + z * gridSize * gridSize;
-                        localVoxelTriangles[voxelIdx].push_back(static_cast<int32_t>(t));
+                            const float cornerX = getCornerPosition(x, y, z).x;
+                            while (hitPtr < hitX.size() && hitX[hitPtr] <= cornerX) {
+                                hitPtr++;
+                            }
+                            occ = (hitPtr & 1) ? 2 : 0;
+                        }
                     }
                 }
             }
         }
     }
+}
 
-    for (const auto& localVoxelTriangles : threadLocalVoxelTriangles) {
-        for (const auto& [voxelIdx, triIds] : localVoxelTriangles) {
-            auto& dst = voxelTriangles[static_cast<size_t>(voxelIdx)];
-            dst.insert(dst.end(), triIds.begin(), triIds.end());
+void VoxelGrid::floodFillUniformBricks(
+    const std::vector<glm::vec3>& positions,
+    const std::vector<uint32_t>& indices,
+    const std::vector<uint32_t>& brickCandidateOffsets,
+    const std::vector<int32_t>& brickCandidates) {
+    std::vector<size_t> queue;
+    auto fillFrom = [&](size_t start, uint32_t state) {
+        brickSlots[start] = state;
+        queue.clear();
+        queue.push_back(start);
+        while (!queue.empty()) {
+            const size_t brickIdx = queue.back();
+            queue.pop_back();
+            const int bx = static_cast<int>(brickIdx % brickDim.x);
+            const int by = static_cast<int>((brickIdx / brickDim.x) % brickDim.y);
+            const int bz = static_cast<int>(brickIdx / (static_cast<size_t>(brickDim.x) * brickDim.y));
+            const glm::ivec3 neighbors[6] = {
+                { bx - 1, by, bz }, { bx + 1, by, bz },
+                { bx, by - 1, bz }, { bx, by + 1, bz },
+                { bx, by, bz - 1 }, { bx, by, bz + 1 },
+            };
+            for (const glm::ivec3& n : neighbors) {
+                if (n.x < 0 || n.y < 0 || n.z < 0 || n.x >= brickDim.x || n.y >= brickDim.y || n.z >= brickDim.z) {
+                    continue;
+                }
+                const size_t neighborIdx = getBrickIndex(n.x, n.y, n.z);
+                if (brickSlots[neighborIdx] == BRICK_UNCLASSIFIED) {
+                    brickSlots[neighborIdx] = state;
+                    queue.push_back(neighborIdx);
+                }
+            }
+        }
+    };
+
+    // Bricks on the grid boundary contain corners beyond the mesh bounds
+    for (int bz = 0; bz < brickDim.z; bz++) {
+        for (int by = 0; by < brickDim.y; by++) {
+            for (int bx = 0; bx < brickDim.x; bx++) {
+                const bool onBoundary =
+                    bx == 0 || by == 0 || bz == 0 ||
+                    bx == brickDim.x - 1 || by == brickDim.y - 1 || bz == brickDim.z - 1;
+                const size_t brickIdx = getBrickIndex(bx, by, bz);
+                if (onBoundary && brickSlots[brickIdx] == BRICK_UNCLASSIFIED) {
+                    fillFrom(brickIdx, BRICK_OUTSIDE);
+                }
+            }
         }
     }
 
-    // Build flat triangle list and offsets
-    int currentOffset = 0;
-    for (int i = 0; i < numVoxels; i++) {
-        offsets[i] = currentOffset;
-        auto& list = voxelTriangles[static_cast<size_t>(i)];
-        std::sort(list.begin(), list.end());
-        list.erase(std::unique(list.begin(), list.end()), list.end());
-        for (int32_t triID : list) {
-            trianglesList.push_back(triID);
+    // Enclosed regions are either interior or cavities; one corner's ray parity decides
+    std::vector<int32_t> rowTriangles;
+    std::vector<float> hitX;
+    for (int bz = 0; bz < brickDim.z; bz++) {
+        for (int by = 0; by < brickDim.y; by++) {
+            for (int bx = 0; bx < brickDim.x; bx++) {
+                const size_t brickIdx = getBrickIndex(bx, by, bz);
+                if (brickSlots[brickIdx] != BRICK_UNCLASSIFIED) {
+                    continue;
+                }
+
+                rowTriangles.clear();
+                for (int rowBx = 0; rowBx < bx; rowBx++) {
+                    const size_t rowBrickIdx = getBrickIndex(rowBx, by, bz);
+                    rowTriangles.insert(
+                        rowTriangles.end(),
+                        brickCandidates.begin() + brickCandidateOffsets[rowBrickIdx],
+                        brickCandidates.begin() + brickCandidateOffsets[rowBrickIdx + 1]);
+                }
+                std::sort(rowTriangles.begin(), rowTriangles.end());
+                rowTriangles.erase(std::unique(rowTriangles.begin(), rowTriangles.end()), rowTriangles.end());
+
+                const glm::ivec3 corner = BRICK_SIZE * glm::ivec3(bx, by, bz);
+                collectColumnHits(corner.y, corner.z, positions, indices, rowTriangles, hitX);
+                const float cornerX = getCornerPosition(corner.x, corner.y, corner.z).x;
+                const size_t hitsToLeft = static_cast<size_t>(
+                    std::upper_bound(hitX.begin(), hitX.end(), cornerX) - hitX.begin());
+                fillFrom(brickIdx, (hitsToLeft & 1) ? BRICK_INSIDE : BRICK_OUTSIDE);
+            }
         }
-        currentOffset += static_cast<int>(list.size());
     }
-    offsets[numVoxels] = currentOffset;
-
 }
 
 uint8_t VoxelGrid::getOccupancy(int x, int y, int z) const {
-    if (x < 0 || x > params.gridDim.x ||
+    if (brickSlots.empty() ||
+        x < 0 || x > params.gridDim.x ||
         y < 0 || y > params.gridDim.y ||
         z < 0 || z > params.gridDim.z) {
         return 0;  // Outside
     }
-    return occupancy[getCornerIndex(x, y, z)];
+    const uint32_t slot = brickSlots[getBrickIndex(x / BRICK_SIZE, y / BRICK_SIZE, z / BRICK_SIZE)];
+    if (slot == BRICK_INSIDE) {
+        return 2;
+    }
+    if (slot >= BRICK_UNCLASSIFIED) {
+        return 0;
+    }
+    return brickOccupancy[static_cast<size_t>(slot) * BRICK_CELLS + getBrickCellIndex(x, y, z)];
+}
+
+void VoxelGrid::getVoxelTriangles(int x, int y, int z, const int32_t*& begin, const int32_t*& end) const {
+    begin = nullptr;
+    end = nullptr;
+    if (brickSlots.empty() ||
+        x < 0 || x >= params.gridDim.x ||
+        y < 0 || y >= params.gridDim.y ||
+        z < 0 || z >= params.gridDim.z) {
+        return;
+    }
+    const uint32_t slot = brickSlots[getBrickIndex(x / BRICK_SIZE, y / BRICK_SIZE, z / BRICK_SIZE)];
+    if (slot >= BRICK_UNCLASSIFIED) {
+        return;
+    }
+    const int32_t* voxelOffsets = brickVoxelOffsets.data() + static_cast<size_t>(slot) * (BRICK_CELLS + 1);
+    const int cell = getBrickCellIndex(x, y, z);
+    begin = brickTriangles.data() + voxelOffsets[cell];
+    end = brickTriangles.data() + voxelOffsets[cell + 1];
+}
+
+std::vector<uint8_t> VoxelGrid::getOccupancyData() const {
+    std::vector<uint8_t> occupancy;
+    if (brickSlots.empty()) {
+        return occupancy;
+    }
+
+    const int stride = params.gridDim.x + 1;
+    occupancy.resize(static_cast<size_t>(stride) * stride * stride);
+    for (int z = 0; z < stride; z++) {
+        for (int y = 0; y < stride; y++) {
+            for (int x = 0; x < stride; x++) {
+                occupancy[getCornerIndex(x, y, z)] = getOccupancy(x, y, z);
+            }
+        }
+    }
+    return occupancy;
+}
+
+std::vector<int32_t> VoxelGrid::getTrianglesList() const {
+    std::vector<int32_t> trianglesList;
+    trianglesList.reserve(brickTriangles.size());
+    const int gridSize = params.gridDim.x;
+    for (int z = 0; z < gridSize && !brickSlots.empty(); z++) {
+        for (int y = 0; y < gridSize; y++) {
+            for (int x = 0; x < gridSize; x++) {
+                const int32_t* begin = nullptr;
+                const int32_t* end = nullptr;
+                getVoxelTriangles(x, y, z, begin, end);
+                trianglesList.insert(trianglesList.end(), begin, end);
+            }
+        }
+    }
+    return trianglesList;
+}
+
+std::vector<int32_t> VoxelGrid::getOffsets() const {
+    std::vector<int32_t> offsets;
+    if (brickSlots.empty()) {
+        return offsets;
+    }
+
+    const int gridSize = params.gridDim.x;
+    offsets.resize(static_cast<size_t>(gridSize) * gridSize * gridSize + 1);
+    int32_t currentOffset = 0;
+    size_t voxelIdx = 0;
+    for (int z = 0; z < gridSize; z++) {
+        for (int y = 0; y < gridSize; y++) {
+            for (int x = 0; x < gridSize; x++) {
+                const int32_t* begin = nullptr;
+                const int32_t* end = nullptr;
+                getVoxelTriangles(x, y, z, begin, end);
+                offsets[voxelIdx++] = currentOffset;
+                currentOffset += static_cast<int32_t>(end - begin);
+            }
+        }
+    }
+    offsets[voxelIdx] = currentOffset;
+    return offsets;
 }
 
 glm::vec3 VoxelGrid::getCornerPosition(int x, int y, int z) const {
@@ -637,6 +812,14 @@ size_t VoxelGrid::getCornerIndex(int x, int y, int z) const {
     return z * stride * stride + y * stride + x;
 }
 
+size_t VoxelGrid::getBrickIndex(int bx, int by, int bz) const {
+    return (static_cast<size_t>(bz) * brickDim.y + by) * brickDim.x + bx;
+}
+
+int VoxelGrid::getBrickCellIndex(int x, int y, int z) {
+    return ((z % BRICK_SIZE) * BRICK_SIZE + (y % BRICK_SIZE)) * BRICK_SIZE + (x % BRICK_SIZE);
+}
+
 void VoxelGrid::exportOccupancyVisualization(const std::string& filename) const {
     int dimX = params.gridDim.x;
     int dimY = params.gridDim.y;
@@ -647,7 +830,7 @@ void VoxelGrid::exportOccupancyVisualization(const std::string& filename) const
     for (int z = 0; z <= dimZ; z++) {
         for (int y = 0; y <= dimY; y++) {
             for (int x = 0; x <= dimX; x++) {
-                uint8_t occ = occupancy[getCornerIndex(x, y, z)];
+                uint8_t occ = getOccupancy(x, y, z);
                 if (occ == 1) borderCount++;
                 else if (occ == 2) insideCount++;
             }
@@ -678,7 +861,7 @@ void VoxelGrid::exportOccupancyVisualization(const std::string& filename) const
     for (int z = 0; z <= dimZ; z++) {
         for (int y = 0; y <= dimY; y++) {
             for (int x = 0; x <= dimX; x++) {
-                uint8_t occ = occupancy[getCornerIndex(x, y, z)];
+                uint8_t occ = getOccupancy(x, y, z);
                 if (occ == 0) 
                     continue;
 
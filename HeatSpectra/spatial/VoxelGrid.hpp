@@ -7,8 +7,6 @@
 
 #include <glm/glm.hpp>
 
-class TriangleHashGrid;
-
 class VoxelGrid {
 public:
     struct VoxelGridParams {
@@ -24,51 +22,91 @@ public:
     void build(
         const std::vector<glm::vec3>& positions,
         const std::vector<uint32_t>& indices,
-        const TriangleHashGrid& triangleGrid,
         int gridSize);
     uint8_t getOccupancy(int x, int y, int z) const;
     glm::vec3 getCornerPosition(int x, int y, int z) const;
     glm::ivec3 worldToVoxel(const glm::vec3& pos) const;
 
+    // Triangles overlapping voxel (x, y, z), empty away from the surface
+    void getVoxelTriangles(int x, int y, int z, const int32_t*& begin, const int32_t*& end) const;
+
     void exportOccupancyVisualization(const std::string& filename) const;
 
     // Getters
-    const std::vector<uint8_t>& getOccupancyData() const { return occupancy; }
     const VoxelGridParams& getParams() const { return params; }
     int getGridSize() const { return params.gridDim.x; }
-        
+    size_t getSurfaceBrickCount() const { return brickOccupancy.size() / BRICK_CELLS; }
+
     const std::vector<glm::vec3>& getMeshPoints() const { return meshPoints; }
     const std::vector<int32_t>& getMeshTriangles() const { return meshTriangles; }
-    const std::vector<int32_t>& getTrianglesList() const { return trianglesList; }
-    const std::vector<int32_t>& getOffsets() const { return offsets; }
+
+    // Dense per-corner occupancy and per-voxel triangle lists expanded from the
+    // bricks, in the layout the GPU voxel buffers use. heat_geometry.slang still
+    // indexes the dense layout, so bricks only cut build time and host memory;
+    // the GPU upload stays (gridSize+1)^3 corners and gridSize^3 + 1 offsets.
+    std::vector<uint8_t> getOccupancyData() const;
+    std::vector<int32_t> getTrianglesList() const;
+    std::vector<int32_t> getOffsets() const;
 
 private:
     static constexpr float CANONICAL_DOMAIN_SIZE = 1000.0f;
     static constexpr float CANONICAL_SCALE = 990.222f;
     static constexpr float CANONICAL_BIAS = 4.998f;
+    static constexpr int BRICK_SIZE = 8;
+    static constexpr int BRICK_CELLS = BRICK_SIZE * BRICK_SIZE * BRICK_SIZE;
+    static constexpr uint32_t BRICK_OUTSIDE = UINT32_MAX;
+    static constexpr uint32_t BRICK_INSIDE = UINT32_MAX - 1;
+    static constexpr uint32_t BRICK_UNCLASSIFIED = UINT32_MAX - 2;
+
     glm::vec3 toCanonical(const glm::vec3& worldPos) const;
     glm::vec3 toWorld(const glm::vec3& canonicalPos) const;
     static int clampInt(int v, int lo, int hi) { return std::max(lo, std::min(v, hi)); }
     
     static bool triBoxOverlap(const float boxcenter[3], const float boxhalfsize[3], const float triverts[3][3]);
-    float distanceToNearestTriangle(
-        const glm::vec3& point,
-        const std::vector<glm::vec3>& positions,
-        const std::vector<uint32_t>& indices,
-        const TriangleHashGrid& triangleGrid) const;
 
     size_t getCornerIndex(int x, int y, int z) const;
+    size_t getBrickIndex(int bx, int by, int bz) const;
+    static int getBrickCellIndex(int x, int y, int z);
 
-    void buildTriangleLists(
+    void binTrianglesToBricks(
+        const std::vector<glm::vec3>& positions,
+        const std::vector<uint32_t>& indices,
+        std::vector<uint32_t>& brickCandidateOffsets,
+        std::vector<int32_t>& brickCandidates) const;
+    void buildSurfaceBricks(
+        const std::vector<glm::vec3>& positions,
+        const std::vector<uint32_t>& indices,
+        const std::vector<uint32_t>& brickCandidateOffsets,
+        const std::vector<int32_t>& brickCandidates);
+    void classifySurfaceCorners(
+        const std::vector<glm::vec3>& positions,
+        const std::vector<uint32_t>& indices,
+        const std::vector<uint32_t>& brickCandidateOffsets,
+        const std::vector<int32_t>& brickCandidates);
+    void floodFillUniformBricks(
+        const std::vector<glm::vec3>& positions,
+        const std::vector<uint32_t>& indices,
+        const std::vector<uint32_t>& brickCandidateOffsets,
+        const std::vector<int32_t>& brickCandidates);
+    void collectColumnHits(
+        int y,
+        int z,
         const std::vector<glm::vec3>& positions,
         const std::vector<uint32_t>& indices,
-        const TriangleHashGrid& triangleGrid);
+        const std::vector<int32_t>& rowTriangles,
+        std::vector<float>& hitX) const;
 
     VoxelGridParams params;  
-    std::vector<uint8_t> occupancy;
+    glm::ivec3 brickDim;
+
+    // Corners and voxels are grouped into BRICK_SIZE^3 bricks. Bricks that no
+    // triangle touches hold a single state; surface bricks own a slot in the
+    // per-corner occupancy and per-voxel triangle list pools.
+    std::vector<uint32_t> brickSlots;         // Surface slot, BRICK_OUTSIDE or BRICK_INSIDE
+    std::vector<uint8_t> brickOccupancy;      // BRICK_CELLS corners per slot
+    std::vector<int32_t> brickVoxelOffsets;   // BRICK_CELLS + 1 offsets into brickTriangles per slot
+    std::vector<int32_t> brickTriangles;
     
     std::vector<glm::vec3> meshPoints;
     std::vector<int32_t> meshTriangles;
-    std::vector<int32_t> trianglesList;
-    std::vector<int32_t> offsets;
 };
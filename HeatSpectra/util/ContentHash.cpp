@@ -0,0 +1,58 @@
+#include "ContentHash.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+namespace {
+
+uint64_t byteWiseMixBytes(uint64_t hash, const void* data, size_t size) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t index = 0; index < size; ++index) {
+        hash ^= static_cast<uint64_t>(bytes[index]) + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
+
+template <typename Function>
+double measureBytesPerSecond(size_t byteCount, int repetitions, Function&& function) {
+    double bestSeconds = 0.0;
+    for (int repetition = 0; repetition < repetitions; ++repetition) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (repetition == 0 || seconds < bestSeconds) {
+            bestSeconds = seconds;
+        }
+    }
+    return bestSeconds > 0.0 ? static_cast<double>(byteCount) / bestSeconds : 0.0;
+}
+
+}
+
+namespace ContentHash {
+
+BenchmarkResult benchmark(size_t byteCount, int repetitions) {
+    BenchmarkResult result{};
+    result.byteCount = byteCount;
+    repetitions = std::max(repetitions, 1);
+
+    std::vector<unsigned char> data(byteCount);
+    uint64_t state = PRIME5;
+    for (unsigned char& value : data) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        value = static_cast<unsigned char>(state >> 56);
+    }
+
+    // Fold results into a sink so the calls cannot be optimized away
+    volatile uint64_t sink = 0;
+    result.byteWiseBytesPerSecond = measureBytesPerSecond(byteCount, repetitions, [&]() {
+        sink = sink ^ byteWiseMixBytes(1469598103934665603ull, data.data(), data.size());
+    });
+    result.blockBytesPerSecond = measureBytesPerSecond(byteCount, repetitions, [&]() {
+        sink = sink ^ hashBytes(data.data(), data.size(), 1469598103934665603ull);
+    });
+    return result;
+}
+
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Block hash for bulk content (geometry arrays, intrinsic meshes). Input is consumed
+// in 32-byte stripes across four independent 64-bit lanes in the style of xxHash64,
+// so the inner loop has no cross-lane dependency. Results are only stable for one
+// byte order, so anything keyed on them on disk must treat a mismatch as a miss.
+namespace ContentHash {
+
+constexpr uint64_t PRIME1 = 0x9E3779B185EBCA87ull;
+constexpr uint64_t PRIME2 = 0xC2B2AE3D27D4EB4Full;
+constexpr uint64_t PRIME3 = 0x165667B19E3779F9ull;
+constexpr uint64_t PRIME4 = 0x85EBCA77C2B2AE63ull;
+constexpr uint64_t PRIME5 = 0x27D4EB2F165667C5ull;
+constexpr size_t STRIPE_SIZE = 32;
+
+inline uint64_t rotl(uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+inline uint64_t read64(const unsigned char* bytes) {
+    uint64_t value = 0;
+    std::memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+inline uint32_t read32(const unsigned char* bytes) {
+    uint32_t value = 0;
+    std::memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+inline uint64_t mixLane(uint64_t accumulator, uint64_t lane) {
+    accumulator += lane * PRIME2;
+    accumulator = rotl(accumulator, 31);
+    return accumulator * PRIME1;
+}
+
+inline uint64_t mergeRound(uint64_t hash, uint64_t accumulator) {
+    hash ^= mixLane(0, accumulator);
+    return hash * PRIME1 + PRIME4;
+}
+
+inline uint64_t avalanche(uint64_t hash) {
+    hash ^= hash >> 33;
+    hash *= PRIME2;
+    hash ^= hash >> 29;
+    hash *= PRIME3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+inline uint64_t hashBytes(const void* data, size_t size, uint64_t seed) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    const unsigned char* const end = bytes + size;
+    uint64_t hash = 0;
+
+    if (size >= STRIPE_SIZE) {
+        uint64_t lane0 = seed + PRIME1 + PRIME2;
+        uint64_t lane1 = seed + PRIME2;
+        uint64_t lane2 = seed;
+        uint64_t lane3 = seed - PRIME1;
+        const unsigned char* const stripeEnd = end - STRIPE_SIZE;
+        do {
+            lane0 = mixLane(lane0, read64(bytes));
+            lane1 = mixLane(lane1, read64(bytes + 8));
+            lane2 = mixLane(lane2, read64(bytes + 16));
+            lane3 = mixLane(lane3, read64(bytes + 24));
+            bytes += STRIPE_SIZE;
+        } while (bytes <= stripeEnd);
+
+        hash = rotl(lane0, 1) + rotl(lane1, 7) + rotl(lane2, 12) + rotl(lane3, 18);
+        hash = mergeRound(hash, lane0);
+        hash = mergeRound(hash, lane1);
+        hash = mergeRound(hash, lane2);
+        hash = mergeRound(hash, lane3);
+    } else {
+        hash = seed + PRIME5;
+    }
+
+    hash += static_cast<uint64_t>(size);
+    for (; bytes + 8 <= end; bytes += 8) {
+        hash ^= mixLane(0, read64(bytes));
+        hash = rotl(hash, 27) * PRIME1 + PRIME4;
+    }
+    if (bytes + 4 <= end) {
+        hash ^= static_cast<uint64_t>(read32(bytes)) * PRIME1;
+        hash = rotl(hash, 23) * PRIME2 + PRIME3;
+        bytes += 4;
+    }
+    for (; bytes < end; ++bytes) {
+        hash ^= static_cast<uint64_t>(*bytes) * PRIME5;
+        hash = rotl(hash, 11) * PRIME1;
+    }
+
+    return avalanche(hash);
+}
+
+struct BenchmarkResult {
+    size_t byteCount = 0;
+    double byteWiseBytesPerSecond = 0.0;
+    double blockBytesPerSecond = 0.0;
+};
+
+// Times the previous byte-at-a-time RuntimeProductHash::mixBytes against hashBytes
+// over byteCount pseudo-random bytes.
+BenchmarkResult benchmark(size_t byteCount, int repetitions);
+
+}
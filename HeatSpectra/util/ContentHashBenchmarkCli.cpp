@@ -0,0 +1,77 @@
+#include "ContentHashBenchmarkCli.hpp"
+
+#include "ContentHash.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+constexpr const char* BENCH_COMMAND = "--bench-hash";
+
+void printUsage() {
+    std::cerr << "Usage:\n"
+              << "  HeatSpectra " << BENCH_COMMAND << " [--bytes <count>]... [--repetitions <count>]" << std::endl;
+}
+
+bool parsePositive(const char* text, uint32_t& outValue) {
+    if (!text || *text == '\0') {
+        return false;
+    }
+    char* end = nullptr;
+    const unsigned long long value = std::strtoull(text, &end, 10);
+    if (*end != '\0' || value == 0 || value > UINT32_MAX) {
+        return false;
+    }
+    outValue = static_cast<uint32_t>(value);
+    return true;
+}
+
+}
+
+bool isContentHashBenchmarkCliInvocation(int argc, char** argv) {
+    return argc > 1 && argv[1] && std::strcmp(argv[1], BENCH_COMMAND) == 0;
+}
+
+int runContentHashBenchmarkCli(int argc, char** argv) {
+    std::vector<uint32_t> byteCounts;
+    uint32_t repetitions = 5;
+    for (int argIndex = 2; argIndex < argc; argIndex += 2) {
+        const char* option = argv[argIndex];
+        const char* value = argIndex + 1 < argc ? argv[argIndex + 1] : nullptr;
+        bool parsed = false;
+        if (std::strcmp(option, "--bytes") == 0) {
+            uint32_t byteCount = 0;
+            parsed = parsePositive(value, byteCount);
+            byteCounts.push_back(byteCount);
+        } else if (std::strcmp(option, "--repetitions") == 0) {
+            parsed = parsePositive(value, repetitions);
+        }
+        if (!parsed) {
+            printUsage();
+            return 1;
+        }
+    }
+    if (byteCounts.empty()) {
+        byteCounts = { 4u << 10, 64u << 10, 1u << 20, 16u << 20 };
+    }
+
+    constexpr double BYTES_PER_MEGABYTE = 1024.0 * 1024.0;
+    for (uint32_t byteCount : byteCounts) {
+        const ContentHash::BenchmarkResult result = ContentHash::benchmark(byteCount, static_cast<int>(repetitions));
+        const double speedup = result.byteWiseBytesPerSecond > 0.0
+            ? result.blockBytesPerSecond / result.byteWiseBytesPerSecond
+            : 0.0;
+        std::cout << std::setw(10) << result.byteCount << " bytes: "
+                  << std::fixed << std::setprecision(1)
+                  << "byte-wise " << std::setw(9) << result.byteWiseBytesPerSecond / BYTES_PER_MEGABYTE << " MB/s, "
+                  << "block " << std::setw(9) << result.blockBytesPerSecond / BYTES_PER_MEGABYTE << " MB/s, "
+                  << std::setprecision(2) << speedup << "x" << std::defaultfloat << "\n";
+    }
+    std::cout << std::flush;
+    return 0;
+}
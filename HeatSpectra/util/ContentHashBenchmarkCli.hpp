@@ -0,0 +1,7 @@
+#pragma once
+
+// Times ContentHash::hashBytes against the previous byte-wise mixBytes fold,
+// handled before the UI starts:
+//   --bench-hash [--bytes <count>]... [--repetitions <count>]
+bool isContentHashBenchmarkCliInvocation(int argc, char** argv);
+int runContentHashBenchmarkCli(int argc, char** argv);
@@ -0,0 +1,40 @@
+#include "ObjMeshLoader.hpp"
+
+#include <tiny_obj_loader.h>
+
+#include <iostream>
+
+bool loadObjTriangles(const std::string& path, std::vector<glm::vec3>& positions, std::vector<uint32_t>& indices) {
+    positions.clear();
+    indices.clear();
+
+    tinyobj::attrib_t attrib;
+    std::vector<tinyobj::shape_t> shapes;
+    std::vector<tinyobj::material_t> materials;
+    std::string warn, err;
+    if (!tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, path.c_str())) {
+        std::cerr << "[ObjMeshLoader] Failed to load model: " << path << std::endl;
+        return false;
+    }
+
+    positions.resize(attrib.vertices.size() / 3);
+    for (size_t i = 0; i < positions.size(); ++i) {
+        positions[i] = glm::vec3(attrib.vertices[3 * i + 0], attrib.vertices[3 * i + 1], attrib.vertices[3 * i + 2]);
+    }
+    for (const tinyobj::shape_t& shape : shapes) {
+        size_t indexOffset = 0;
+        for (const unsigned char faceVertexCount : shape.mesh.num_face_vertices) {
+            for (size_t k = 1; k + 1 < faceVertexCount; ++k) {
+                indices.push_back(static_cast<uint32_t>(shape.mesh.indices[indexOffset].vertex_index));
+                indices.push_back(static_cast<uint32_t>(shape.mesh.indices[indexOffset + k].vertex_index));
+                indices.push_back(static_cast<uint32_t>(shape.mesh.indices[indexOffset + k + 1].vertex_index));
+            }
+            indexOffset += faceVertexCount;
+        }
+    }
+    if (indices.empty()) {
+        std::cerr << "[ObjMeshLoader] No faces in " << path << std::endl;
+        return false;
+    }
+    return true;
+}
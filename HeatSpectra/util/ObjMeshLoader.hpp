@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+// Positions and fan-triangulated indices of every shape in an OBJ file, for the
+// command-line benchmarks that run without a Vulkan device.
+bool loadObjTriangles(const std::string& path, std::vector<glm::vec3>& positions, std::vector<uint32_t>& indices);
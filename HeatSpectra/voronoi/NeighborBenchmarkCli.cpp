@@ -0,0 +1,166 @@
+#include "NeighborBenchmarkCli.hpp"
+
+#include "VoronoiIntegrator.hpp"
+
+#include <libs/nanoflann/include/nanoflann.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr const char* BENCH_COMMAND = "--bench-neighbors";
+
+struct BenchmarkCloud {
+    const std::vector<glm::dvec3>& pts;
+    inline size_t kdtree_get_point_count() const { return pts.size(); }
+    inline double kdtree_get_pt(const size_t idx, const size_t dim) const {
+        return pts[idx][static_cast<glm::dvec3::length_type>(dim)];
+    }
+    template <class BBOX> bool kdtree_get_bbox(BBOX&) const { return false; }
+};
+
+void printUsage() {
+    std::cerr << "Usage:\n"
+              << "  HeatSpectra " << BENCH_COMMAND << " [--seeds <count>] [--k <neighbors>] [--runs <count>]" << std::endl;
+}
+
+bool parsePositive(const char* text, uint32_t& outValue) {
+    if (!text || *text == '\0') {
+        return false;
+    }
+    char* end = nullptr;
+    const unsigned long long value = std::strtoull(text, &end, 10);
+    if (*end != '\0' || value == 0 || value > UINT32_MAX) {
+        return false;
+    }
+    outValue = static_cast<uint32_t>(value);
+    return true;
+}
+
+// The per-seed query loop computeNeighbors used before it was batched
+std::vector<uint32_t> serialNeighbors(const std::vector<glm::dvec3>& seedPositions, int K) {
+    BenchmarkCloud cloud{seedPositions};
+    using KDTree = nanoflann::KDTreeSingleIndexAdaptor<
+        nanoflann::L2_Simple_Adaptor<double, BenchmarkCloud>,
+        BenchmarkCloud, 3>;
+
+    KDTree index(3, cloud, nanoflann::KDTreeSingleIndexAdaptorParams(10));
+    index.buildIndex();
+
+    std::vector<std::vector<uint32_t>> neighborIndices;
+    neighborIndices.reserve(seedPositions.size());
+    for (size_t i = 0; i < seedPositions.size(); i++) {
+        const double queryPoint[3] = {seedPositions[i].x, seedPositions[i].y, seedPositions[i].z};
+
+        std::vector<size_t> retIndices(K + 1);
+        std::vector<double> outDistsSqr(K + 1);
+        nanoflann::KNNResultSet<double> resultSet(K + 1);
+        resultSet.init(retIndices.data(), outDistsSqr.data());
+        index.findNeighbors(resultSet, queryPoint);
+
+        std::vector<uint32_t> kNeighbors;
+        // Only the first resultSet.size() slots are filled when there are K or fewer seeds
+        const size_t found = resultSet.size();
+        for (size_t j = 0; j < found && kNeighbors.size() < static_cast<size_t>(K); j++) {
+            if (retIndices[j] != i) {
+                kNeighbors.push_back(static_cast<uint32_t>(retIndices[j]));
+            }
+        }
+        while (kNeighbors.size() < static_cast<size_t>(K)) {
+            kNeighbors.push_back(UINT32_MAX);
+        }
+        neighborIndices.push_back(kNeighbors);
+    }
+
+    std::vector<uint32_t> flattened;
+    flattened.reserve(seedPositions.size() * K);
+    for (const auto& cellNeighbors : neighborIndices) {
+        flattened.insert(flattened.end(), cellNeighbors.begin(), cellNeighbors.end());
+    }
+    return flattened;
+}
+
+// Rows are compared as sets, since equidistant neighbors may come back in either order
+uint32_t countMismatchedRows(const std::vector<uint32_t>& lhs, const std::vector<uint32_t>& rhs, size_t seedCount, int K) {
+    uint32_t mismatches = 0;
+    std::vector<uint32_t> lhsRow(K);
+    std::vector<uint32_t> rhsRow(K);
+    for (size_t i = 0; i < seedCount; ++i) {
+        std::copy(lhs.begin() + i * K, lhs.begin() + (i + 1) * K, lhsRow.begin());
+        std::copy(rhs.begin() + i * K, rhs.begin() + (i + 1) * K, rhsRow.begin());
+        std::sort(lhsRow.begin(), lhsRow.end());
+        std::sort(rhsRow.begin(), rhsRow.end());
+        if (lhsRow != rhsRow) {
+            ++mismatches;
+        }
+    }
+    return mismatches;
+}
+
+}
+
+bool isNeighborBenchmarkCliInvocation(int argc, char** argv) {
+    return argc > 1 && argv[1] && std::strcmp(argv[1], BENCH_COMMAND) == 0;
+}
+
+int runNeighborBenchmarkCli(int argc, char** argv) {
+    uint32_t seedCount = 200000;
+    uint32_t neighborCount = 50;
+    uint32_t runCount = 3;
+    for (int argIndex = 2; argIndex < argc; argIndex += 2) {
+        const char* option = argv[argIndex];
+        const char* value = argIndex + 1 < argc ? argv[argIndex + 1] : nullptr;
+        uint32_t* target = nullptr;
+        if (std::strcmp(option, "--seeds") == 0) {
+            target = &seedCount;
+        } else if (std::strcmp(option, "--k") == 0) {
+            target = &neighborCount;
+        } else if (std::strcmp(option, "--runs") == 0) {
+            target = &runCount;
+        }
+        if (!target || !parsePositive(value, *target)) {
+            printUsage();
+            return 1;
+        }
+    }
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> uniform01(0.0, 1.0);
+    std::vector<glm::dvec3> seedPositions(seedCount);
+    for (glm::dvec3& position : seedPositions) {
+        position = glm::dvec3(uniform01(generator), uniform01(generator), uniform01(generator));
+    }
+
+    const int K = static_cast<int>(neighborCount);
+    using Clock = std::chrono::steady_clock;
+    double serialSeconds = 0.0;
+    double batchedSeconds = 0.0;
+    std::vector<uint32_t> serialResult;
+    VoronoiIntegrator integrator;
+    for (uint32_t run = 0; run < runCount; ++run) {
+        const Clock::time_point serialStart = Clock::now();
+        serialResult = serialNeighbors(seedPositions, K);
+        const Clock::time_point batchedStart = Clock::now();
+        integrator.computeNeighbors(seedPositions, K);
+        const Clock::time_point batchedEnd = Clock::now();
+
+        serialSeconds += std::chrono::duration<double>(batchedStart - serialStart).count();
+        batchedSeconds += std::chrono::duration<double>(batchedEnd - batchedStart).count();
+    }
+
+    const double totalQueries = static_cast<double>(seedCount) * runCount;
+    const uint32_t mismatches = countMismatchedRows(serialResult, integrator.getNeighborIndices(), seedCount, K);
+    std::cout << "Seeds " << seedCount << ", K " << K << ", runs " << runCount << "\n"
+              << "  serial   " << totalQueries / serialSeconds << " queries/s\n"
+              << "  batched  " << totalQueries / batchedSeconds << " queries/s ("
+              << serialSeconds / batchedSeconds << "x)\n"
+              << "  mismatched rows " << mismatches << std::endl;
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+// Times VoronoiIntegrator::computeNeighbors against one serial KD-tree query per
+// seed on uniformly random seeds, handled before the UI starts:
+//   --bench-neighbors [--seeds <count>] [--k <neighbors>] [--runs <count>]
+bool isNeighborBenchmarkCliInvocation(int argc, char** argv);
+int runNeighborBenchmarkCli(int argc, char** argv);
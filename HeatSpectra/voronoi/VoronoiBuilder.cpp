@@ -17,6 +17,7 @@
 #include <sstream>
 #include <unordered_set>
 #include <libs/nanoflann/include/nanoflann.hpp>
+#include <omp.h>
 
 namespace {
 
@@ -34,6 +35,14 @@ using KDTree = nanoflann::KDTreeSingleIndexAdaptor<
     SeedPointCloudAdapter,
     3>;
 
+// Surface points whose KNN queries are issued together before their GMLS solves
+constexpr int SURFACE_MAPPING_BATCH_SIZE = 64;
+
+// GPU/CPU clipper agreement, relative to the domain's largest cell volume and interface area
+constexpr float CLIPPER_CHECK_RELATIVE_TOLERANCE = 1e-3f;
+// Near-degenerate faces may be kept by one clipper and dropped by the other
+constexpr float CLIPPER_CHECK_MAX_COUNT_MISMATCH_FRACTION = 0.01f;
+
 } // namespace
 
 VoronoiBuilder::VoronoiBuilder(
@@ -502,7 +511,7 @@ bool VoronoiBuilder::rebuildOccupancyPointBuffer(const std::vector<VoronoiDomain
         if (!domain.voxelGridBuilt) {
             continue;
         }
-        estimatedPointCount += domain.voxelGrid.getOccupancyData().size() / 4;
+        estimatedPointCount += domain.voxelGrid.getSurfaceBrickCount() * 512;
     }
 
     std::vector<PointRenderer::PointVertex> points;
@@ -514,26 +523,16 @@ bool VoronoiBuilder::rebuildOccupancyPointBuffer(const std::vector<VoronoiDomain
         }
 
         const VoxelGrid& voxelGrid = domain.voxelGrid;
-        const auto& occupancy = voxelGrid.getOccupancyData();
         const auto& params = voxelGrid.getParams();
         const glm::mat4 modelMatrix = domain.modelRuntime->getModelMatrix();
         const int dimX = params.gridDim.x;
         const int dimY = params.gridDim.y;
         const int dimZ = params.gridDim.z;
-        const int stride = dimX + 1;
 
         for (int z = 0; z <= dimZ; ++z) {
             for (int y = 0; y <= dimY; ++y) {
                 for (int x = 0; x <= dimX; ++x) {
-                    const size_t idx =
-                        static_cast<size_t>(z) * static_cast<size_t>(stride) * static_cast<size_t>(stride) +
-                        static_cast<size_t>(y) * static_cast<size_t>(stride) +
-                        static_cast<size_t>(x);
-                    if (idx >= occupancy.size()) {
-                        continue;
-                    }
-
-                    const uint8_t occ = occupancy[idx];
+                    const uint8_t occ = voxelGrid.getOccupancy(x, y, z);
                     if (occ == 0) {
                         continue;
                     }
@@ -696,15 +695,44 @@ bool VoronoiBuilder::generateDiagram(
         }
     };
 
+    bool useGpuClipper = false;
     if (voronoiGeoCompute) {
         voronoiGeoCompute->initialize(resources.voronoiNodeCount);
+        useGpuClipper = voronoiGeoCompute->isInitialized();
+    }
+    if (!useGpuClipper) {
+        std::cerr << "[VoronoiBuilder] Voronoi geometry pipeline unavailable, clipping cells on the CPU" << std::endl;
     }
 
+    auto makeClipperInputs = [&](const VoronoiDomain& domain) {
+        VoronoiCellClipper::Inputs inputs;
+        inputs.seedPositions = globalSeedPositions.data();
+        inputs.seedFlags = globalSeedFlags.data();
+        inputs.neighborIndices = globalNeighborIndices.data();
+        inputs.maxNeighbors = maxNeighbors;
+        inputs.meshTriangles = &domain.integrator->getMeshTriangles();
+        inputs.voxelGrid = domain.voxelGridBuilt ? &domain.voxelGrid : nullptr;
+        inputs.nodeOffset = domain.nodeOffset;
+        inputs.nodeCount = domain.nodeCount;
+        return inputs;
+    };
+
     for (const VoronoiDomain& domain : receiverVoronoiDomains) {
         if (!domain.integrator || domain.nodeCount == 0) {
             continue;
         }
 
+        if (!useGpuClipper) {
+            VoronoiCellClipper clipper(makeClipperInputs(domain));
+            if (!clipper.clipCells(
+                    static_cast<voronoi::Node*>(resources.mappedVoronoiNodeData),
+                    static_cast<float*>(resources.mappedInterfaceAreasData),
+                    static_cast<uint32_t*>(resources.mappedInterfaceNeighborIdsData))) {
+                return false;
+            }
+            continue;
+        }
+
         void* mappedPtr = nullptr;
         freeBuffer(resources.meshTriangleBuffer, resources.meshTriangleBufferOffset);
         freeBuffer(resources.voxelGridParamsBuffer, resources.voxelGridParamsBufferOffset);
@@ -733,6 +761,7 @@ bool VoronoiBuilder::generateDiagram(
         std::vector<int32_t> trianglesList;
         std::vector<int32_t> offsets;
 
+        // The geometry shader indexes dense corner and voxel arrays, so the bricks are expanded here
         if (domain.voxelGridBuilt) {
             params = domain.voxelGrid.getParams();
             const auto& occupancy8 = domain.voxelGrid.getOccupancyData();
@@ -847,6 +876,11 @@ bool VoronoiBuilder::generateDiagram(
             geoPushConstants.nodeOffset = domain.nodeOffset;
             geoPushConstants.nodeCount = domain.nodeCount;
             voronoiGeoCompute->dispatch(geoPushConstants);
+
+            if (debugEnable && !compareWithCpuClipper(domain, makeClipperInputs(domain), maxNeighbors)) {
+                std::cerr << "[VoronoiBuilder] GPU Voronoi cells disagree with the CPU clipper for model "
+                          << domain.receiverModelId << std::endl;
+            }
         }
     }
 
@@ -876,6 +910,55 @@ bool VoronoiBuilder::generateDiagram(
     return rebuildOccupancyPointBuffer(receiverVoronoiDomains);
 }
 
+bool VoronoiBuilder::compareWithCpuClipper(
+    const VoronoiDomain& domain,
+    const VoronoiCellClipper::Inputs& clipperInputs,
+    uint32_t maxNeighbors) const {
+    if (!resources.mappedVoronoiNodeData || !resources.mappedInterfaceAreasData) {
+        std::cerr << "[VoronoiBuilder] CPU clipper check needs mapped node and interface buffers" << std::endl;
+        return false;
+    }
+
+    VoronoiCellClipper::HostCells cpuCells;
+    if (!VoronoiCellClipper(clipperInputs).clipCells(cpuCells)) {
+        return false;
+    }
+    const std::vector<voronoi::Node>& cpuNodes = cpuCells.nodes;
+    const std::vector<float>& cpuAreas = cpuCells.interfaceAreas;
+
+    const voronoi::Node* gpuNodes = static_cast<const voronoi::Node*>(resources.mappedVoronoiNodeData);
+    const float* gpuAreas = static_cast<const float*>(resources.mappedInterfaceAreasData);
+
+    float maxVolume = 0.0f;
+    float maxArea = 0.0f;
+    float maxVolumeDifference = 0.0f;
+    float maxAreaDifference = 0.0f;
+    uint32_t interfaceCountMismatches = 0;
+    for (uint32_t nodeIndex = domain.nodeOffset; nodeIndex < domain.nodeOffset + domain.nodeCount; ++nodeIndex) {
+        maxVolume = std::max(maxVolume, std::abs(cpuNodes[nodeIndex].volume));
+        maxVolumeDifference = std::max(maxVolumeDifference, std::abs(gpuNodes[nodeIndex].volume - cpuNodes[nodeIndex].volume));
+        if (gpuNodes[nodeIndex].interfaceNeighborCount != cpuNodes[nodeIndex].interfaceNeighborCount) {
+            ++interfaceCountMismatches;
+            continue;
+        }
+
+        const size_t base = static_cast<size_t>(nodeIndex) * static_cast<size_t>(maxNeighbors);
+        for (uint32_t slot = 0; slot < cpuNodes[nodeIndex].interfaceNeighborCount; ++slot) {
+            maxArea = std::max(maxArea, std::abs(cpuAreas[base + slot]));
+            maxAreaDifference = std::max(maxAreaDifference, std::abs(gpuAreas[base + slot] - cpuAreas[base + slot]));
+        }
+    }
+
+    std::cerr << "[VoronoiBuilder] CPU clipper check for model " << domain.receiverModelId
+              << ": max volume difference " << maxVolumeDifference
+              << ", max interface area difference " << maxAreaDifference
+              << ", interface count mismatches " << interfaceCountMismatches << "/" << domain.nodeCount << std::endl;
+
+    return maxVolumeDifference <= CLIPPER_CHECK_RELATIVE_TOLERANCE * maxVolume &&
+           maxAreaDifference <= CLIPPER_CHECK_RELATIVE_TOLERANCE * maxArea &&
+           interfaceCountMismatches <= static_cast<uint32_t>(CLIPPER_CHECK_MAX_COUNT_MISMATCH_FRACTION * domain.nodeCount);
+}
+
 bool VoronoiBuilder::stageSurfaceMappings(std::vector<VoronoiDomain>& receiverVoronoiDomains) const {
     for (VoronoiDomain& domain : receiverVoronoiDomains) {
         if (!domain.modelRuntime || !domain.integrator) {
@@ -924,73 +1007,148 @@ bool VoronoiBuilder::stageSurfaceMappings(std::vector<VoronoiDomain>& receiverVo
 
         const size_t supportCount = std::min<size_t>(32, regularSeedPositions.size());
 
+        // Pass 1: each thread appends its points' weights to its own buffers and
+        // records per-point counts and local offsets
+        const int pointCount = static_cast<int>(surfacePoints.size());
+        const int batchCount = (pointCount + SURFACE_MAPPING_BATCH_SIZE - 1) / SURFACE_MAPPING_BATCH_SIZE;
+        std::vector<uint32_t> pointThreads(surfacePoints.size(), 0);
+        std::vector<uint32_t> localValueOffsets(surfacePoints.size(), 0);
+        std::vector<uint32_t> localGradientOffsets(surfacePoints.size(), 0);
         std::vector<voronoi::GMLSSurfaceStencil> stencils(surfacePoints.size());
-        std::vector<voronoi::GMLSSurfaceWeight> valueWeights;
-        std::vector<voronoi::GMLSSurfaceGradientWeight> gradientWeights;
-        valueWeights.reserve(surfacePoints.size() * supportCount);
-        gradientWeights.reserve(surfacePoints.size() * supportCount);
-
-        std::vector<size_t> retIndices(supportCount, 0);
-        std::vector<float> outDistSq(supportCount, 0.0f);
-        std::vector<glm::dvec3> sourcePositions;
-        std::vector<double> valueWeightDoubles;
-        std::vector<glm::dvec3> gradientWeightTriples;
-        sourcePositions.reserve(supportCount);
-
-        for (size_t vertexIndex = 0; vertexIndex < surfacePoints.size(); ++vertexIndex) {
-            const glm::vec3& point = surfacePoints[vertexIndex];
-            const float query[3] = { point.x, point.y, point.z };
-
-            nanoflann::KNNResultSet<float> resultSet(supportCount);
-            resultSet.init(retIndices.data(), outDistSq.data());
-            index.findNeighbors(resultSet, query);
-
-            sourcePositions.clear();
-            float maxDistSq = 0.0f;
-            for (size_t neighborIndex = 0; neighborIndex < supportCount; ++neighborIndex) {
-                sourcePositions.push_back(glm::dvec3(regularSeedPositions[retIndices[neighborIndex]]));
-                if (outDistSq[neighborIndex] > maxDistSq) maxDistSq = outDistSq[neighborIndex];
+        std::vector<std::vector<voronoi::GMLSSurfaceWeight>> threadValueWeights;
+        std::vector<std::vector<voronoi::GMLSSurfaceGradientWeight>> threadGradientWeights;
+
+        #pragma omp parallel
+        {
+            #pragma omp single
+            {
+                threadValueWeights.resize(static_cast<size_t>(omp_get_num_threads()));
+                threadGradientWeights.resize(static_cast<size_t>(omp_get_num_threads()));
             }
-            const double kernelRadius = std::max<double>(static_cast<double>(std::sqrt(maxDistSq)) * 2.0, 1e-5);
-            const bool validWeights = GMLS::computeWeights(
-                glm::dvec3(point),
-                sourcePositions,
-                kernelRadius,
-                valueWeightDoubles,
-                gradientWeightTriples);
-
-            voronoi::GMLSSurfaceStencil& stencil = stencils[vertexIndex];
-            stencil.valueWeightOffset = static_cast<uint32_t>(valueWeights.size());
-            stencil.gradientWeightOffset = static_cast<uint32_t>(gradientWeights.size());
-            stencil.valueWeightCount = 0;
-            stencil.gradientWeightCount = 0;
-
-            if (!validWeights) {
-                continue;
-            }
-
-            for (size_t neighborIndex = 0; neighborIndex < supportCount; ++neighborIndex) {
-                const uint32_t globalCellIndex = regularGlobalCellIndices[retIndices[neighborIndex]];
-                const float valueWeight = static_cast<float>(valueWeightDoubles[neighborIndex]);
-                const glm::dvec3 gradientWeight = gradientWeightTriples[neighborIndex];
 
-                if (std::abs(valueWeight) > 1e-7f) {
-                    valueWeights.push_back({ globalCellIndex, valueWeight, 0u, 0u });
-                    ++stencil.valueWeightCount;
+            const int threadId = omp_get_thread_num();
+            auto& localValueWeights = threadValueWeights[static_cast<size_t>(threadId)];
+            auto& localGradientWeights = threadGradientWeights[static_cast<size_t>(threadId)];
+            const size_t expectedLocalWeights = (surfacePoints.size() / static_cast<size_t>(omp_get_num_threads()) + 1) * supportCount;
+            localValueWeights.reserve(expectedLocalWeights);
+            localGradientWeights.reserve(expectedLocalWeights);
+
+            std::vector<size_t> batchIndices(SURFACE_MAPPING_BATCH_SIZE * supportCount, 0);
+            std::vector<float> batchDistSq(SURFACE_MAPPING_BATCH_SIZE * supportCount, 0.0f);
+            std::vector<glm::dvec3> sourcePositions;
+            std::vector<double> valueWeightDoubles;
+            std::vector<glm::dvec3> gradientWeightTriples;
+            sourcePositions.reserve(supportCount);
+
+            #pragma omp for schedule(dynamic, 4)
+            for (int batch = 0; batch < batchCount; ++batch) {
+                const int batchBegin = batch * SURFACE_MAPPING_BATCH_SIZE;
+                const int batchEnd = std::min(batchBegin + SURFACE_MAPPING_BATCH_SIZE, pointCount);
+
+                // Run the batch's KNN queries back to back before any GMLS solve, so
+                // the tree nodes they share stay cached
+                for (int vertexIndex = batchBegin; vertexIndex < batchEnd; ++vertexIndex) {
+                    const glm::vec3& point = surfacePoints[vertexIndex];
+                    const float query[3] = { point.x, point.y, point.z };
+                    const size_t slot = static_cast<size_t>(vertexIndex - batchBegin) * supportCount;
+
+                    nanoflann::KNNResultSet<float> resultSet(supportCount);
+                    resultSet.init(batchIndices.data() + slot, batchDistSq.data() + slot);
+                    index.findNeighbors(resultSet, query);
                 }
 
-                if (glm::dot(gradientWeight, gradientWeight) > 1e-14) {
-                    gradientWeights.push_back({
-                        globalCellIndex,
-                        static_cast<float>(gradientWeight.x),
-                        static_cast<float>(gradientWeight.y),
-                        static_cast<float>(gradientWeight.z)
-                    });
-                    ++stencil.gradientWeightCount;
+                for (int vertexIndex = batchBegin; vertexIndex < batchEnd; ++vertexIndex) {
+                    const size_t slot = static_cast<size_t>(vertexIndex - batchBegin) * supportCount;
+                    const size_t* retIndices = batchIndices.data() + slot;
+                    const float* outDistSq = batchDistSq.data() + slot;
+
+                    sourcePositions.clear();
+                    float maxDistSq = 0.0f;
+                    for (size_t neighborIndex = 0; neighborIndex < supportCount; ++neighborIndex) {
+                        sourcePositions.push_back(glm::dvec3(regularSeedPositions[retIndices[neighborIndex]]));
+                        if (outDistSq[neighborIndex] > maxDistSq) maxDistSq = outDistSq[neighborIndex];
+                    }
+                    const double kernelRadius = std::max<double>(static_cast<double>(std::sqrt(maxDistSq)) * 2.0, 1e-5);
+                    const bool validWeights = GMLS::computeWeights(
+                        glm::dvec3(surfacePoints[vertexIndex]),
+                        sourcePositions,
+                        kernelRadius,
+                        valueWeightDoubles,
+                        gradientWeightTriples);
+
+                    voronoi::GMLSSurfaceStencil& stencil = stencils[vertexIndex];
+                    stencil.valueWeightCount = 0;
+                    stencil.gradientWeightCount = 0;
+                    pointThreads[vertexIndex] = static_cast<uint32_t>(threadId);
+                    localValueOffsets[vertexIndex] = static_cast<uint32_t>(localValueWeights.size());
+                    localGradientOffsets[vertexIndex] = static_cast<uint32_t>(localGradientWeights.size());
+
+                    if (!validWeights) {
+                        continue;
+                    }
+
+                    for (size_t neighborIndex = 0; neighborIndex < supportCount; ++neighborIndex) {
+                        const uint32_t globalCellIndex = regularGlobalCellIndices[retIndices[neighborIndex]];
+                        const float valueWeight = static_cast<float>(valueWeightDoubles[neighborIndex]);
+                        const glm::dvec3 gradientWeight = gradientWeightTriples[neighborIndex];
+
+                        if (std::abs(valueWeight) > 1e-7f) {
+                            localValueWeights.push_back({ globalCellIndex, valueWeight, 0u, 0u });
+                            ++stencil.valueWeightCount;
+                        }
+
+                        if (glm::dot(gradientWeight, gradientWeight) > 1e-14) {
+                            localGradientWeights.push_back({
+                                globalCellIndex,
+                                static_cast<float>(gradientWeight.x),
+                                static_cast<float>(gradientWeight.y),
+                                static_cast<float>(gradientWeight.z)
+                            });
+                            ++stencil.gradientWeightCount;
+                        }
+                    }
                 }
             }
         }
 
+        // Pass 2: prefix-sum the counts into stencil offsets, then scatter each
+        // point's weights into the flat arrays in vertex order
+        uint32_t valueWeightTotal = 0;
+        uint32_t gradientWeightTotal = 0;
+        for (voronoi::GMLSSurfaceStencil& stencil : stencils) {
+            stencil.valueWeightOffset = valueWeightTotal;
+            stencil.gradientWeightOffset = gradientWeightTotal;
+            valueWeightTotal += stencil.valueWeightCount;
+            gradientWeightTotal += stencil.gradientWeightCount;
+        }
+
+        std::vector<voronoi::GMLSSurfaceWeight> valueWeights;
+        std::vector<voronoi::GMLSSurfaceGradientWeight> gradientWeights;
+        if (threadValueWeights.size() == 1) {
+            // A single thread already appended in vertex order
+            valueWeights = std::move(threadValueWeights[0]);
+            gradientWeights = std::move(threadGradientWeights[0]);
+            domain.modelRuntime->stageGMLSSurfaceData(stencils, valueWeights, gradientWeights);
+            continue;
+        }
+
+        valueWeights.resize(valueWeightTotal);
+        gradientWeights.resize(gradientWeightTotal);
+
+        #pragma omp parallel for schedule(static)
+        for (int vertexIndex = 0; vertexIndex < pointCount; ++vertexIndex) {
+            const voronoi::GMLSSurfaceStencil& stencil = stencils[vertexIndex];
+            const uint32_t threadId = pointThreads[vertexIndex];
+            std::copy_n(
+                threadValueWeights[threadId].begin() + localValueOffsets[vertexIndex],
+                stencil.valueWeightCount,
+                valueWeights.begin() + stencil.valueWeightOffset);
+            std::copy_n(
+                threadGradientWeights[threadId].begin() + localGradientOffsets[vertexIndex],
+                stencil.gradientWeightCount,
+                gradientWeights.begin() + stencil.gradientWeightOffset);
+        }
+
         domain.modelRuntime->stageGMLSSurfaceData(stencils, valueWeights, gradientWeights);
     }
 
@@ -4,6 +4,7 @@
 #include <memory>
 #include <vector>
 
+#include "voronoi/VoronoiCellClipper.hpp"
 #include "voronoi/VoronoiDomain.hpp"
 #include "voronoi/VoronoiGpuStructs.hpp"
 #include "voronoi/VoronoiResources.hpp"
@@ -53,6 +54,10 @@ private:
         const std::vector<uint32_t>& neighborIndices,
         bool debugEnable,
         uint32_t maxNeighbors);
+    bool compareWithCpuClipper(
+        const VoronoiDomain& domain,
+        const VoronoiCellClipper::Inputs& clipperInputs,
+        uint32_t maxNeighbors) const;
     bool buildGMLSInterfaceBuffer(uint32_t maxNeighbors);
     bool rebuildOccupancyPointBuffer(const std::vector<VoronoiDomain>& domains) const;
 
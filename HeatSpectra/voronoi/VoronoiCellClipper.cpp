@@ -0,0 +1,811 @@
+#include "VoronoiCellClipper.hpp"
+
+#include "spatial/VoxelGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <utility>
+
+namespace {
+
+constexpr uint32_t K_MAX_NEIGHBORS = 50;
+constexpr uint32_t P_MAX = 50;
+constexpr uint32_t V_MAX = 50;
+constexpr uint32_t END_OF_LIST = 255;
+constexpr int MAX_TRI = 128;
+
+constexpr float CANONICAL_DOMAIN_SIZE = 1000.0f;
+constexpr float VOLUME_EPSILON2 = 1e-30f;
+
+// Vertices are plane triplets. Their homogeneous coordinates are cached when the
+// vertex is created, so a half-space test is a 4-wide dot product instead of the
+// shader's 4x4 determinant (the two are equal by cofactor expansion).
+struct ConvexCell {
+    glm::uvec3 vertices[V_MAX];
+    glm::dvec4 homogeneous[V_MAX];
+    glm::vec4 planes[P_MAX];
+    uint32_t boundaryNext[P_MAX];
+    uint32_t vertexCount = 0;
+    uint32_t planeCount = 0;
+};
+
+struct ConvexCellBackup {
+    glm::uvec3 vertices[V_MAX];
+    glm::dvec4 homogeneous[V_MAX];
+    uint32_t vertexCount = 0;
+    uint32_t planeCount = 0;
+};
+
+void backupCell(ConvexCellBackup& backup, const ConvexCell& cell) {
+    backup.vertexCount = cell.vertexCount;
+    backup.planeCount = cell.planeCount;
+    std::copy(cell.vertices, cell.vertices + cell.vertexCount, backup.vertices);
+    std::copy(cell.homogeneous, cell.homogeneous + cell.vertexCount, backup.homogeneous);
+}
+
+void restoreCell(const ConvexCellBackup& backup, ConvexCell& cell) {
+    cell.vertexCount = backup.vertexCount;
+    cell.planeCount = backup.planeCount;
+    std::copy(backup.vertices, backup.vertices + backup.vertexCount, cell.vertices);
+    std::copy(backup.homogeneous, backup.homogeneous + backup.vertexCount, cell.homogeneous);
+}
+
+glm::dvec4 intersectPlanes(const ConvexCell& cell, const glm::uvec3& planeTriplet) {
+    const glm::dvec4 pi1(cell.planes[planeTriplet.x]);
+    const glm::dvec4 pi2(cell.planes[planeTriplet.y]);
+    const glm::dvec4 pi3(cell.planes[planeTriplet.z]);
+
+    const double m12 = pi2.x * pi3.y - pi2.y * pi3.x;
+    const double m13 = pi2.x * pi3.z - pi2.z * pi3.x;
+    const double m14 = pi2.x * pi3.w - pi2.w * pi3.x;
+    const double m23 = pi2.y * pi3.z - pi2.z * pi3.y;
+    const double m24 = pi2.y * pi3.w - pi2.w * pi3.y;
+    const double m34 = pi2.z * pi3.w - pi2.w * pi3.z;
+
+    glm::dvec4 r;
+    r.x = -pi1.w * m23 - pi1.y * m34 + pi1.z * m24;
+    r.y =  pi1.x * m34 + pi1.w * m13 - pi1.z * m14;
+    r.z = -pi1.x * m24 + pi1.y * m14 - pi1.w * m12;
+    r.w =  pi1.x * m23 - pi1.y * m13 + pi1.z * m12;
+    return r;
+}
+
+glm::vec3 vertexPosition(const glm::dvec4& r) {
+    if (std::abs(r.w) < 1e-20) {
+        return glm::vec3(0.0f);
+    }
+    return glm::vec3(static_cast<float>(r.x / r.w), static_cast<float>(r.y / r.w), static_cast<float>(r.z / r.w));
+}
+
+void setVertex(ConvexCell& cell, uint32_t slot, const glm::uvec3& planeTriplet) {
+    cell.vertices[slot] = planeTriplet;
+    cell.homogeneous[slot] = intersectPlanes(cell, planeTriplet);
+}
+
+void swapVertices(ConvexCell& cell, uint32_t a, uint32_t b) {
+    std::swap(cell.vertices[a], cell.vertices[b]);
+    std::swap(cell.homogeneous[a], cell.homogeneous[b]);
+}
+
+void newVertex(ConvexCell& cell, uint32_t i, uint32_t j, uint32_t k) {
+    if (cell.vertexCount >= V_MAX) {
+        return;
+    }
+    setVertex(cell, cell.vertexCount++, glm::uvec3(i, j, k));
+}
+
+uint32_t computeBoundary(ConvexCell& cell, uint32_t nbRemoved) {
+    std::fill(cell.boundaryNext, cell.boundaryNext + P_MAX, END_OF_LIST);
+    uint32_t firstBoundary = END_OF_LIST;
+
+    uint32_t nbIter = 0;
+    uint32_t t = cell.vertexCount;
+
+    while (nbRemoved > 0) {
+        if (nbIter++ > 1000) {
+            return firstBoundary;
+        }
+
+        const glm::uvec3 triplet = cell.vertices[t];
+        bool isInBorder[3];
+        bool nextIsOpp[3];
+
+        for (int e = 0; e < 3; e++) {
+            isInBorder[e] = (cell.boundaryNext[triplet[e]] != END_OF_LIST);
+        }
+        for (int e = 0; e < 3; e++) {
+            nextIsOpp[e] = (cell.boundaryNext[triplet[(e + 1) % 3]] == triplet[e]);
+        }
+
+        bool newBorderIsSimple = true;
+        for (int e = 0; e < 3; e++) {
+            if (!nextIsOpp[e] && !nextIsOpp[(e + 1) % 3] && isInBorder[(e + 1) % 3]) {
+                newBorderIsSimple = false;
+            }
+        }
+
+        if (!nextIsOpp[0] && !nextIsOpp[1] && !nextIsOpp[2]) {
+            if (firstBoundary == END_OF_LIST) {
+                for (int e = 0; e < 3; e++) {
+                    cell.boundaryNext[triplet[e]] = triplet[(e + 1) % 3];
+                }
+                firstBoundary = triplet.x;
+            } else {
+                newBorderIsSimple = false;
+            }
+        }
+
+        if (!newBorderIsSimple) {
+            t++;
+            if (t == cell.vertexCount + nbRemoved) {
+                t = cell.vertexCount;
+            }
+            continue;
+        }
+
+        for (int e = 0; e < 3; e++) {
+            if (!nextIsOpp[e]) {
+                cell.boundaryNext[triplet[e]] = triplet[(e + 1) % 3];
+            }
+        }
+
+        for (int e = 0; e < 3; e++) {
+            if (nextIsOpp[e] && nextIsOpp[(e + 1) % 3]) {
+                const uint32_t p = triplet[(e + 1) % 3];
+                if (firstBoundary == p) {
+                    firstBoundary = cell.boundaryNext[p];
+                }
+                cell.boundaryNext[p] = END_OF_LIST;
+            }
+        }
+
+        swapVertices(cell, t, cell.vertexCount + nbRemoved - 1);
+
+        t = cell.vertexCount;
+        nbRemoved--;
+    }
+
+    return firstBoundary;
+}
+
+void clipByPlane(ConvexCell& cell, uint32_t newPlaneIdx) {
+    const glm::dvec4 eqn(cell.planes[newPlaneIdx]);
+
+    // Test every vertex up front so the loop has no dependencies, then partition
+    bool outside[V_MAX];
+    for (uint32_t i = 0; i < cell.vertexCount; i++) {
+        outside[i] = glm::dot(eqn, cell.homogeneous[i]) > 0.0;
+    }
+
+    uint32_t nbRemoved = 0;
+    uint32_t i = 0;
+    while (i < cell.vertexCount) {
+        if (outside[i]) {
+            cell.vertexCount--;
+            swapVertices(cell, i, cell.vertexCount);
+            std::swap(outside[i], outside[cell.vertexCount]);
+            nbRemoved++;
+        } else {
+            i++;
+        }
+    }
+
+    if (cell.vertexCount < 1) {
+        return;
+    }
+
+    if (nbRemoved == 0) {
+        cell.planeCount--;
+        return;
+    }
+
+    const uint32_t firstBoundary = computeBoundary(cell, nbRemoved);
+    if (firstBoundary == END_OF_LIST) {
+        return;
+    }
+
+    uint32_t cir = firstBoundary;
+    uint32_t safety = 0;
+    do {
+        if (safety++ > P_MAX) {
+            break;
+        }
+        const uint32_t newCir = cell.boundaryNext[cir];
+        newVertex(cell, newPlaneIdx, cir, newCir);
+        cir = newCir;
+    } while (cir != firstBoundary);
+}
+
+bool isSecurityRadiusReached(const ConvexCell& cell, const glm::vec4& lastNeighbor, const glm::vec3& seed) {
+    float vDist = 0.0f;
+    for (uint32_t i = 0; i < cell.vertexCount; i++) {
+        const glm::vec3 diff = vertexPosition(cell.homogeneous[i]) - seed;
+        vDist = std::max(vDist, glm::dot(diff, diff));
+    }
+
+    const glm::vec3 dn = glm::vec3(lastNeighbor) - seed;
+    return glm::dot(dn, dn) > 4.0f * vDist;
+}
+
+float det2x2(float a11, float a12, float a21, float a22) {
+    return a11 * a22 - a12 * a21;
+}
+
+float det3x3(
+    float a11, float a12, float a13,
+    float a21, float a22, float a23,
+    float a31, float a32, float a33) {
+    return a11 * det2x2(a22, a23, a32, a33)
+         - a21 * det2x2(a12, a13, a32, a33)
+         + a31 * det2x2(a12, a13, a22, a23);
+}
+
+double det3x3D(
+    double a11, double a12, double a13,
+    double a21, double a22, double a23,
+    double a31, double a32, double a33) {
+    return a11 * (a22 * a33 - a23 * a32)
+         + a12 * (a23 * a31 - a21 * a33)
+         + a13 * (a21 * a32 - a22 * a31);
+}
+
+glm::vec4 getPlaneFromPoints(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c) {
+    glm::vec3 n = glm::cross(b - a, c - a);
+    const float lenN = glm::length(n);
+    if (lenN > 1e-20f) {
+        n /= lenN;
+    }
+    return glm::vec4(n, -glm::dot(n, a));
+}
+
+// Per-vertex decomposition shared by the volume and area exports
+struct VertexFrame {
+    glm::vec4 a;
+    glm::vec4 ac;
+    glm::vec4 planes[3];
+    glm::vec4 aPlane[3];
+    glm::vec4 aLine[3];
+};
+
+void computeVertexFrame(const ConvexCell& cell, uint32_t ve, const glm::vec3& seed, VertexFrame& frame) {
+    frame.a = glm::vec4(vertexPosition(cell.homogeneous[ve]), 1.0f);
+    frame.ac = glm::vec4(seed, 1.0f) - frame.a;
+
+    const glm::uvec3 planesId = cell.vertices[ve];
+    for (int i = 0; i < 3; i++) {
+        frame.planes[i] = cell.planes[planesId[i]];
+    }
+
+    for (int i = 0; i < 3; i++) {
+        const glm::vec3 ni(frame.planes[i]);
+        const float dotACni = glm::dot(glm::vec3(frame.ac), ni);
+        const float dotnini = glm::dot(ni, ni);
+        if (dotnini < 1e-30f) {
+            frame.aPlane[i] = glm::vec4(0.0f);
+        } else {
+            frame.aPlane[i] = frame.ac - glm::vec4((dotACni / dotnini) * ni, 0.0f);
+        }
+    }
+
+    for (int i = 0; i < 3; i++) {
+        const glm::vec3 pi(frame.planes[i]);
+        const glm::vec3 pj(frame.planes[(i + 1) % 3]);
+        const glm::vec3 ninj = glm::cross(pi, pj);
+        const float ninj2 = glm::dot(ninj, ninj);
+        const float lhs = VOLUME_EPSILON2 * glm::dot(pi, pi) * glm::dot(pj, pj);
+        if (ninj2 < lhs) {
+            frame.aLine[i] = glm::vec4(0.0f);
+        } else {
+            frame.aLine[i] = (glm::dot(glm::vec3(frame.ac), ninj) / ninj2) * glm::vec4(ninj, 0.0f);
+        }
+    }
+}
+
+glm::vec4 exportBaryVolume(const ConvexCell& cell, const glm::vec3& seed) {
+    glm::vec4 bary(0.0f);
+    VertexFrame frame;
+
+    for (uint32_t ve = 0; ve < cell.vertexCount; ve++) {
+        computeVertexFrame(cell, ve, seed, frame);
+
+        for (int i = 0; i < 3; i++) {
+            for (int st = 0; st < 2; st++) {
+                const int j = (i + 3 - st) % 3;
+                const float w = static_cast<float>(2 * st - 1) * det3x3(
+                    frame.ac.x, frame.ac.y, frame.ac.z,
+                    frame.aPlane[i].x, frame.aPlane[i].y, frame.aPlane[i].z,
+                    frame.aLine[j].x, frame.aLine[j].y, frame.aLine[j].z);
+
+                bary.w += w;
+                const glm::vec4 sum = frame.ac + frame.aPlane[i] + frame.aLine[j];
+                bary.x += w * (frame.a.x + 0.25f * sum.x);
+                bary.y += w * (frame.a.y + 0.25f * sum.y);
+                bary.z += w * (frame.a.z + 0.25f * sum.z);
+            }
+        }
+    }
+
+    return bary;
+}
+
+void exportArea(const ConvexCell& cell, const glm::vec3& seed, uint32_t staticPlaneCount, float* surfIntr, float factor) {
+    VertexFrame frame;
+
+    for (uint32_t ve = 0; ve < cell.vertexCount; ve++) {
+        computeVertexFrame(cell, ve, seed, frame);
+        const glm::uvec3 planesId = cell.vertices[ve];
+
+        for (int i = 0; i < 3; i++) {
+            const uint32_t planeId = planesId[i];
+            if (planeId < 6 || planeId >= staticPlaneCount || planeId >= P_MAX) {
+                continue;
+            }
+
+            for (int st = 0; st < 2; st++) {
+                const int j = (i + 3 - st) % 3;
+                const double triAreaDet = det3x3D(
+                    frame.aPlane[i].x, frame.aLine[j].x, frame.planes[i].x,
+                    frame.aPlane[i].y, frame.aLine[j].y, frame.planes[i].y,
+                    frame.aPlane[i].z, frame.aLine[j].z, frame.planes[i].z);
+
+                // Signed interface area contribution in world units
+                surfIntr[planeId] += static_cast<float>((2.0 * st - 1.0) * triAreaDet / 2.0) * factor;
+            }
+        }
+    }
+}
+
+bool intersectSegmentTriangle(
+    const glm::vec3& p0,
+    const glm::vec3& p1,
+    const glm::vec3& v0,
+    const glm::vec3& v1,
+    const glm::vec3& v2) {
+    const float eps = 1e-6f;
+
+    const glm::vec3 dir = p1 - p0;
+    const glm::vec3 e1 = v1 - v0;
+    const glm::vec3 e2 = v2 - v0;
+
+    const glm::vec3 pvec = glm::cross(dir, e2);
+    const float det = glm::dot(e1, pvec);
+    if (std::abs(det) < eps) {
+        return false;
+    }
+
+    const float invDet = 1.0f / det;
+    const glm::vec3 tvec = p0 - v0;
+    const float u = glm::dot(tvec, pvec) * invDet;
+    if (u < -eps || u > 1.0f + eps) {
+        return false;
+    }
+
+    const glm::vec3 qvec = glm::cross(tvec, e1);
+    const float v = glm::dot(dir, qvec) * invDet;
+    if (v < -eps || u + v > 1.0f + eps) {
+        return false;
+    }
+
+    const float t = glm::dot(e2, qvec) * invDet;
+    return t > eps && t < 1.0f - eps;
+}
+
+}
+
+VoronoiCellClipper::VoronoiCellClipper(const Inputs& inputs)
+    : inputs(inputs),
+      gridMin(0.0f),
+      gridScale(1.0f),
+      gridDim(1) {
+    if (inputs.voxelGrid && inputs.voxelGrid->getGridSize() > 0) {
+        const VoxelGrid::VoxelGridParams& params = inputs.voxelGrid->getParams();
+        gridMin = params.gridMin;
+        gridScale = params.cellSize;
+        gridDim = params.gridDim;
+    }
+}
+
+bool VoronoiCellClipper::clipCells(voronoi::Node* nodes, float* interfaceAreas, uint32_t* interfaceNeighborIds) const {
+    if (!nodes || !interfaceAreas || !interfaceNeighborIds ||
+        !inputs.seedPositions || !inputs.seedFlags || !inputs.neighborIndices || !inputs.meshTriangles ||
+        inputs.maxNeighbors == 0) {
+        std::cerr << "[VoronoiCellClipper] Missing input or output buffers" << std::endl;
+        return false;
+    }
+
+    const int nodeCount = static_cast<int>(inputs.nodeCount);
+
+    #pragma omp parallel for schedule(dynamic, 16)
+    for (int localNodeID = 0; localNodeID < nodeCount; ++localNodeID) {
+        const uint32_t nodeID = inputs.nodeOffset + static_cast<uint32_t>(localNodeID);
+        const glm::vec3 seed(inputs.seedPositions[nodeID]);
+        voronoi::Node& node = nodes[nodeID];
+
+        const float volume = computeRestrictedVolume(nodeID, seed, node, interfaceAreas, interfaceNeighborIds);
+        const bool isGhost = (inputs.seedFlags[nodeID] & 1u) != 0u;
+        node.volume = isGhost ? 0.0f : volume;
+    }
+
+    return true;
+}
+
+bool VoronoiCellClipper::clipCells(HostCells& cells) const {
+    const size_t nodeCount = static_cast<size_t>(inputs.nodeOffset) + static_cast<size_t>(inputs.nodeCount);
+    const size_t slotCount = nodeCount * static_cast<size_t>(inputs.maxNeighbors);
+    if (cells.nodes.size() < nodeCount) {
+        cells.nodes.resize(nodeCount, voronoi::Node{ 0.0f, 0u, 0u, 0u });
+    }
+    if (cells.interfaceAreas.size() < slotCount) {
+        cells.interfaceAreas.resize(slotCount, 0.0f);
+    }
+    if (cells.interfaceNeighborIds.size() < slotCount) {
+        cells.interfaceNeighborIds.resize(slotCount, UINT32_MAX);
+    }
+    return clipCells(cells.nodes.data(), cells.interfaceAreas.data(), cells.interfaceNeighborIds.data());
+}
+
+uint8_t VoronoiCellClipper::cornerOccupancy(int x, int y, int z) const {
+    if (!inputs.voxelGrid) {
+        return 0;
+    }
+    const uint8_t occ = inputs.voxelGrid->getOccupancy(x, y, z);
+    return occ > 2 ? 0 : occ;
+}
+
+glm::vec3 VoronoiCellClipper::canonicalFromWorld(const glm::vec3& p) const {
+    return (p - gridMin) * gridScale;
+}
+
+glm::vec3 VoronoiCellClipper::worldFromCanonical(const glm::vec3& p) const {
+    return p / gridScale + gridMin;
+}
+
+bool VoronoiCellClipper::isPointInsideMeshFallback(const glm::vec3& queryPoint, const glm::vec3& bboxMinW, const glm::vec3& bboxMaxW) const {
+    const glm::vec3 bboxSize = bboxMaxW - bboxMinW;
+    const float expand = std::max(glm::length(bboxSize) * 2.0f, 1.0f);
+
+    const glm::vec3 outsidePoints[3] = {
+        bboxMaxW + expand * glm::vec3(1.0f, 1.0f, 1.0f),
+        bboxMaxW + expand * glm::vec3(1.731f, 0.941f, 1.217f),
+        bboxMinW - expand * glm::vec3(1.113f, 1.357f, 0.927f)
+    };
+
+    uint32_t insideVotes = 0;
+    for (const glm::vec3& outsidePoint : outsidePoints) {
+        uint32_t hitCount = 0;
+        for (const MeshTriangleGPU& tri : *inputs.meshTriangles) {
+            if (intersectSegmentTriangle(outsidePoint, queryPoint, glm::vec3(tri.v0), glm::vec3(tri.v1), glm::vec3(tri.v2))) {
+                hitCount++;
+            }
+        }
+        insideVotes += (hitCount & 1u);
+    }
+    return insideVotes >= 2u;
+}
+
+float VoronoiCellClipper::computeRestrictedVolume(
+    uint32_t cellID,
+    const glm::vec3& seed,
+    voronoi::Node& node,
+    float* interfaceAreas,
+    uint32_t* interfaceNeighborIds) const {
+    // Init convex cell as the canonical domain box, then work in world space
+    const float canonicalVox = CANONICAL_DOMAIN_SIZE / static_cast<float>(gridDim.x);
+
+    const glm::vec3 bboxMinW = worldFromCanonical(glm::vec3(-0.01f));
+    const glm::vec3 bboxMaxW = worldFromCanonical(glm::vec3(CANONICAL_DOMAIN_SIZE + 0.01f));
+
+    ConvexCell cell;
+
+    cell.planes[0] = glm::vec4( 1.0f,  0.0f,  0.0f, -bboxMinW.x);
+    cell.planes[1] = glm::vec4(-1.0f,  0.0f,  0.0f,  bboxMaxW.x);
+    cell.planes[2] = glm::vec4( 0.0f,  1.0f,  0.0f, -bboxMinW.y);
+    cell.planes[3] = glm::vec4( 0.0f, -1.0f,  0.0f,  bboxMaxW.y);
+    cell.planes[4] = glm::vec4( 0.0f,  0.0f,  1.0f, -bboxMinW.z);
+    cell.planes[5] = glm::vec4( 0.0f,  0.0f, -1.0f,  bboxMaxW.z);
+    cell.planeCount = 6;
+
+    // 8 bbox vertices as plane triplets
+    const glm::uvec3 boxVertices[8] = {
+        {2, 5, 0}, {5, 3, 0}, {1, 5, 2}, {5, 1, 3},
+        {4, 2, 0}, {4, 0, 3}, {2, 4, 1}, {4, 3, 1}
+    };
+    cell.vertexCount = 8;
+    for (uint32_t i = 0; i < 8; i++) {
+        setVertex(cell, i, boxVertices[i]);
+    }
+
+    int planeNeighborIDs[P_MAX];
+    std::fill(planeNeighborIDs, planeNeighborIDs + P_MAX, -1);
+
+    const uint32_t neighborLimit = std::min(inputs.maxNeighbors, K_MAX_NEIGHBORS);
+    const uint32_t* cellNeighbors = inputs.neighborIndices + static_cast<size_t>(cellID) * inputs.maxNeighbors;
+
+    for (uint32_t i = 0; i < neighborLimit; i++) {
+        const uint32_t neigh = cellNeighbors[i];
+        if (neigh == UINT32_MAX) {
+            break;
+        }
+
+        const glm::vec4 b = inputs.seedPositions[neigh];
+        const glm::vec3 dir = seed - glm::vec3(b);
+        const float dirNorm = glm::length(dir);
+        if (dirNorm < 1e-10f) {
+            continue;
+        }
+
+        const glm::vec3 ave2 = seed + glm::vec3(b);
+        const float dotProduct = glm::dot(ave2, dir) - (b.w - 1.0f);
+        const float w = -dotProduct / (2.0f * dirNorm);
+        const glm::vec3 normal = dir / dirNorm;
+
+        if (cell.planeCount >= P_MAX) {
+            break;
+        }
+
+        const uint32_t planeIdx = cell.planeCount;
+        cell.planes[planeIdx] = glm::vec4(normal, w);
+        planeNeighborIDs[planeIdx] = static_cast<int>(neigh);
+        cell.planeCount++;
+
+        clipByPlane(cell, planeIdx);
+        if (cell.vertexCount < 1) {
+            break;
+        }
+
+        // Seeds come sorted by distance, so none further out can cut the cell
+        if (isSecurityRadiusReached(cell, b, seed)) {
+            break;
+        }
+    }
+
+    if (cell.planeCount >= P_MAX) {
+        return 0.0f;
+    }
+    const uint32_t staticPlaneCount = cell.planeCount;
+
+    glm::vec3 bbMin(1e10f);
+    glm::vec3 bbMax(-1e10f);
+    for (uint32_t ve = 0; ve < cell.vertexCount; ve++) {
+        const glm::vec3 p = vertexPosition(cell.homogeneous[ve]);
+        bbMin = glm::min(bbMin, p);
+        bbMax = glm::max(bbMax, p);
+    }
+
+    const glm::vec3 bbMinC = canonicalFromWorld(bbMin);
+    const glm::vec3 bbMaxC = canonicalFromWorld(bbMax);
+
+    glm::ivec3 voxelMin = glm::ivec3(glm::floor(bbMinC / canonicalVox));
+    glm::ivec3 voxelMax = glm::ivec3(glm::floor(bbMaxC / canonicalVox));
+
+    voxelMin = glm::max(voxelMin, glm::ivec3(0));
+    voxelMax = glm::min(voxelMax, gridDim - glm::ivec3(1));
+
+    bool foundInside = false;
+    bool foundOutside = false;
+    glm::vec3 ptInside(0.0f);
+    glm::vec3 ptOutside(0.0f);
+
+    const glm::ivec3 cornerMin = voxelMin;
+    const glm::ivec3 cornerMax = glm::min(voxelMax + glm::ivec3(1), gridDim);
+
+    for (int z = cornerMin.z; z <= cornerMax.z; z++) {
+        for (int y = cornerMin.y; y <= cornerMax.y; y++) {
+            for (int x = cornerMin.x; x <= cornerMax.x; x++) {
+                const uint8_t occ = cornerOccupancy(x, y, z);
+                if (occ == 2u && !foundInside) {
+                    ptInside = worldFromCanonical(glm::vec3(x, y, z) * canonicalVox);
+                    foundInside = true;
+                } else if (occ == 0u && !foundOutside) {
+                    ptOutside = worldFromCanonical(glm::vec3(x, y, z) * canonicalVox);
+                    foundOutside = true;
+                }
+            }
+        }
+    }
+
+    bool foundNonBorder = foundInside || foundOutside;
+    uint32_t inDomain = foundInside ? 2u : (foundOutside ? 0u : 1u);
+    glm::vec3 origin = foundInside ? ptInside : ptOutside;
+
+    // Every corner is on the border; look one layer past the cell's voxels along +z, +y, +x
+    if (inDomain == 1u) {
+        const int xMax = std::min(voxelMax.x + 1, gridDim.x);
+        const int yMax = std::min(voxelMax.y + 1, gridDim.y);
+        const int zMax = std::min(voxelMax.z + 1, gridDim.z);
+
+        const int z = voxelMax.z + 1;
+        if (z <= gridDim.z) {
+            for (int y = voxelMin.y; y <= yMax && inDomain == 1u; y++) {
+                for (int x = voxelMin.x; x <= xMax; x++) {
+                    const uint8_t occ = cornerOccupancy(x, y, z);
+                    if (occ != 1u) {
+                        inDomain = occ;
+                        origin = worldFromCanonical(glm::vec3(x, y, z) * canonicalVox);
+                        foundNonBorder = true;
+                        break;
+                    }
+                }
+            }
+        } else {
+            inDomain = 0u;
+            origin = worldFromCanonical(glm::vec3(voxelMin.x, voxelMin.y, gridDim.z) * canonicalVox);
+            foundNonBorder = true;
+        }
+
+        if (inDomain == 1u) {
+            const int y = voxelMax.y + 1;
+            if (y <= gridDim.y) {
+                for (int z2 = voxelMin.z; z2 <= zMax && inDomain == 1u; z2++) {
+                    for (int x = voxelMin.x; x <= xMax; x++) {
+                        const uint8_t occ = cornerOccupancy(x, y, z2);
+                        if (occ != 1u) {
+                            inDomain = occ;
+                            origin = worldFromCanonical(glm::vec3(x, y, z2) * canonicalVox);
+                            foundNonBorder = true;
+                            break;
+                        }
+                    }
+                }
+            } else {
+                inDomain = 0u;
+                origin = worldFromCanonical(glm::vec3(voxelMin.x, gridDim.y, voxelMin.z) * canonicalVox);
+                foundNonBorder = true;
+            }
+        }
+
+        if (inDomain == 1u) {
+            const int x = voxelMax.x + 1;
+            if (x <= gridDim.x) {
+                for (int z2 = voxelMin.z; z2 <= zMax && inDomain == 1u; z2++) {
+                    for (int y2 = voxelMin.y; y2 <= yMax; y2++) {
+                        const uint8_t occ = cornerOccupancy(x, y2, z2);
+                        if (occ != 1u) {
+                            inDomain = occ;
+                            origin = worldFromCanonical(glm::vec3(x, y2, z2) * canonicalVox);
+                            foundNonBorder = true;
+                            break;
+                        }
+                    }
+                }
+            } else {
+                inDomain = 0u;
+                origin = worldFromCanonical(glm::vec3(gridDim.x, voxelMin.y, voxelMin.z) * canonicalVox);
+                foundNonBorder = true;
+            }
+        }
+    }
+
+    const bool addVolume = (inDomain == 2u);
+    const bool isGhost = (inputs.seedFlags[cellID] & 1u) != 0u;
+
+    glm::vec4 volBary(0.0f);
+    glm::vec3 unrestrictedCentroid = seed;
+    bool hasUnrestrictedCentroid = false;
+
+    float planeAreas[P_MAX];
+    std::fill(planeAreas, planeAreas + P_MAX, 0.0f);
+
+    if (!isGhost) {
+        const glm::vec4 un = exportBaryVolume(cell, seed);
+        if (std::abs(un.w) > 1e-20f) {
+            unrestrictedCentroid = glm::vec3(un) / un.w;
+            hasUnrestrictedCentroid = true;
+        }
+        if (addVolume) {
+            volBary = un / 6.0f;
+        }
+
+        exportArea(cell, seed, staticPlaneCount, planeAreas, 1.0f);
+    }
+
+    int uniqueTri[MAX_TRI];
+    int uniqueCount = 0;
+    if (inputs.voxelGrid) {
+        for (int z = voxelMin.z; z <= voxelMax.z && uniqueCount < MAX_TRI; z++) {
+            for (int y = voxelMin.y; y <= voxelMax.y && uniqueCount < MAX_TRI; y++) {
+                for (int x = voxelMin.x; x <= voxelMax.x && uniqueCount < MAX_TRI; x++) {
+                    const int32_t* voxelBegin = nullptr;
+                    const int32_t* voxelEnd = nullptr;
+                    inputs.voxelGrid->getVoxelTriangles(x, y, z, voxelBegin, voxelEnd);
+                    for (const int32_t* it = voxelBegin; it != voxelEnd && uniqueCount < MAX_TRI; ++it) {
+                        const int triId = *it;
+                        if (std::find(uniqueTri, uniqueTri + uniqueCount, triId) == uniqueTri + uniqueCount) {
+                            uniqueTri[uniqueCount++] = triId;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    node.interfaceNeighborCount = 0;
+
+    if (!foundNonBorder && uniqueCount > 0) {
+        const glm::vec3 bboxSize = bboxMaxW - bboxMinW;
+        const float expand = std::max(glm::length(bboxSize) * 2.0f, 1.0f);
+        const glm::vec3 fallbackOrigin = bboxMaxW + expand * glm::vec3(1.0f);
+
+        const bool seedInside = isPointInsideMeshFallback(seed, bboxMinW, bboxMaxW);
+        const bool centroidInside = hasUnrestrictedCentroid &&
+            isPointInsideMeshFallback(unrestrictedCentroid, bboxMinW, bboxMaxW);
+
+        if (!seedInside && !centroidInside) {
+            return 0.0f;
+        }
+        origin = fallbackOrigin;
+        inDomain = 0u;
+    }
+
+    ConvexCellBackup backup;
+    backupCell(backup, cell);
+
+    const std::vector<MeshTriangleGPU>& meshTriangles = *inputs.meshTriangles;
+    for (int i = 0; i < uniqueCount; i++) {
+        if (uniqueTri[i] < 0 || static_cast<size_t>(uniqueTri[i]) >= meshTriangles.size()) {
+            continue;
+        }
+        const MeshTriangleGPU& tri = meshTriangles[uniqueTri[i]];
+
+        const glm::vec3 v0(tri.v0);
+        glm::vec3 v1(tri.v1);
+        glm::vec3 v2(tri.v2);
+
+        const float triDet = det3x3(
+            v0.x - origin.x, v0.y - origin.y, v0.z - origin.z,
+            v1.x - origin.x, v1.y - origin.y, v1.z - origin.z,
+            v2.x - origin.x, v2.y - origin.y, v2.z - origin.z);
+
+        const bool goOut = triDet > 0.0f;
+        if (!goOut) {
+            std::swap(v1, v2);
+        }
+
+        // Clip to the tetrahedron spanned by the origin and the triangle
+        const glm::vec4 tetPlanes[4] = {
+            getPlaneFromPoints(origin, v0, v1),
+            getPlaneFromPoints(origin, v2, v0),
+            getPlaneFromPoints(origin, v1, v2),
+            getPlaneFromPoints(v1, v2, v0)
+        };
+
+        bool clippedAway = (cell.planeCount + 4 >= P_MAX);
+        for (int p = 0; p < 4 && !clippedAway; p++) {
+            cell.planes[cell.planeCount++] = tetPlanes[p];
+            clipByPlane(cell, cell.planeCount - 1);
+            clippedAway = (cell.vertexCount < 1);
+        }
+
+        if (!clippedAway) {
+            const float factor = (inDomain == 2u) ? (goOut ? -1.0f : 1.0f) : (goOut ? 1.0f : -1.0f);
+            volBary += exportBaryVolume(cell, seed) * (factor / 6.0f);
+            exportArea(cell, seed, staticPlaneCount, planeAreas, factor);
+        }
+
+        restoreCell(backup, cell);
+        cell.planeCount = staticPlaneCount;
+    }
+
+    const size_t interfaceBase = static_cast<size_t>(cellID) * inputs.maxNeighbors;
+    for (uint32_t p = 6; p < staticPlaneCount && p < P_MAX; p++) {
+        const int globalNeigh = planeNeighborIDs[p];
+        if (globalNeigh < 0) {
+            continue;
+        }
+
+        const float area = planeAreas[p];
+        if (std::abs(area) < 1e-16f) {
+            continue;
+        }
+
+        const uint32_t writeIdx = node.interfaceNeighborCount;
+        if (writeIdx < neighborLimit) {
+            interfaceAreas[interfaceBase + writeIdx] = area;
+            interfaceNeighborIds[interfaceBase + writeIdx] = static_cast<uint32_t>(globalNeigh);
+            node.interfaceNeighborCount++;
+        }
+    }
+
+    return volBary.w;
+}
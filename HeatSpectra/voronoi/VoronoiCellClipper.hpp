@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "voronoi/VoronoiGpuStructs.hpp"
+#include "voronoi/VoronoiIntegrator.hpp"
+
+class VoxelGrid;
+
+// CPU port of the restricted Voronoi cell clipping in shaders/heat_geometry.slang.
+// Each cell is clipped against its nearest seeds until the security radius is
+// reached, then restricted to the mesh by clipping against the triangles of the
+// voxels it overlaps. Fills the same node volumes and interface area/neighbor
+// slots as VoronoiGeoCompute, without the debug cell and dump outputs.
+class VoronoiCellClipper {
+public:
+    struct Inputs {
+        const glm::vec4* seedPositions = nullptr;      // Global seed array
+        const uint32_t* seedFlags = nullptr;           // Global seed flags
+        const uint32_t* neighborIndices = nullptr;     // maxNeighbors global ids per node
+        uint32_t maxNeighbors = 0;
+        const std::vector<MeshTriangleGPU>* meshTriangles = nullptr;
+        const VoxelGrid* voxelGrid = nullptr;          // Null when the domain has no voxel grid
+        uint32_t nodeOffset = 0;
+        uint32_t nodeCount = 0;
+    };
+
+    // Host-side outputs, indexed by global node id like the GPU buffers
+    struct HostCells {
+        std::vector<voronoi::Node> nodes;
+        std::vector<float> interfaceAreas;
+        std::vector<uint32_t> interfaceNeighborIds;
+    };
+
+    explicit VoronoiCellClipper(const Inputs& inputs);
+
+    // Writes nodes, interface areas and interface neighbor ids for the domain's nodes.
+    // Interface slots are indexed by global node id with maxNeighbors slots per node.
+    bool clipCells(voronoi::Node* nodes, float* interfaceAreas, uint32_t* interfaceNeighborIds) const;
+    // Headless entry point: grows the host vectors to cover this domain, then clips into them.
+    bool clipCells(HostCells& cells) const;
+
+private:
+    float computeRestrictedVolume(
+        uint32_t cellID,
+        const glm::vec3& seed,
+        voronoi::Node& node,
+        float* interfaceAreas,
+        uint32_t* interfaceNeighborIds) const;
+
+    uint8_t cornerOccupancy(int x, int y, int z) const;
+    glm::vec3 canonicalFromWorld(const glm::vec3& p) const;
+    glm::vec3 worldFromCanonical(const glm::vec3& p) const;
+    bool isPointInsideMeshFallback(const glm::vec3& queryPoint, const glm::vec3& bboxMinW, const glm::vec3& bboxMaxW) const;
+
+    Inputs inputs;
+    glm::vec3 gridMin;
+    float gridScale;
+    glm::ivec3 gridDim;
+};
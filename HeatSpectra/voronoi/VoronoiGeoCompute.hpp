@@ -66,6 +66,7 @@ public:
     void initialize(uint32_t nodeCount);
     void updateDescriptors(const Bindings& bindings);
     void dispatch(const PushConstants& pushConstants);
+    bool isInitialized() const { return initialized; }
 
     void cleanupResources();
     void cleanup();
@@ -1,4 +1,7 @@
 #include "VoronoiIntegrator.hpp"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
 #include <iostream>
 #include <libs/nanoflann/include/nanoflann.hpp>
 
@@ -11,66 +14,107 @@ struct PointCloudAdapter {
     template <class BBOX> bool kdtree_get_bbox(BBOX&) const { return false; }
 };
 
-void VoronoiIntegrator::extractNeighborIndices(const std::vector<std::vector<uint32_t>>& inputNeighborIndices,
-    const std::vector<glm::dvec3>& inputSeedPositions,int K) {
-    neighborIndices.clear();
-    seedPositions.clear();
-        
-    // Flatten 2D neighbor array to 1D GPU buffer
-    neighborIndices.reserve(inputNeighborIndices.size() * K);
-    for (const auto& cellNeighbors : inputNeighborIndices) {
-        neighborIndices.insert(neighborIndices.end(), 
-                               cellNeighbors.begin(), cellNeighbors.end());
+namespace {
+
+uint32_t spreadMortonBits(uint32_t v) {
+    v &= 0x3FFu;
+    v = (v | (v << 16)) & 0x030000FFu;
+    v = (v | (v << 8)) & 0x0300F00Fu;
+    v = (v | (v << 4)) & 0x030C30C3u;
+    v = (v | (v << 2)) & 0x09249249u;
+    return v;
+}
+
+// Seed indices sorted along a 30-bit Morton curve, so consecutive queries visit
+// the same KD-tree leaves
+std::vector<uint32_t> mortonQueryOrder(const std::vector<glm::dvec3>& points) {
+    glm::dvec3 minBounds(DBL_MAX);
+    glm::dvec3 maxBounds(-DBL_MAX);
+    for (const glm::dvec3& point : points) {
+        minBounds = glm::min(minBounds, point);
+        maxBounds = glm::max(maxBounds, point);
+    }
+    const glm::dvec3 extent = glm::max(maxBounds - minBounds, glm::dvec3(1e-12));
+    const glm::dvec3 scale = 1023.0 / extent;
+
+    const int pointCount = static_cast<int>(points.size());
+    std::vector<uint64_t> keys(points.size());
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < pointCount; ++i) {
+        const glm::uvec3 q = glm::uvec3((points[i] - minBounds) * scale);
+        const uint64_t code = spreadMortonBits(q.x) | (spreadMortonBits(q.y) << 1) | (spreadMortonBits(q.z) << 2);
+        keys[i] = (code << 32) | static_cast<uint32_t>(i);
     }
-    
-    // Store seed positions for GPU
-    for (const auto& seed : inputSeedPositions) {
-        seedPositions.push_back(glm::vec4(seed, 1.0f));  // w=1.0 for regular cells
+    std::sort(keys.begin(), keys.end());
+
+    std::vector<uint32_t> order(points.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        order[i] = static_cast<uint32_t>(keys[i]);
     }
+    return order;
+}
+
 }
 
-void VoronoiIntegrator::computeNeighbors(const std::vector<glm::dvec3>& seedPositions, int K) {
-    PointCloudAdapter cloud{seedPositions};
-    
-    // Build KDtree
+void VoronoiIntegrator::computeNeighbors(const std::vector<glm::dvec3>& inputSeedPositions, int K) {
+    PointCloudAdapter cloud{inputSeedPositions};
+
     using KDTree = nanoflann::KDTreeSingleIndexAdaptor<
         nanoflann::L2_Simple_Adaptor<double, PointCloudAdapter>,
-        PointCloudAdapter, 3>;
-    
+        PointCloudAdapter, 3, uint32_t>;
+
     KDTree index(3, cloud, nanoflann::KDTreeSingleIndexAdaptorParams(10));
     index.buildIndex();
 
-    std::vector<std::vector<uint32_t>> neighborIndices;
-    neighborIndices.reserve(seedPositions.size());
-    
-    // For each seed, find K+1 nearest using KDtree
-    for (size_t i = 0; i < seedPositions.size(); i++) {
-        const double query_pt[3] = {seedPositions[i].x, seedPositions[i].y, seedPositions[i].z};
-        
-        // Query K+1 neighbors 
-        std::vector<size_t> ret_indices(K + 1);
-        std::vector<double> out_dists_sqr(K + 1);
-        
-        nanoflann::KNNResultSet<double> resultSet(K + 1);
-        resultSet.init(ret_indices.data(), out_dists_sqr.data());
-        index.findNeighbors(resultSet, query_pt);
-        
-        // Filter out self and take first K neighbors
-        std::vector<uint32_t> kNeighbors;
-        for (size_t j = 0; j < ret_indices.size() && kNeighbors.size() < K; j++) {
-            if (ret_indices[j] != i) {  // Skip self
-                kNeighbors.push_back(static_cast<uint32_t>(ret_indices[j]));
+    const size_t seedCount = inputSeedPositions.size();
+    const size_t rowSize = static_cast<size_t>(std::max(K, 0));
+    neighborOffsets.resize(seedCount + 1);
+    for (size_t i = 0; i <= seedCount; ++i) {
+        neighborOffsets[i] = static_cast<uint32_t>(i * rowSize);
+    }
+    neighborIndices.assign(seedCount * rowSize, UINT32_MAX);
+    neighborDistances.assign(seedCount * rowSize, FLT_MAX);
+
+    const std::vector<uint32_t> queryOrder = mortonQueryOrder(inputSeedPositions);
+    const int queryCount = static_cast<int>(seedCount);
+
+#pragma omp parallel
+    {
+        std::vector<uint32_t> resultIndices(rowSize + 1);
+        std::vector<double> resultDistancesSq(rowSize + 1);
+
+#pragma omp for schedule(dynamic, 256)
+        for (int q = 0; q < queryCount; ++q) {
+            const uint32_t seedIndex = queryOrder[q];
+            const double queryPoint[3] = {
+                inputSeedPositions[seedIndex].x,
+                inputSeedPositions[seedIndex].y,
+                inputSeedPositions[seedIndex].z };
+
+            // K+1 so the seed itself can be dropped
+            nanoflann::KNNResultSet<double, uint32_t> resultSet(rowSize + 1);
+            resultSet.init(resultIndices.data(), resultDistancesSq.data());
+            index.findNeighbors(resultSet, queryPoint);
+
+            uint32_t* rowIndices = neighborIndices.data() + neighborOffsets[seedIndex];
+            float* rowDistances = neighborDistances.data() + neighborOffsets[seedIndex];
+            size_t written = 0;
+            const size_t found = resultSet.size();
+            for (size_t j = 0; j < found && written < rowSize; ++j) {
+                if (resultIndices[j] == seedIndex) {
+                    continue;
+                }
+                rowIndices[written] = resultIndices[j];
+                rowDistances[written] = static_cast<float>(std::sqrt(resultDistancesSq[j]));
+                ++written;
             }
         }
-        
-        while (kNeighbors.size() < K) {
-            kNeighbors.push_back(UINT32_MAX);
-        }
-        
-        neighborIndices.push_back(kNeighbors);
     }
-    
-    extractNeighborIndices(neighborIndices, seedPositions, K);
+
+    seedPositions.resize(seedCount);
+    for (size_t i = 0; i < seedCount; ++i) {
+        seedPositions[i] = glm::vec4(inputSeedPositions[i], 1.0f);  // w=1.0 for regular cells
+    }
 }
 
 void VoronoiIntegrator::extractMeshTriangles(
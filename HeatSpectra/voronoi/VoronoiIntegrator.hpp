@@ -13,17 +13,25 @@ class VoronoiIntegrator {
 public:
     VoronoiIntegrator() = default;
 
-    void extractNeighborIndices(const std::vector<std::vector<uint32_t>>& neighborIndices, const std::vector<glm::dvec3>& seedPositions, int K);
     void extractMeshTriangles(const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& indices);
-    void computeNeighbors(const std::vector<glm::dvec3>& seedPositions,int K);
+
+    // K nearest neighbors of every seed, excluding itself, as CSR rows of K entries.
+    // Rows with fewer than K neighbors are padded with UINT32_MAX, so the indices
+    // can be uploaded as the fixed-stride buffer the Voronoi shaders read. Distances
+    // are Euclidean, FLT_MAX in padded slots.
+    void computeNeighbors(const std::vector<glm::dvec3>& seedPositions, int K);
 
     // Getters
+    const std::vector<uint32_t>& getNeighborOffsets() const { return neighborOffsets; }
     const std::vector<uint32_t>& getNeighborIndices() const { return neighborIndices; }
+    const std::vector<float>& getNeighborDistances() const { return neighborDistances; }
     const std::vector<MeshTriangleGPU>& getMeshTriangles() const { return meshTriangles; }
     const std::vector<glm::vec4>& getSeedPositions() const { return seedPositions; }
 
 private:
+    std::vector<uint32_t> neighborOffsets;
     std::vector<uint32_t> neighborIndices;
+    std::vector<float> neighborDistances;
     std::vector<MeshTriangleGPU> meshTriangles;
 
     std::vector<glm::vec4> seedPositions;
@@ -1,13 +1,30 @@
 ﻿#include "VoronoiSeeder.hpp"
+#include "spatial/SDFGridBuilder.hpp"
 #include <iostream>
 #include <algorithm>
-#include <random>
 #include <fstream>
 #include <omp.h>
 #include <unordered_set>
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/norm.hpp>
 
+namespace {
+
+constexpr uint64_t BLUE_NOISE_SEED = 42;
+
+uint64_t splitMix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+float nextUnitFloat(uint64_t& state) {
+    return static_cast<float>(splitMix64(state) >> 40) * (1.0f / 16777216.0f);
+}
+
+}
+
 VoronoiSeeder::VoronoiSeeder() {
 }
 
@@ -57,7 +74,7 @@ void VoronoiSeeder::generateSeeds(
 
     buildSDFGrid(positions, indices, sharedTriGrid);
 
-    voxelGrid.build(positions, indices, sharedTriGrid, voxelResolution);
+    voxelGrid.build(positions, indices, voxelResolution);
 
     generateBlueNoiseSeeds();
 }
@@ -87,45 +104,6 @@ void VoronoiSeeder::exportSeedsToOBJ(const std::string& filename) const {
     file.close();
 }
 
-float VoronoiSeeder::computePointToMeshDistance(
-    const glm::vec3& point,
-    const std::vector<glm::vec3>& positions,
-    const std::vector<uint32_t>& indices) const {
-    float minDistSq = FLT_MAX;
-
-    // Get nearby triangles from spatial hash
-    std::vector<size_t> nearbyTriangles;
-    triHashGrid.getNearbyTriangles(point, nearbyTriangles);
-    if (nearbyTriangles.empty()) {
-        const int fallbackRadius = 4;
-        triHashGrid.getNearbyTriangles(point, fallbackRadius, nearbyTriangles);
-    }
-
-    // Check only nearby triangles
-    for (size_t triIdx : nearbyTriangles) {
-        const size_t indexBase = triIdx * 3;
-        if (indexBase + 2 >= indices.size()) {
-            continue;
-        }
-        if (indices[indexBase] >= positions.size() ||
-            indices[indexBase + 1] >= positions.size() ||
-            indices[indexBase + 2] >= positions.size()) {
-            continue;
-        }
-
-        const glm::vec3& v0 = positions[indices[indexBase]];
-        const glm::vec3& v1 = positions[indices[indexBase + 1]];
-        const glm::vec3& v2 = positions[indices[indexBase + 2]];
-
-        glm::vec3 closestPoint = closestPointOnTriangle(point, v0, v1, v2);
-        float distSq = glm::distance2(point, closestPoint);
-
-        minDistSq = std::min(minDistSq, distSq);
-    }
-
-    return std::sqrt(minDistSq);
-}
-
 void VoronoiSeeder::buildSDFGrid(
     const std::vector<glm::vec3>& positions,
     const std::vector<uint32_t>& indices,
@@ -133,26 +111,13 @@ void VoronoiSeeder::buildSDFGrid(
     sdfGridDim = gridDim;
     sdfCellSize = cellSize;
 
-    size_t totalCells = static_cast<size_t>(sdfGridDim.x) * sdfGridDim.y * sdfGridDim.z;
-    sdfGrid.resize(totalCells);
-
-    triHashGrid = triangleGrid;
+    SDFGridBuilder::GridSpec spec{};
+    spec.gridMin = gridMin;
+    spec.gridDim = sdfGridDim;
+    spec.cellSize = sdfCellSize;
 
-    // Calculate SDF value at each grid vertex
-    #pragma omp parallel for
-    for (int z = 0; z < sdfGridDim.z; z++) {
-        for (int y = 0; y < sdfGridDim.y; y++) {
-            for (int x = 0; x < sdfGridDim.x; x++) {
-                glm::vec3 gridPoint = gridMin + glm::vec3(x, y, z) * sdfCellSize;  
-                
-                float unsignedDist = computePointToMeshDistance(gridPoint, positions, indices);
-
-                // Use sdfGridDim for indexing
-                size_t idx = z * sdfGridDim.y * sdfGridDim.x + y * sdfGridDim.x + x;
-                sdfGrid[idx] = unsignedDist;
-            }
-        }
-    }
+    SDFGridBuilder builder;
+    builder.build(positions, indices, triangleGrid, spec, sdfGrid);
 }
 
 float VoronoiSeeder::sampleSDFGrid(const glm::vec3& pos) const {
@@ -202,83 +167,96 @@ void VoronoiSeeder::generateSurfaceSeeds(const SupportingHalfedge::IntrinsicMesh
     }
 }
 
-size_t VoronoiSeeder::computeSpatialHash(const glm::vec3& pos, float hashCellSize) const {
-    int hx = static_cast<int>(std::floor((pos.x - gridMin.x) / hashCellSize));
-    int hy = static_cast<int>(std::floor((pos.y - gridMin.y) / hashCellSize));
-    int hz = static_cast<int>(std::floor((pos.z - gridMin.z) / hashCellSize));
-    return (size_t(hx) * 73856093) ^ (size_t(hy) * 19349663) ^ (size_t(hz) * 83492791);
+int VoronoiSeeder::seedCellIndex(const glm::vec3& pos) const {
+    glm::ivec3 cell = glm::ivec3(glm::floor((pos - gridMin) / cellSize));
+    cell = glm::clamp(cell, glm::ivec3(0), gridDim - 1);
+    return (cell.z * gridDim.y + cell.y) * gridDim.x + cell.x;
 }
 
-bool VoronoiSeeder::isTooCloseToExisting(const glm::vec3& candidatePos, float poissonRadius, float hashCellSize,
-                                          const std::unordered_map<size_t, std::vector<glm::vec3>>& spatialHash) const {
-    float poissonRadiusSq = poissonRadius * poissonRadius;
-    
-    int hx = static_cast<int>(std::floor((candidatePos.x - gridMin.x) / hashCellSize));
-    int hy = static_cast<int>(std::floor((candidatePos.y - gridMin.y) / hashCellSize));
-    int hz = static_cast<int>(std::floor((candidatePos.z - gridMin.z) / hashCellSize));
-    
-    for (int dz = -1; dz <= 1; dz++) {
-        for (int dy = -1; dy <= 1; dy++) {
-            for (int dx = -1; dx <= 1; dx++) {
-                size_t neighborHash = (size_t(hx + dx) * 73856093) ^ (size_t(hy + dy) * 19349663) ^ (size_t(hz + dz) * 83492791);
-                auto it = spatialHash.find(neighborHash);
-                if (it != spatialHash.end()) {
-                    for (const auto& existingPos : it->second) {
-                        float distSq = glm::distance2(candidatePos, existingPos);
-                        if (distSq < poissonRadiusSq) {
+// Cells are sampled in 8 phases by coordinate parity. The Poisson radius is below
+// the cell size, so a candidate can only conflict with seeds in the 26 adjacent
+// cells, and no two cells of one phase are adjacent. Each cell draws from its own
+// random stream, so the result does not depend on the thread count.
+void VoronoiSeeder::generateBlueNoiseSeeds() {
+    const float poissonRadiusSq = (cellSize * 0.8f) * (cellSize * 0.8f);
+    const int maxAttempts = 30;
+    const int cellCount = gridDim.x * gridDim.y * gridDim.z;
+
+    // Surface seeds bucketed by cell with a counting sort
+    std::vector<uint32_t> surfaceCellStart(cellCount + 1, 0);
+    std::vector<glm::vec3> surfacePositions;
+    for (const Seed& seed : seeds) {
+        if (seed.isSurface) {
+            ++surfaceCellStart[seedCellIndex(seed.pos) + 1];
+        }
+    }
+    for (int cell = 0; cell < cellCount; ++cell) {
+        surfaceCellStart[cell + 1] += surfaceCellStart[cell];
+    }
+    surfacePositions.resize(surfaceCellStart[cellCount]);
+    {
+        std::vector<uint32_t> cursor(surfaceCellStart.begin(), surfaceCellStart.end() - 1);
+        for (const Seed& seed : seeds) {
+            if (seed.isSurface) {
+                surfacePositions[cursor[seedCellIndex(seed.pos)]++] = seed.pos;
+            }
+        }
+    }
+
+    std::vector<glm::vec3> cellSeeds(cellCount);
+    std::vector<uint8_t> cellHasSeed(cellCount, 0);
+
+    auto isTooClose = [&](const glm::vec3& candidatePos, int x, int y, int z) {
+        for (int nz = std::max(z - 1, 0); nz <= std::min(z + 1, gridDim.z - 1); ++nz) {
+            for (int ny = std::max(y - 1, 0); ny <= std::min(y + 1, gridDim.y - 1); ++ny) {
+                for (int nx = std::max(x - 1, 0); nx <= std::min(x + 1, gridDim.x - 1); ++nx) {
+                    const int neighborCell = (nz * gridDim.y + ny) * gridDim.x + nx;
+                    if (cellHasSeed[neighborCell] && glm::distance2(candidatePos, cellSeeds[neighborCell]) < poissonRadiusSq) {
+                        return true;
+                    }
+                    for (uint32_t i = surfaceCellStart[neighborCell]; i < surfaceCellStart[neighborCell + 1]; ++i) {
+                        if (glm::distance2(candidatePos, surfacePositions[i]) < poissonRadiusSq) {
                             return true;
                         }
                     }
                 }
             }
         }
-    }
-    return false;
-}
-
-void VoronoiSeeder::generateBlueNoiseSeeds() {
-    std::default_random_engine generator(42);
-    std::uniform_real_distribution<float> uniform01(0.0f, 1.0f);
-    
-    float basePoissonRadius = cellSize * 0.8f;
-    int maxAttempts = 30;
-    
-    float hashCellSize = basePoissonRadius;
-    std::unordered_map<size_t, std::vector<glm::vec3>> spatialHash;
-    spatialHash.reserve(seeds.size() * 2);
-    
-    for (const auto& seed : seeds) {
-        if (seed.isSurface) {
-            size_t hash = computeSpatialHash(seed.pos, hashCellSize);
-            spatialHash[hash].push_back(seed.pos);
-        }
-    }
-    
-    for (int z = 0; z < gridDim.z; z++) {
-        for (int y = 0; y < gridDim.y; y++) {
-            for (int x = 0; x < gridDim.x; x++) {
-                glm::vec3 cellCenter = gridMin + glm::vec3(x + 0.5f, y + 0.5f, z + 0.5f) * cellSize;
-                
-                bool seedPlaced = false;
-                for (int attempt = 0; attempt < maxAttempts && !seedPlaced; attempt++) {
-                    glm::vec3 candidatePos = cellCenter + glm::vec3(
-                        (uniform01(generator) - 0.5f) * cellSize,
-                        (uniform01(generator) - 0.5f) * cellSize,
-                        (uniform01(generator) - 0.5f) * cellSize
-                    );
-                    
-                    if (!isTooCloseToExisting(candidatePos, basePoissonRadius, hashCellSize, spatialHash)) {
-                        seeds.push_back(Seed(candidatePos, false));
-                        
-                        size_t hash = computeSpatialHash(candidatePos, hashCellSize);
-                        spatialHash[hash].push_back(candidatePos);
-                        
-                        seedPlaced = true;
-                    }
+        return false;
+    };
+
+    for (int phase = 0; phase < 8; ++phase) {
+        const glm::ivec3 parity(phase & 1, (phase >> 1) & 1, (phase >> 2) & 1);
+        const glm::ivec3 phaseDim = (gridDim - parity + 1) / 2;
+        const int phaseCellCount = phaseDim.x * phaseDim.y * phaseDim.z;
+
+#pragma omp parallel for schedule(static)
+        for (int i = 0; i < phaseCellCount; ++i) {
+            const int x = parity.x + 2 * (i % phaseDim.x);
+            const int y = parity.y + 2 * ((i / phaseDim.x) % phaseDim.y);
+            const int z = parity.z + 2 * (i / (phaseDim.x * phaseDim.y));
+            const int cell = (z * gridDim.y + y) * gridDim.x + x;
+            const glm::vec3 cellCenter = gridMin + glm::vec3(x + 0.5f, y + 0.5f, z + 0.5f) * cellSize;
+
+            uint64_t rngState = BLUE_NOISE_SEED ^ (static_cast<uint64_t>(cell) * 0x9E3779B97F4A7C15ull);
+            for (int attempt = 0; attempt < maxAttempts; ++attempt) {
+                const float rx = nextUnitFloat(rngState);
+                const float ry = nextUnitFloat(rngState);
+                const float rz = nextUnitFloat(rngState);
+                const glm::vec3 candidatePos = cellCenter + (glm::vec3(rx, ry, rz) - 0.5f) * cellSize;
+
+                if (!isTooClose(candidatePos, x, y, z)) {
+                    cellSeeds[cell] = candidatePos;
+                    cellHasSeed[cell] = 1;
+                    break;
                 }
-                
             }
         }
     }
-    
+
+    for (int cell = 0; cell < cellCount; ++cell) {
+        if (cellHasSeed[cell]) {
+            seeds.push_back(Seed(cellSeeds[cell], false));
+        }
+    }
 }
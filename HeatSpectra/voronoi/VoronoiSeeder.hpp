@@ -2,7 +2,6 @@
 
 #include <vector>
 #include <string>
-#include <unordered_map>
 #include <glm/glm.hpp>
 #include "mesh/remesher/SupportingHalfedge.hpp"
 #include "spatial/TriangleHashGrid.hpp"
@@ -48,7 +47,6 @@ public:
     float sampleSDFGrid(const glm::vec3& pos) const;
 
 private:
-    TriangleHashGrid triHashGrid;
     std::vector<Seed> seeds;
     std::vector<float> sdfGrid;  
     glm::ivec3 sdfGridDim;   
@@ -61,11 +59,7 @@ private:
 
     void generateSurfaceSeeds(const SupportingHalfedge::IntrinsicMesh& intrinsicMesh);
     void generateBlueNoiseSeeds();
-    
-    size_t computeSpatialHash(const glm::vec3& pos, float hashCellSize) const;
-    bool isTooCloseToExisting(const glm::vec3& candidatePos, float poissonRadius, float hashCellSize, 
-                               const std::unordered_map<size_t, std::vector<glm::vec3>>& spatialHash) const; 
+    int seedCellIndex(const glm::vec3& pos) const;
 
     void buildSDFGrid(const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& indices, const TriangleHashGrid& triangleGrid);
-    float computePointToMeshDistance(const glm::vec3& point, const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& indices) const;
 };
@@ -5,7 +5,7 @@
 std::mutex CommandPool::queueSubmitMutex;
 
 CommandPool::CommandPool(VulkanDevice& device, const char* name) 
-    : vulkanDevice(device), debugName(name) {
+    : vulkanDevice(device), debugName(name), uploadQueue(std::make_unique<UploadQueue>(device)) {
     
     VkCommandPoolCreateInfo poolInfo{};
     poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
@@ -21,6 +21,10 @@ CommandPool::CommandPool(VulkanDevice& device, const char* name)
 }
 
 CommandPool::~CommandPool() {
+    uploadQueue.reset();
+    for (VkFence fence : freeFences) {
+        vkDestroyFence(vulkanDevice.getDevice(), fence, nullptr);
+    }
     if (pool != VK_NULL_HANDLE) {
         vkDestroyCommandPool(vulkanDevice.getDevice(), pool, nullptr);
     }
@@ -58,17 +62,61 @@ void CommandPool::endCommands(VkCommandBuffer commandBuffer) {
     submitInfo.commandBufferCount = 1;
     submitInfo.pCommandBuffers = &commandBuffer;
     
-    // Protect queue submission with global mutex
-    {
-        std::lock_guard<std::mutex> queueLock(queueSubmitMutex);
-        vkQueueSubmit(vulkanDevice.getGraphicsQueue(), 1, &submitInfo, VK_NULL_HANDLE);
-        vkQueueWaitIdle(vulkanDevice.getGraphicsQueue());
+    // Uploads recorded before these commands must reach the queue first
+    uploadQueue->flush();
+
+    // Wait for this submission alone rather than idling the whole queue
+    VkFence fence = acquireFence();
+    if (submit(vulkanDevice, submitInfo, fence) == VK_SUCCESS) {
+        if (fence != VK_NULL_HANDLE) {
+            vkWaitForFences(vulkanDevice.getDevice(), 1, &fence, VK_TRUE, UINT64_MAX);
+        } else {
+            std::lock_guard<std::mutex> queueLock(queueSubmitMutex);
+            vkQueueWaitIdle(vulkanDevice.getGraphicsQueue());
+        }
+    } else {
+        std::cerr << "[CommandPool] Failed to submit command buffer from: " << debugName << std::endl;
     }
+    releaseFence(fence);
     
     std::lock_guard<std::mutex> poolLock(poolMutex);
     vkFreeCommandBuffers(vulkanDevice.getDevice(), pool, 1, &commandBuffer);
 }
 
+VkResult CommandPool::submit(VulkanDevice& device, const VkSubmitInfo& submitInfo, VkFence fence) {
+    std::lock_guard<std::mutex> queueLock(queueSubmitMutex);
+    return vkQueueSubmit(device.getGraphicsQueue(), 1, &submitInfo, fence);
+}
+
+VkFence CommandPool::acquireFence() {
+    {
+        std::lock_guard<std::mutex> poolLock(poolMutex);
+        if (!freeFences.empty()) {
+            VkFence fence = freeFences.back();
+            freeFences.pop_back();
+            return fence;
+        }
+    }
+
+    VkFenceCreateInfo fenceInfo{};
+    fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    VkFence fence = VK_NULL_HANDLE;
+    if (vkCreateFence(vulkanDevice.getDevice(), &fenceInfo, nullptr, &fence) != VK_SUCCESS) {
+        return VK_NULL_HANDLE;
+    }
+    return fence;
+}
+
+void CommandPool::releaseFence(VkFence fence) {
+    if (fence == VK_NULL_HANDLE) {
+        return;
+    }
+
+    vkResetFences(vulkanDevice.getDevice(), 1, &fence);
+    std::lock_guard<std::mutex> poolLock(poolMutex);
+    freeFences.push_back(fence);
+}
+
 void CommandPool::copyBuffer(VkBuffer srcBuffer, VkDeviceSize srcOffset, 
                               VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size) {
     VkCommandBuffer cmdBuffer = beginCommands();
@@ -1,7 +1,10 @@
 ﻿#pragma once
 
 #include "VulkanDevice.hpp" 
+#include "UploadQueue.hpp"
+#include <memory>
 #include <mutex>
+#include <vector>
 
 class CommandPool {
 public:
@@ -10,7 +13,13 @@ public:
     
     VkCommandBuffer beginCommands();
     
+    // Submits and waits on this submission's fence only; pending uploads are flushed first
     void endCommands(VkCommandBuffer commandBuffer);
+
+    UploadQueue& uploads() { return *uploadQueue; }
+
+    // Queue submission serialized against every other submitter of the graphics queue
+    static VkResult submit(VulkanDevice& device, const VkSubmitInfo& submitInfo, VkFence fence);
     
     VkCommandPool getHandle() const { return pool; }
     
@@ -23,10 +32,15 @@ public:
                                VkImageLayout oldLayout, VkImageLayout newLayout);
     
 private:
+    VkFence acquireFence();
+    void releaseFence(VkFence fence);
+
     VulkanDevice& vulkanDevice;
     VkCommandPool pool;
     std::mutex poolMutex;  
     const char* debugName;
+    std::unique_ptr<UploadQueue> uploadQueue;
+    std::vector<VkFence> freeFences;
     
     static std::mutex queueSubmitMutex;
 };
@@ -1,6 +1,7 @@
 ﻿#include <vulkan/vulkan.h>
 
 #include <algorithm>
+#include <cassert>
 #include <cstddef>
 #include <iostream>
 #include <limits>
@@ -8,11 +9,15 @@
 #include "MemoryAllocator.hpp"
 
 namespace {
-VkDeviceSize alignUp(VkDeviceSize value, VkDeviceSize alignment) {
-    if (alignment <= 1) {
-        return value;
-    }
-    return ((value + alignment - 1) / alignment) * alignment;
+// validate() walks every block of the pool, so running it after each operation makes
+// allocation O(blocks). Define HEATSPECTRA_VALIDATE_TLSF to turn it on while chasing
+// allocator bugs; --bench-tlsf validates a random trace without it.
+inline void validatePool(const TLSFAllocator& allocator) {
+#ifdef HEATSPECTRA_VALIDATE_TLSF
+    assert(allocator.validate());
+#else
+    (void)allocator;
+#endif
 }
 
 VkDeviceSize deriveRequiredAlignment(
@@ -78,7 +83,7 @@ MemoryPool::MemoryPool(VulkanDevice& vulkanDevice, VkDeviceSize poolSize, VkBuff
         vkMapMemory(vulkanDevice.getDevice(), memory, 0, poolSize, 0, &mappedPtr);
     }
 
-    blocks.push_back({ 0, poolSize, true });
+    allocator.reset(poolSize);
 }
 
 MemoryPool::~MemoryPool() {
@@ -103,6 +108,7 @@ MemoryAllocator::~MemoryAllocator() {
     }
     imageMemories.clear();
 
+    bufferPools.clear();
     for (auto& pair : pools) {
         pair.second.clear();
     }
@@ -110,86 +116,55 @@ MemoryAllocator::~MemoryAllocator() {
 }
 
 std::pair<VkBuffer, VkDeviceSize> MemoryAllocator::allocate(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags memProps, VkDeviceSize alignment) {
-    std::lock_guard<std::mutex> lock(allocationMutex);
-
     const VkDeviceSize requiredAlignment = deriveRequiredAlignment(vulkanDevice, usage, alignment);
 
     auto key = std::make_pair(usage, memProps);
 
-    while (true) {
-        auto& poolVector = pools[key];
+    // Pools are only destroyed with the allocator, so the pointers stay valid after unlocking
+    std::vector<MemoryPool*> candidates;
+    {
+        std::lock_guard<std::mutex> lock(allocationMutex);
+        for (auto& poolPtr : pools[key]) {
+            candidates.push_back(poolPtr.get());
+        }
+    }
 
-        // Best fit allocation: find smallest block that fits
-        for (auto& poolPtr : poolVector) {
-            MemoryPool& pool = *poolPtr;
+    for (MemoryPool* pool : candidates) {
+        std::lock_guard<std::mutex> poolLock(pool->mutex);
+        const uint64_t offset = pool->allocator.allocate(size, requiredAlignment);
+        validatePool(pool->allocator);
+        if (offset != TLSFAllocator::INVALID_OFFSET) {
+            return { pool->buffer, offset };
+        }
+    }
 
-            VkDeviceSize minRemainingBytes = std::numeric_limits<VkDeviceSize>::max();
-            size_t bestIndex = std::numeric_limits<size_t>::max();
-            VkDeviceSize bestAlignedOffset = 0;
-
-            for (size_t index = 0; index < pool.blocks.size(); ++index) {
-                const Suballocation& block = pool.blocks[index];
-                if (!block.isFree) {
-                    continue;
-                }
-
-                const VkDeviceSize alignedOffset = alignUp(block.offset, requiredAlignment);
-                const VkDeviceSize prefixPadding = alignedOffset - block.offset;
-                if (prefixPadding > block.size || size > (block.size - prefixPadding)) {
-                    continue;
-                }
-
-                const VkDeviceSize consumed = prefixPadding + size;
-                const VkDeviceSize remainingBytes = block.size - consumed;
-                if (remainingBytes < minRemainingBytes) {
-                    minRemainingBytes = remainingBytes;
-                    bestIndex = index;
-                    bestAlignedOffset = alignedOffset;
-                }
-            }
-
-            if (bestIndex != std::numeric_limits<size_t>::max()) {
-                const Suballocation freeBlock = pool.blocks[bestIndex];
-                const VkDeviceSize blockEnd = freeBlock.offset + freeBlock.size;
-                const VkDeviceSize allocatedOffset = bestAlignedOffset;
-                const VkDeviceSize allocatedEnd = allocatedOffset + size;
-
-                std::vector<Suballocation> replacement;
-                replacement.reserve(3);
-
-                if (allocatedOffset > freeBlock.offset) {
-                    replacement.push_back({
-                        freeBlock.offset,
-                        allocatedOffset - freeBlock.offset,
-                        true
-                    });
-                }
-
-                replacement.push_back({
-                    allocatedOffset,
-                    size,
-                    false
-                });
-
-                if (allocatedEnd < blockEnd) {
-                    replacement.push_back({
-                        allocatedEnd,
-                        blockEnd - allocatedEnd,
-                        true
-                    });
-                }
-
-                pool.blocks.erase(pool.blocks.begin() + static_cast<std::ptrdiff_t>(bestIndex));
-                pool.blocks.insert(
-                    pool.blocks.begin() + static_cast<std::ptrdiff_t>(bestIndex),
-                    replacement.begin(),
-                    replacement.end());
-
-                return { pool.buffer, allocatedOffset };
-            }
+    std::lock_guard<std::mutex> lock(allocationMutex);
+
+    // Another thread may have added a pool while this one was searching
+    auto& poolVector = pools[key];
+    for (size_t index = candidates.size(); index < poolVector.size(); ++index) {
+        MemoryPool& pool = *poolVector[index];
+        std::lock_guard<std::mutex> poolLock(pool.mutex);
+        const uint64_t offset = pool.allocator.allocate(size, requiredAlignment);
+        validatePool(pool.allocator);
+        if (offset != TLSFAllocator::INVALID_OFFSET) {
+            return { pool.buffer, offset };
         }
-        createNewPool(size, usage, memProps);
     }
+
+    MemoryPool* pool = createNewPool(size, usage, memProps);
+    if (!pool) {
+        return { VK_NULL_HANDLE, 0 };
+    }
+
+    std::lock_guard<std::mutex> poolLock(pool->mutex);
+    const uint64_t offset = pool->allocator.allocate(size, requiredAlignment);
+    validatePool(pool->allocator);
+    if (offset == TLSFAllocator::INVALID_OFFSET) {
+        std::cerr << "[MemoryAllocator] Failed to suballocate " << size << " bytes from a new pool" << std::endl;
+        return { VK_NULL_HANDLE, 0 };
+    }
+    return { pool->buffer, offset };
 }
 
 VkDeviceMemory MemoryAllocator::allocateImageMemory(VkImage image, VkMemoryPropertyFlags memProps) {
@@ -226,86 +201,66 @@ VkDeviceMemory MemoryAllocator::allocateImageMemory(VkImage image, VkMemoryPrope
     return memory;
 }
 
-MemoryPool& MemoryAllocator::createNewPool(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags memProps) {
+MemoryPool* MemoryAllocator::createNewPool(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags memProps) {
     auto key = std::make_pair(usage, memProps);
     VkDeviceSize poolSize = std::max(DEFAULT_POOL_SIZE, size);
-    pools[key].push_back(std::make_unique<MemoryPool>(vulkanDevice, poolSize, usage, memProps));
-    return *pools[key].back();
+    auto pool = std::make_unique<MemoryPool>(vulkanDevice, poolSize, usage, memProps);
+    if (pool->buffer == VK_NULL_HANDLE || pool->memory == VK_NULL_HANDLE) {
+        return nullptr;
+    }
+
+    MemoryPool* poolPtr = pool.get();
+    bufferPools[poolPtr->buffer] = poolPtr;
+    pools[key].push_back(std::move(pool));
+    return poolPtr;
 }
 
 void MemoryAllocator::defragment() {
-    for (auto& pair : pools) {
-        auto& poolVector = pair.second;
-        for (auto& poolPtr : poolVector) {
-            MemoryPool& pool = *poolPtr;
-            std::sort(pool.blocks.begin(), pool.blocks.end(), [](const Suballocation& a, const Suballocation& b) {
-                return a.offset < b.offset;
-                });
-            mergeFreeBlocks(pool);
-        }
-    }
+    // Free blocks are coalesced with their neighbours as they are released
 }
 
 AllocatorStats MemoryAllocator::getStats() {
+    std::lock_guard<std::mutex> lock(allocationMutex);
+
     AllocatorStats stats = {};
     for (auto& pair : pools) {
         auto& poolVector = pair.second;
         for (auto& poolPtr : poolVector) {
             MemoryPool& pool = *poolPtr;
-            VkDeviceSize poolSize = 0;
-            for (const auto& block : pool.blocks) {
-                poolSize += block.size;
-            }
-            stats.totalAllocated += poolSize;
-            for (const auto& block : pool.blocks) {
-                if (!block.isFree) {
-                    stats.usedBytes += block.size;
-                    stats.allocationCount++;
-                }
-            }
+            std::lock_guard<std::mutex> poolLock(pool.mutex);
+            const TLSFAllocator::Stats poolStats = pool.allocator.getStats();
+            stats.totalAllocated += poolStats.capacity;
+            stats.usedBytes += poolStats.usedBytes;
+            stats.allocationCount += poolStats.allocationCount;
         }
     }
     return stats;
 }
 
 void* MemoryAllocator::getMappedPointer(VkBuffer buffer, VkDeviceSize offset) {
-    // Iterate over each pool group
-    for (auto& poolPair : pools) {
-        // Iterate over each pool in the vector
-        for (auto& poolPtr : poolPair.second) {
-            MemoryPool& pool = *poolPtr;
-            if (pool.buffer == buffer) {
-                if (pool.mappedPtr) {
-                    return static_cast<char*>(pool.mappedPtr) + offset;
-                }
-                else {
-                    return nullptr;
-                }
-            }
-        }
+    std::lock_guard<std::mutex> lock(allocationMutex);
+
+    const auto it = bufferPools.find(buffer);
+    if (it == bufferPools.end() || !it->second->mappedPtr) {
+        return nullptr;
     }
-    return nullptr; 
+    return static_cast<char*>(it->second->mappedPtr) + offset;
 }
 
 void MemoryAllocator::free(VkBuffer buffer, VkDeviceSize offset) {
-    std::lock_guard<std::mutex> lock(allocationMutex); 
-
-    // Find the pool containing this buffer
-    for (auto& pair : pools) {
-        auto& poolVector = pair.second;
-        for (auto& poolPtr : poolVector) {
-            MemoryPool& pool = *poolPtr;
-            if (pool.buffer == buffer) {
-                for (auto& block : pool.blocks) {
-                    if (block.offset == offset && !block.isFree) {
-                        block.isFree = true;
-                        mergeFreeBlocks(pool);
-                        return;
-                    }
-                }
-            }
+    MemoryPool* pool = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(allocationMutex);
+        const auto it = bufferPools.find(buffer);
+        if (it == bufferPools.end()) {
+            return;
         }
+        pool = it->second;
     }
+
+    std::lock_guard<std::mutex> poolLock(pool->mutex);
+    pool->allocator.free(offset);
+    validatePool(pool->allocator);
 }
 
 void MemoryAllocator::freeImageMemory(VkDeviceMemory memory) {
@@ -322,22 +277,3 @@ void MemoryAllocator::freeImageMemory(VkDeviceMemory memory) {
     vkFreeMemory(vulkanDevice.getDevice(), memory, nullptr);
     imageMemories.erase(it);
 }
-
-void MemoryAllocator::mergeFreeBlocks(MemoryPool& pool) {
-    std::vector<Suballocation> mergedBlocks;
-
-    for (auto& block : pool.blocks) {
-        if (!mergedBlocks.empty() &&
-            mergedBlocks.back().isFree &&
-            block.isFree &&
-            (mergedBlocks.back().offset + mergedBlocks.back().size) == block.offset) {
-            // Merge consecutive free blocks
-            mergedBlocks.back().size += block.size;
-        }
-        else {
-            mergedBlocks.push_back(block);
-        }
-    }
-
-    pool.blocks = mergedBlocks;
-}
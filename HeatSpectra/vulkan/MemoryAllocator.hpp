@@ -3,9 +3,11 @@
 #include <memory>
 #include <mutex>
 #include <map>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "util/Structs.hpp"
+#include "TLSFAllocator.hpp"
 
 class VulkanDevice;
 
@@ -18,7 +20,9 @@ public:
     VkDeviceMemory memory;
     VkMemoryPropertyFlags memProperties;
 
-    std::vector<Suballocation> blocks;
+    // Offsets within buffer; guarded by mutex so pools can be used concurrently
+    TLSFAllocator allocator;
+    std::mutex mutex;
     void* mappedPtr = nullptr;
 
     // Delete copy operations
@@ -47,10 +51,11 @@ public:
 private:
     VulkanDevice& vulkanDevice;
     std::map<std::pair<VkBufferUsageFlags, VkMemoryPropertyFlags>, std::vector<std::unique_ptr<MemoryPool>>> pools;
+    std::unordered_map<VkBuffer, MemoryPool*> bufferPools;
     std::unordered_set<VkDeviceMemory> imageMemories;
     const VkDeviceSize DEFAULT_POOL_SIZE = 256 * 1024 * 1024; // 256MB
+    // Guards pools, bufferPools and imageMemories; suballocation takes the pool mutex
     std::mutex allocationMutex;
 
-    MemoryPool& createNewPool(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags memProps);
-    void mergeFreeBlocks(MemoryPool& pool);
+    MemoryPool* createNewPool(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags memProps);
 };
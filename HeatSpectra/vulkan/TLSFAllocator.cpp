@@ -0,0 +1,521 @@
+#include "TLSFAllocator.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace {
+
+uint32_t highestBit(uint64_t value) {
+#ifdef _MSC_VER
+    unsigned long index = 0;
+    _BitScanReverse64(&index, value);
+    return static_cast<uint32_t>(index);
+#else
+    return 63u - static_cast<uint32_t>(__builtin_clzll(value));
+#endif
+}
+
+uint32_t lowestBit(uint64_t value) {
+#ifdef _MSC_VER
+    unsigned long index = 0;
+    _BitScanForward64(&index, value);
+    return static_cast<uint32_t>(index);
+#else
+    return static_cast<uint32_t>(__builtin_ctzll(value));
+#endif
+}
+
+uint64_t alignUp(uint64_t value, uint64_t alignment) {
+    if (alignment <= 1) {
+        return value;
+    }
+    return ((value + alignment - 1) / alignment) * alignment;
+}
+
+// Best-fit scan over an offset-sorted block list, as MemoryAllocator did before
+class LinearBestFit {
+public:
+    explicit LinearBestFit(uint64_t capacity) {
+        blocks.push_back({ 0, capacity, true });
+    }
+
+    uint64_t allocate(uint64_t size, uint64_t alignment) {
+        uint64_t minRemaining = std::numeric_limits<uint64_t>::max();
+        size_t bestIndex = std::numeric_limits<size_t>::max();
+        uint64_t bestOffset = 0;
+        for (size_t index = 0; index < blocks.size(); ++index) {
+            const Entry& block = blocks[index];
+            if (!block.isFree) {
+                continue;
+            }
+            const uint64_t alignedOffset = alignUp(block.offset, alignment);
+            const uint64_t padding = alignedOffset - block.offset;
+            if (padding > block.size || size > block.size - padding) {
+                continue;
+            }
+            const uint64_t remaining = block.size - padding - size;
+            if (remaining < minRemaining) {
+                minRemaining = remaining;
+                bestIndex = index;
+                bestOffset = alignedOffset;
+            }
+        }
+        if (bestIndex == std::numeric_limits<size_t>::max()) {
+            return TLSFAllocator::INVALID_OFFSET;
+        }
+
+        const Entry freeBlock = blocks[bestIndex];
+        std::vector<Entry> replacement;
+        if (bestOffset > freeBlock.offset) {
+            replacement.push_back({ freeBlock.offset, bestOffset - freeBlock.offset, true });
+        }
+        replacement.push_back({ bestOffset, size, false });
+        if (bestOffset + size < freeBlock.offset + freeBlock.size) {
+            replacement.push_back({ bestOffset + size, freeBlock.offset + freeBlock.size - bestOffset - size, true });
+        }
+        blocks.erase(blocks.begin() + static_cast<std::ptrdiff_t>(bestIndex));
+        blocks.insert(blocks.begin() + static_cast<std::ptrdiff_t>(bestIndex), replacement.begin(), replacement.end());
+        return bestOffset;
+    }
+
+    void free(uint64_t offset) {
+        for (Entry& block : blocks) {
+            if (block.offset == offset && !block.isFree) {
+                block.isFree = true;
+                break;
+            }
+        }
+
+        std::vector<Entry> merged;
+        for (const Entry& block : blocks) {
+            if (!merged.empty() && merged.back().isFree && block.isFree) {
+                merged.back().size += block.size;
+            } else {
+                merged.push_back(block);
+            }
+        }
+        blocks = merged;
+    }
+
+private:
+    struct Entry {
+        uint64_t offset;
+        uint64_t size;
+        bool isFree;
+    };
+
+    std::vector<Entry> blocks;
+};
+
+struct TraceOperation {
+    bool isAllocation = false;
+    uint64_t size = 0;
+    uint64_t alignment = 1;
+    uint32_t liveSlot = 0;
+};
+
+template <typename Allocator>
+double replayTrace(Allocator& allocator, const std::vector<TraceOperation>& trace, uint32_t& outFailures) {
+    std::vector<uint64_t> liveOffsets;
+    outFailures = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (const TraceOperation& operation : trace) {
+        if (operation.isAllocation) {
+            const uint64_t offset = allocator.allocate(operation.size, operation.alignment);
+            if (offset == TLSFAllocator::INVALID_OFFSET) {
+                ++outFailures;
+            } else {
+                liveOffsets.push_back(offset);
+            }
+        } else if (!liveOffsets.empty()) {
+            const size_t slot = operation.liveSlot % liveOffsets.size();
+            allocator.free(liveOffsets[slot]);
+            liveOffsets[slot] = liveOffsets.back();
+            liveOffsets.pop_back();
+        }
+    }
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+constexpr uint32_t VALIDATION_INTERVAL = 64;
+
+// Untimed replay that checks every returned offset's alignment and runs validate()
+// every VALIDATION_INTERVAL operations and after the last one.
+uint32_t validateTrace(uint64_t capacity, const std::vector<TraceOperation>& trace) {
+    TLSFAllocator allocator(capacity);
+    std::vector<uint64_t> liveOffsets;
+    uint32_t failures = 0;
+    for (size_t operationIndex = 0; operationIndex < trace.size(); ++operationIndex) {
+        const TraceOperation& operation = trace[operationIndex];
+        if (operation.isAllocation) {
+            const uint64_t offset = allocator.allocate(operation.size, operation.alignment);
+            if (offset != TLSFAllocator::INVALID_OFFSET) {
+                if (offset % operation.alignment != 0) {
+                    ++failures;
+                }
+                liveOffsets.push_back(offset);
+            }
+        } else if (!liveOffsets.empty()) {
+            const size_t slot = operation.liveSlot % liveOffsets.size();
+            if (!allocator.free(liveOffsets[slot])) {
+                ++failures;
+            }
+            liveOffsets[slot] = liveOffsets.back();
+            liveOffsets.pop_back();
+        }
+
+        if ((operationIndex + 1) % VALIDATION_INTERVAL == 0 && !allocator.validate()) {
+            ++failures;
+        }
+    }
+    if (!allocator.validate()) {
+        ++failures;
+    }
+    return failures;
+}
+
+}
+
+TLSFAllocator::TLSFAllocator() {
+    reset(0);
+}
+
+TLSFAllocator::TLSFAllocator(uint64_t capacity) {
+    reset(capacity);
+}
+
+void TLSFAllocator::reset(uint64_t updatedCapacity) {
+    capacity = updatedCapacity;
+    firstLevelBitmap = 0;
+    for (uint32_t first = 0; first < FL_COUNT; ++first) {
+        secondLevelBitmaps[first] = 0;
+        for (uint32_t second = 0; second < SL_COUNT; ++second) {
+            freeHeads[first][second] = NONE;
+        }
+    }
+    blocks.clear();
+    unusedBlocks.clear();
+    allocatedBlocks.clear();
+
+    if (capacity > 0) {
+        insertFree(createBlock(0, capacity));
+    }
+}
+
+uint64_t TLSFAllocator::allocate(uint64_t size, uint64_t alignment) {
+    size = std::max<uint64_t>(size, 1);
+    alignment = std::max<uint64_t>(alignment, 1);
+    if (size > capacity || alignment - 1 > capacity - size) {
+        return INVALID_OFFSET;
+    }
+
+    // Round the request up to the next class boundary so any block in the found
+    // list fits even after worst-case alignment padding
+    uint64_t searchSize = size + (alignment - 1);
+    if (searchSize >= SL_COUNT) {
+        const uint64_t roundUp = (uint64_t(1) << (highestBit(searchSize) - SL_BITS)) - 1;
+        if (searchSize > std::numeric_limits<uint64_t>::max() - roundUp) {
+            return INVALID_OFFSET;
+        }
+        searchSize += roundUp;
+    }
+
+    uint32_t first = 0;
+    uint32_t second = 0;
+    mapping(searchSize, first, second);
+    if (first >= FL_COUNT || !findFreeBlock(first, second)) {
+        return INVALID_OFFSET;
+    }
+
+    uint32_t blockIndex = freeHeads[first][second];
+    removeFree(blockIndex);
+
+    const uint64_t alignedOffset = alignUp(blocks[blockIndex].offset, alignment);
+    const uint64_t padding = alignedOffset - blocks[blockIndex].offset;
+    if (padding > 0) {
+        insertFree(splitFront(blockIndex, padding));
+    }
+
+    if (blocks[blockIndex].size > size) {
+        // Split the tail off by carving the allocation from the front
+        const uint32_t allocatedIndex = splitFront(blockIndex, size);
+        insertFree(blockIndex);
+        blockIndex = allocatedIndex;
+    }
+
+    blocks[blockIndex].isFree = false;
+    allocatedBlocks[blocks[blockIndex].offset] = blockIndex;
+    return blocks[blockIndex].offset;
+}
+
+bool TLSFAllocator::free(uint64_t offset) {
+    const auto it = allocatedBlocks.find(offset);
+    if (it == allocatedBlocks.end()) {
+        return false;
+    }
+
+    uint32_t blockIndex = it->second;
+    allocatedBlocks.erase(it);
+    blocks[blockIndex].isFree = true;
+
+    const uint32_t nextIndex = blocks[blockIndex].nextPhysical;
+    if (nextIndex != NONE && blocks[nextIndex].isFree) {
+        removeFree(nextIndex);
+        mergeWithNext(blockIndex);
+    }
+
+    const uint32_t prevIndex = blocks[blockIndex].prevPhysical;
+    if (prevIndex != NONE && blocks[prevIndex].isFree) {
+        removeFree(prevIndex);
+        mergeWithNext(prevIndex);
+        blockIndex = prevIndex;
+    }
+
+    insertFree(blockIndex);
+    return true;
+}
+
+TLSFAllocator::Stats TLSFAllocator::getStats() const {
+    Stats stats{};
+    stats.capacity = capacity;
+    stats.allocationCount = static_cast<uint32_t>(allocatedBlocks.size());
+    for (const auto& [offset, blockIndex] : allocatedBlocks) {
+        (void)offset;
+        stats.usedBytes += blocks[blockIndex].size;
+    }
+    stats.freeBytes = capacity - stats.usedBytes;
+
+    for (uint32_t first = 0; first < FL_COUNT; ++first) {
+        for (uint32_t second = 0; second < SL_COUNT; ++second) {
+            for (uint32_t blockIndex = freeHeads[first][second]; blockIndex != NONE; blockIndex = blocks[blockIndex].nextFree) {
+                stats.largestFreeBlock = std::max(stats.largestFreeBlock, blocks[blockIndex].size);
+                ++stats.freeBlockCount;
+            }
+        }
+    }
+    return stats;
+}
+
+bool TLSFAllocator::validate() const {
+    uint32_t freeBlockCount = 0;
+    for (uint32_t first = 0; first < FL_COUNT; ++first) {
+        const bool firstBitSet = (firstLevelBitmap >> first) & 1u;
+        if (firstBitSet != (secondLevelBitmaps[first] != 0)) {
+            return false;
+        }
+        for (uint32_t second = 0; second < SL_COUNT; ++second) {
+            const bool secondBitSet = (secondLevelBitmaps[first] >> second) & 1u;
+            if (secondBitSet != (freeHeads[first][second] != NONE)) {
+                return false;
+            }
+
+            uint32_t previous = NONE;
+            for (uint32_t blockIndex = freeHeads[first][second]; blockIndex != NONE; blockIndex = blocks[blockIndex].nextFree) {
+                const Block& block = blocks[blockIndex];
+                uint32_t blockFirst = 0;
+                uint32_t blockSecond = 0;
+                mapping(block.size, blockFirst, blockSecond);
+                if (!block.isFree || block.prevFree != previous || blockFirst != first || blockSecond != second) {
+                    return false;
+                }
+                previous = blockIndex;
+                ++freeBlockCount;
+            }
+        }
+    }
+
+    uint32_t physicalFreeCount = 0;
+    uint32_t physicalUsedCount = 0;
+    uint64_t expectedOffset = 0;
+    uint32_t previous = NONE;
+    uint32_t blockIndex = NONE;
+    for (uint32_t index = 0; index < blocks.size(); ++index) {
+        if (blocks[index].size > 0 && blocks[index].offset == 0 && blocks[index].prevPhysical == NONE) {
+            blockIndex = index;
+            break;
+        }
+    }
+
+    while (blockIndex != NONE) {
+        const Block& block = blocks[blockIndex];
+        if (block.offset != expectedOffset || block.prevPhysical != previous || block.size == 0) {
+            return false;
+        }
+        if (block.isFree) {
+            if (previous != NONE && blocks[previous].isFree) {
+                return false;
+            }
+            ++physicalFreeCount;
+        } else {
+            const auto it = allocatedBlocks.find(block.offset);
+            if (it == allocatedBlocks.end() || it->second != blockIndex) {
+                return false;
+            }
+            ++physicalUsedCount;
+        }
+        expectedOffset += block.size;
+        previous = blockIndex;
+        blockIndex = block.nextPhysical;
+    }
+
+    return expectedOffset == capacity &&
+        physicalFreeCount == freeBlockCount &&
+        physicalUsedCount == allocatedBlocks.size();
+}
+
+TLSFAllocator::BenchmarkResult TLSFAllocator::benchmark(uint64_t capacity, uint32_t operationCount, uint32_t seed) {
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<double> logSize(6.0, 20.0);
+    std::uniform_int_distribution<uint32_t> alignmentChoice(0, 2);
+    std::uniform_int_distribution<uint32_t> operationChoice(0, 9);
+    const uint64_t alignments[3] = { 4, 16, 256 };
+
+    std::vector<TraceOperation> trace(operationCount);
+    for (TraceOperation& operation : trace) {
+        operation.isAllocation = operationChoice(random) < 6;
+        operation.size = static_cast<uint64_t>(std::exp2(logSize(random)));
+        operation.alignment = alignments[alignmentChoice(random)];
+        operation.liveSlot = static_cast<uint32_t>(random());
+    }
+
+    BenchmarkResult result{};
+    result.operationCount = operationCount;
+
+    LinearBestFit linear(capacity);
+    result.linearMs = replayTrace(linear, trace, result.linearFailures);
+
+    TLSFAllocator tlsf(capacity);
+    result.tlsfMs = replayTrace(tlsf, trace, result.tlsfFailures);
+    result.validationFailures = validateTrace(capacity, trace);
+    return result;
+}
+
+void TLSFAllocator::mapping(uint64_t size, uint32_t& outFirst, uint32_t& outSecond) {
+    if (size < SL_COUNT) {
+        outFirst = 0;
+        outSecond = static_cast<uint32_t>(size);
+        return;
+    }
+
+    const uint32_t highest = highestBit(size);
+    outFirst = highest - SL_BITS + 1;
+    outSecond = static_cast<uint32_t>(size >> (highest - SL_BITS)) - SL_COUNT;
+}
+
+bool TLSFAllocator::findFreeBlock(uint32_t& outFirst, uint32_t& outSecond) const {
+    uint32_t secondMap = secondLevelBitmaps[outFirst] & (~0u << outSecond);
+    if (secondMap == 0) {
+        if (outFirst + 1 >= FL_COUNT) {
+            return false;
+        }
+        const uint64_t firstMap = firstLevelBitmap & (~uint64_t(0) << (outFirst + 1));
+        if (firstMap == 0) {
+            return false;
+        }
+        outFirst = lowestBit(firstMap);
+        secondMap = secondLevelBitmaps[outFirst];
+    }
+
+    outSecond = lowestBit(secondMap);
+    return true;
+}
+
+uint32_t TLSFAllocator::createBlock(uint64_t offset, uint64_t size) {
+    uint32_t blockIndex = NONE;
+    if (!unusedBlocks.empty()) {
+        blockIndex = unusedBlocks.back();
+        unusedBlocks.pop_back();
+    } else {
+        blockIndex = static_cast<uint32_t>(blocks.size());
+        blocks.emplace_back();
+    }
+
+    blocks[blockIndex] = Block{};
+    blocks[blockIndex].offset = offset;
+    blocks[blockIndex].size = size;
+    return blockIndex;
+}
+
+void TLSFAllocator::releaseBlock(uint32_t blockIndex) {
+    blocks[blockIndex] = Block{};
+    unusedBlocks.push_back(blockIndex);
+}
+
+void TLSFAllocator::insertFree(uint32_t blockIndex) {
+    Block& block = blocks[blockIndex];
+    uint32_t first = 0;
+    uint32_t second = 0;
+    mapping(block.size, first, second);
+
+    block.isFree = true;
+    block.prevFree = NONE;
+    block.nextFree = freeHeads[first][second];
+    if (block.nextFree != NONE) {
+        blocks[block.nextFree].prevFree = blockIndex;
+    }
+    freeHeads[first][second] = blockIndex;
+    firstLevelBitmap |= uint64_t(1) << first;
+    secondLevelBitmaps[first] |= 1u << second;
+}
+
+void TLSFAllocator::removeFree(uint32_t blockIndex) {
+    Block& block = blocks[blockIndex];
+    uint32_t first = 0;
+    uint32_t second = 0;
+    mapping(block.size, first, second);
+
+    if (block.prevFree != NONE) {
+        blocks[block.prevFree].nextFree = block.nextFree;
+    } else {
+        freeHeads[first][second] = block.nextFree;
+    }
+    if (block.nextFree != NONE) {
+        blocks[block.nextFree].prevFree = block.prevFree;
+    }
+    block.prevFree = NONE;
+    block.nextFree = NONE;
+    block.isFree = false;
+
+    if (freeHeads[first][second] == NONE) {
+        secondLevelBitmaps[first] &= ~(1u << second);
+        if (secondLevelBitmaps[first] == 0) {
+            firstLevelBitmap &= ~(uint64_t(1) << first);
+        }
+    }
+}
+
+uint32_t TLSFAllocator::splitFront(uint32_t blockIndex, uint64_t frontSize) {
+    // createBlock may grow the vector, so index rather than hold references
+    const uint32_t frontIndex = createBlock(blocks[blockIndex].offset, frontSize);
+    const uint32_t prevIndex = blocks[blockIndex].prevPhysical;
+
+    blocks[frontIndex].prevPhysical = prevIndex;
+    blocks[frontIndex].nextPhysical = blockIndex;
+    if (prevIndex != NONE) {
+        blocks[prevIndex].nextPhysical = frontIndex;
+    }
+
+    blocks[blockIndex].prevPhysical = frontIndex;
+    blocks[blockIndex].offset += frontSize;
+    blocks[blockIndex].size -= frontSize;
+    return frontIndex;
+}
+
+void TLSFAllocator::mergeWithNext(uint32_t blockIndex) {
+    const uint32_t nextIndex = blocks[blockIndex].nextPhysical;
+    const uint32_t afterIndex = blocks[nextIndex].nextPhysical;
+
+    blocks[blockIndex].size += blocks[nextIndex].size;
+    blocks[blockIndex].nextPhysical = afterIndex;
+    if (afterIndex != NONE) {
+        blocks[afterIndex].prevPhysical = blockIndex;
+    }
+    releaseBlock(nextIndex);
+}
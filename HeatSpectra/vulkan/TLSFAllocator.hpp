@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+// Two-level segregated-fit bookkeeping for one linear address range. It only hands
+// out offsets and has no Vulkan dependency, so MemoryPool wraps one per VkBuffer.
+// Free blocks sit in per-size-class lists found through two bitmaps, which makes
+// allocate O(1) and free O(1) plus one hash lookup; neighbours coalesce on free.
+class TLSFAllocator {
+public:
+    static constexpr uint64_t INVALID_OFFSET = std::numeric_limits<uint64_t>::max();
+
+    struct Stats {
+        uint64_t capacity = 0;
+        uint64_t usedBytes = 0;
+        uint64_t freeBytes = 0;
+        uint64_t largestFreeBlock = 0;
+        uint32_t allocationCount = 0;
+        uint32_t freeBlockCount = 0;
+    };
+
+    struct BenchmarkResult {
+        uint32_t operationCount = 0;
+        double linearMs = 0.0;
+        double tlsfMs = 0.0;
+        uint32_t linearFailures = 0;
+        uint32_t tlsfFailures = 0;
+        uint32_t validationFailures = 0;
+    };
+
+    TLSFAllocator();
+    explicit TLSFAllocator(uint64_t capacity);
+
+    void reset(uint64_t capacity);
+
+    // Returns INVALID_OFFSET when no free block can hold size bytes at the alignment.
+    uint64_t allocate(uint64_t size, uint64_t alignment = 1);
+    bool free(uint64_t offset);
+
+    uint64_t getCapacity() const { return capacity; }
+    Stats getStats() const;
+    // Checks the physical chain, coalescing and free-list invariants.
+    bool validate() const;
+
+    // Replays a synthetic random alloc/free trace against this allocator and the
+    // previous linear best-fit scan over the same capacity, then replays it once more
+    // untimed with alignment checks and periodic validate() calls.
+    static BenchmarkResult benchmark(uint64_t capacity, uint32_t operationCount, uint32_t seed);
+
+private:
+    static constexpr uint32_t SL_BITS = 5;
+    static constexpr uint32_t SL_COUNT = 1u << SL_BITS;
+    static constexpr uint32_t FL_COUNT = 64 - SL_BITS + 1;
+    static constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+
+    struct Block {
+        uint64_t offset = 0;
+        uint64_t size = 0;
+        uint32_t prevPhysical = NONE;
+        uint32_t nextPhysical = NONE;
+        uint32_t prevFree = NONE;
+        uint32_t nextFree = NONE;
+        bool isFree = false;
+    };
+
+    static void mapping(uint64_t size, uint32_t& outFirst, uint32_t& outSecond);
+    bool findFreeBlock(uint32_t& outFirst, uint32_t& outSecond) const;
+
+    uint32_t createBlock(uint64_t offset, uint64_t size);
+    void releaseBlock(uint32_t blockIndex);
+    void insertFree(uint32_t blockIndex);
+    void removeFree(uint32_t blockIndex);
+    uint32_t splitFront(uint32_t blockIndex, uint64_t frontSize);
+    void mergeWithNext(uint32_t blockIndex);
+
+    uint64_t capacity = 0;
+    uint64_t firstLevelBitmap = 0;
+    uint32_t secondLevelBitmaps[FL_COUNT] = {};
+    uint32_t freeHeads[FL_COUNT][SL_COUNT];
+
+    std::vector<Block> blocks;
+    std::vector<uint32_t> unusedBlocks;
+    std::unordered_map<uint64_t, uint32_t> allocatedBlocks;
+};
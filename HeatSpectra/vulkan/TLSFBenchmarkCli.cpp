@@ -0,0 +1,71 @@
+#include "TLSFBenchmarkCli.hpp"
+
+#include "TLSFAllocator.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+namespace {
+
+constexpr const char* BENCH_COMMAND = "--bench-tlsf";
+
+void printUsage() {
+    std::cerr << "Usage:\n"
+              << "  HeatSpectra " << BENCH_COMMAND
+              << " [--capacity-mb <megabytes>] [--operations <count>] [--seed <value>]" << std::endl;
+}
+
+bool parsePositive(const char* text, uint32_t& outValue) {
+    if (!text || *text == '\0') {
+        return false;
+    }
+    char* end = nullptr;
+    const unsigned long long value = std::strtoull(text, &end, 10);
+    if (*end != '\0' || value == 0 || value > UINT32_MAX) {
+        return false;
+    }
+    outValue = static_cast<uint32_t>(value);
+    return true;
+}
+
+}
+
+bool isTLSFBenchmarkCliInvocation(int argc, char** argv) {
+    return argc > 1 && argv[1] && std::strcmp(argv[1], BENCH_COMMAND) == 0;
+}
+
+int runTLSFBenchmarkCli(int argc, char** argv) {
+    uint32_t capacityMegabytes = 256;
+    uint32_t operationCount = 200000;
+    uint32_t seed = 1;
+    for (int argIndex = 2; argIndex < argc; argIndex += 2) {
+        const char* option = argv[argIndex];
+        const char* value = argIndex + 1 < argc ? argv[argIndex + 1] : nullptr;
+        bool parsed = false;
+        if (std::strcmp(option, "--capacity-mb") == 0) {
+            parsed = parsePositive(value, capacityMegabytes);
+        } else if (std::strcmp(option, "--operations") == 0) {
+            parsed = parsePositive(value, operationCount);
+        } else if (std::strcmp(option, "--seed") == 0) {
+            parsed = parsePositive(value, seed);
+        }
+        if (!parsed) {
+            printUsage();
+            return 1;
+        }
+    }
+
+    const uint64_t capacity = static_cast<uint64_t>(capacityMegabytes) * 1024 * 1024;
+    const TLSFAllocator::BenchmarkResult result = TLSFAllocator::benchmark(capacity, operationCount, seed);
+    std::cout << result.operationCount << " operations over " << capacityMegabytes << " MB\n"
+              << std::fixed << std::setprecision(2)
+              << "  linear best-fit " << std::setw(10) << result.linearMs << " ms, "
+              << result.linearFailures << " failed allocations\n"
+              << "  tlsf            " << std::setw(10) << result.tlsfMs << " ms, "
+              << result.tlsfFailures << " failed allocations\n"
+              << "  validation      " << result.validationFailures << " failed checks" << std::defaultfloat << std::endl;
+    return result.validationFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+// Replays a random alloc/free trace through TLSFAllocator and the previous linear
+// best-fit scan and validates the TLSF invariants along the trace, handled before
+// the UI starts. Exits non-zero when validation fails:
+//   --bench-tlsf [--capacity-mb <megabytes>] [--operations <count>] [--seed <value>]
+bool isTLSFBenchmarkCliInvocation(int argc, char** argv);
+int runTLSFBenchmarkCli(int argc, char** argv);
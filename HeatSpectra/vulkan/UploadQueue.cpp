@@ -0,0 +1,386 @@
+#include "UploadQueue.hpp"
+
+#include "CommandBufferManager.hpp"
+#include "VulkanDevice.hpp"
+
+#include <cstring>
+#include <iostream>
+
+namespace {
+
+uint64_t alignCursor(uint64_t value, uint64_t alignment) {
+    return ((value + alignment - 1) / alignment) * alignment;
+}
+
+}
+
+UploadQueue::UploadQueue(VulkanDevice& vulkanDevice, VkDeviceSize ringSize)
+    : vulkanDevice(vulkanDevice), ringSize(ringSize) {
+}
+
+UploadQueue::~UploadQueue() {
+    std::lock_guard<std::mutex> lock(mutex);
+    VkDevice device = vulkanDevice.getDevice();
+    if (device == VK_NULL_HANDLE) {
+        return;
+    }
+
+    waitLocked(nextTicket);
+    for (const OverflowBuffer& overflow : pendingOverflow) {
+        destroyOverflow(overflow);
+    }
+    for (VkFence fence : freeFences) {
+        vkDestroyFence(device, fence, nullptr);
+    }
+    if (commandPool != VK_NULL_HANDLE) {
+        vkDestroyCommandPool(device, commandPool, nullptr);
+    }
+    if (ringMemory != VK_NULL_HANDLE) {
+        vkUnmapMemory(device, ringMemory);
+    }
+    if (ringBuffer != VK_NULL_HANDLE) {
+        vkDestroyBuffer(device, ringBuffer, nullptr);
+    }
+    if (ringMemory != VK_NULL_HANDLE) {
+        vkFreeMemory(device, ringMemory, nullptr);
+    }
+}
+
+UploadQueue::Ticket UploadQueue::enqueueBufferCopy(const void* data, VkDeviceSize size, VkBuffer dstBuffer, VkDeviceSize dstOffset) {
+    if (!data || size == 0 || dstBuffer == VK_NULL_HANDLE) {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!ensureResources()) {
+        return 0;
+    }
+    retireLocked(false);
+
+    PendingCopy copy{};
+    copy.dstBuffer = dstBuffer;
+    copy.region.dstOffset = dstOffset;
+    copy.region.size = size;
+
+    uint64_t cursor = 0;
+    if (size <= ringSize && reserveRing(size, cursor)) {
+        const VkDeviceSize ringOffset = static_cast<VkDeviceSize>(cursor % ringSize);
+        std::memcpy(ringData + ringOffset, data, static_cast<size_t>(size));
+        copy.srcBuffer = ringBuffer;
+        copy.region.srcOffset = ringOffset;
+    } else {
+        // Larger than the whole ring: stage through a buffer freed when the batch retires
+        OverflowBuffer overflow{};
+        if (!stageOverflow(data, size, overflow)) {
+            return 0;
+        }
+        pendingOverflow.push_back(overflow);
+        copy.srcBuffer = overflow.buffer;
+        copy.region.srcOffset = 0;
+    }
+
+    pendingCopies.push_back(copy);
+    return nextTicket;
+}
+
+UploadQueue::Ticket UploadQueue::flush() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return flushLocked();
+}
+
+UploadQueue::Ticket UploadQueue::publish() {
+    std::lock_guard<std::mutex> lock(mutex);
+    const Ticket ticket = flushLocked();
+    if (vulkanDevice.getComputeQueue() != vulkanDevice.getGraphicsQueue()) {
+        waitLocked(ticket);
+    }
+    return ticket;
+}
+
+bool UploadQueue::isComplete(Ticket ticket) {
+    std::lock_guard<std::mutex> lock(mutex);
+    retireLocked(false);
+    return ticket <= completedTicket;
+}
+
+void UploadQueue::wait(Ticket ticket) {
+    if (ticket == 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    waitLocked(ticket);
+}
+
+void UploadQueue::waitIdle() {
+    std::lock_guard<std::mutex> lock(mutex);
+    waitLocked(nextTicket);
+}
+
+void UploadQueue::collect() {
+    std::lock_guard<std::mutex> lock(mutex);
+    retireLocked(false);
+}
+
+bool UploadQueue::ensureResources() {
+    if (ringData) {
+        return true;
+    }
+
+    VkDevice device = vulkanDevice.getDevice();
+    if (device == VK_NULL_HANDLE || ringSize == 0) {
+        return false;
+    }
+
+    if (commandPool == VK_NULL_HANDLE) {
+        VkCommandPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.queueFamilyIndex = vulkanDevice.getQueueFamilyIndices().graphicsFamily.value();
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT | VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        if (vkCreateCommandPool(device, &poolInfo, nullptr, &commandPool) != VK_SUCCESS) {
+            std::cerr << "[UploadQueue] Failed to create command pool" << std::endl;
+            commandPool = VK_NULL_HANDLE;
+            return false;
+        }
+    }
+
+    if (ringBuffer == VK_NULL_HANDLE) {
+        const VkResult result = vulkanDevice.createBuffer(
+            ringSize,
+            VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+            ringMemory,
+            ringBuffer);
+        if (result != VK_SUCCESS) {
+            std::cerr << "[UploadQueue] Failed to create staging ring of " << ringSize << " bytes" << std::endl;
+            return false;
+        }
+    }
+
+    void* mapped = nullptr;
+    if (vkMapMemory(device, ringMemory, 0, ringSize, 0, &mapped) != VK_SUCCESS || !mapped) {
+        std::cerr << "[UploadQueue] Failed to map staging ring" << std::endl;
+        return false;
+    }
+
+    ringData = static_cast<uint8_t*>(mapped);
+    return true;
+}
+
+bool UploadQueue::reserveRing(VkDeviceSize size, uint64_t& outCursor) {
+    for (;;) {
+        if (inFlight.empty() && pendingCopies.empty()) {
+            writeCursor = 0;
+            retireCursor = 0;
+        }
+
+        // Copies never straddle the end of the ring
+        uint64_t start = alignCursor(writeCursor, RING_ALIGNMENT);
+        if ((start % ringSize) + size > ringSize) {
+            start = alignCursor(start, ringSize);
+        }
+        if (start + size - retireCursor <= ringSize) {
+            writeCursor = start + size;
+            outCursor = start;
+            return true;
+        }
+
+        // Space held by unsubmitted copies only comes back once they are submitted
+        if (!pendingCopies.empty()) {
+            flushLocked();
+        }
+        if (inFlight.empty()) {
+            return false;
+        }
+        retireLocked(true);
+    }
+}
+
+bool UploadQueue::stageOverflow(const void* data, VkDeviceSize size, OverflowBuffer& outBuffer) {
+    outBuffer = {};
+    if (vulkanDevice.createBuffer(
+            size,
+            VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+            outBuffer.memory,
+            outBuffer.buffer) != VK_SUCCESS) {
+        std::cerr << "[UploadQueue] Failed to create overflow staging buffer of " << size << " bytes" << std::endl;
+        return false;
+    }
+
+    void* mapped = nullptr;
+    if (vkMapMemory(vulkanDevice.getDevice(), outBuffer.memory, 0, size, 0, &mapped) != VK_SUCCESS || !mapped) {
+        std::cerr << "[UploadQueue] Failed to map overflow staging buffer" << std::endl;
+        destroyOverflow(outBuffer);
+        outBuffer = {};
+        return false;
+    }
+    std::memcpy(mapped, data, static_cast<size_t>(size));
+    vkUnmapMemory(vulkanDevice.getDevice(), outBuffer.memory);
+    return true;
+}
+
+UploadQueue::Ticket UploadQueue::flushLocked() {
+    if (pendingCopies.empty()) {
+        return nextTicket - 1;
+    }
+
+    VkDevice device = vulkanDevice.getDevice();
+    Submission submission{};
+    submission.ticket = nextTicket++;
+    submission.ringEnd = writeCursor;
+    submission.overflowBuffers = std::move(pendingOverflow);
+    pendingOverflow.clear();
+
+    if (!freeCommandBuffers.empty()) {
+        submission.commandBuffer = freeCommandBuffers.back();
+        freeCommandBuffers.pop_back();
+    } else {
+        VkCommandBufferAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandPool = commandPool;
+        allocInfo.commandBufferCount = 1;
+        if (vkAllocateCommandBuffers(device, &allocInfo, &submission.commandBuffer) != VK_SUCCESS) {
+            submission.commandBuffer = VK_NULL_HANDLE;
+        }
+    }
+
+    if (!freeFences.empty()) {
+        submission.fence = freeFences.back();
+        freeFences.pop_back();
+    } else {
+        VkFenceCreateInfo fenceInfo{};
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        if (vkCreateFence(device, &fenceInfo, nullptr, &submission.fence) != VK_SUCCESS) {
+            submission.fence = VK_NULL_HANDLE;
+        }
+    }
+
+    if (submission.commandBuffer == VK_NULL_HANDLE || submission.fence == VK_NULL_HANDLE) {
+        std::cerr << "[UploadQueue] Failed to acquire command buffer or fence, dropping "
+                  << pendingCopies.size() << " copies" << std::endl;
+        if (submission.commandBuffer != VK_NULL_HANDLE) {
+            freeCommandBuffers.push_back(submission.commandBuffer);
+        }
+        if (submission.fence != VK_NULL_HANDLE) {
+            freeFences.push_back(submission.fence);
+        }
+        pendingCopies.clear();
+        return dropLocked(submission);
+    }
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkBeginCommandBuffer(submission.commandBuffer, &beginInfo);
+
+    // Destinations may still be read by earlier frames on this queue
+    vkCmdPipelineBarrier(
+        submission.commandBuffer,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        0, 0, nullptr, 0, nullptr, 0, nullptr);
+
+    std::vector<VkBufferCopy> regions;
+    size_t copyIndex = 0;
+    while (copyIndex < pendingCopies.size()) {
+        const VkBuffer srcBuffer = pendingCopies[copyIndex].srcBuffer;
+        const VkBuffer dstBuffer = pendingCopies[copyIndex].dstBuffer;
+        regions.clear();
+        while (copyIndex < pendingCopies.size() &&
+            pendingCopies[copyIndex].srcBuffer == srcBuffer &&
+            pendingCopies[copyIndex].dstBuffer == dstBuffer) {
+            regions.push_back(pendingCopies[copyIndex].region);
+            ++copyIndex;
+        }
+        vkCmdCopyBuffer(submission.commandBuffer, srcBuffer, dstBuffer, static_cast<uint32_t>(regions.size()), regions.data());
+    }
+
+    VkMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+    vkCmdPipelineBarrier(
+        submission.commandBuffer,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+    vkEndCommandBuffer(submission.commandBuffer);
+    pendingCopies.clear();
+
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &submission.commandBuffer;
+    if (CommandPool::submit(vulkanDevice, submitInfo, submission.fence) != VK_SUCCESS) {
+        std::cerr << "[UploadQueue] Failed to submit upload batch " << submission.ticket << std::endl;
+        vkResetCommandBuffer(submission.commandBuffer, 0);
+        freeCommandBuffers.push_back(submission.commandBuffer);
+        freeFences.push_back(submission.fence);
+        return dropLocked(submission);
+    }
+
+    const Ticket ticket = submission.ticket;
+    inFlight.push_back(std::move(submission));
+    return ticket;
+}
+
+UploadQueue::Ticket UploadQueue::dropLocked(Submission& submission) {
+    // Earlier batches may still be copying out of the ring below ringEnd
+    submission.commandBuffer = VK_NULL_HANDLE;
+    submission.fence = VK_NULL_HANDLE;
+    submission.dropped = true;
+    for (const OverflowBuffer& overflow : submission.overflowBuffers) {
+        destroyOverflow(overflow);
+    }
+    submission.overflowBuffers.clear();
+
+    const Ticket ticket = submission.ticket;
+    inFlight.push_back(std::move(submission));
+    return ticket;
+}
+
+void UploadQueue::retireLocked(bool waitForOldest) {
+    VkDevice device = vulkanDevice.getDevice();
+    if (waitForOldest && !inFlight.empty() && !inFlight.front().dropped) {
+        vkWaitForFences(device, 1, &inFlight.front().fence, VK_TRUE, UINT64_MAX);
+    }
+
+    while (!inFlight.empty() &&
+        (inFlight.front().dropped || vkGetFenceStatus(device, inFlight.front().fence) == VK_SUCCESS)) {
+        Submission& submission = inFlight.front();
+        if (!submission.dropped) {
+            vkResetFences(device, 1, &submission.fence);
+            vkResetCommandBuffer(submission.commandBuffer, 0);
+            freeFences.push_back(submission.fence);
+            freeCommandBuffers.push_back(submission.commandBuffer);
+        }
+        for (const OverflowBuffer& overflow : submission.overflowBuffers) {
+            destroyOverflow(overflow);
+        }
+        retireCursor = submission.ringEnd;
+        completedTicket = submission.ticket;
+        inFlight.pop_front();
+    }
+}
+
+void UploadQueue::waitLocked(Ticket ticket) {
+    if (ticket >= nextTicket && !pendingCopies.empty()) {
+        flushLocked();
+    }
+    while (completedTicket < ticket && !inFlight.empty()) {
+        retireLocked(true);
+    }
+}
+
+void UploadQueue::destroyOverflow(const OverflowBuffer& overflow) {
+    VkDevice device = vulkanDevice.getDevice();
+    if (overflow.buffer != VK_NULL_HANDLE) {
+        vkDestroyBuffer(device, overflow.buffer, nullptr);
+    }
+    if (overflow.memory != VK_NULL_HANDLE) {
+        vkFreeMemory(device, overflow.memory, nullptr);
+    }
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+class VulkanDevice;
+
+// Batches host-to-device buffer copies through a persistent host-visible staging
+// ring. enqueueBufferCopy only copies into the ring; flush records every pending
+// copy into one command buffer and submits it with a fence, without waiting.
+// Later submissions on the graphics queue see the data, so callers only need to
+// wait on a ticket before freeing or reading back the destination. Data that the
+// compute queue reads must go through publish() instead of flush().
+// A batch that fails to submit is dropped but stays queued until the batches ahead
+// of it retire, so its ring space is never reused while they still read from it.
+class UploadQueue {
+public:
+    using Ticket = uint64_t;
+
+    static constexpr VkDeviceSize DEFAULT_RING_SIZE = 32ull * 1024ull * 1024ull;
+
+    UploadQueue(VulkanDevice& vulkanDevice, VkDeviceSize ringSize = DEFAULT_RING_SIZE);
+    ~UploadQueue();
+
+    UploadQueue(const UploadQueue&) = delete;
+    UploadQueue& operator=(const UploadQueue&) = delete;
+
+    // Returns the ticket of the submission that will carry the copy, or 0 on failure.
+    Ticket enqueueBufferCopy(const void* data, VkDeviceSize size, VkBuffer dstBuffer, VkDeviceSize dstOffset);
+    // Submits all pending copies; returns the newest ticket handed out so far.
+    Ticket flush();
+    // Like flush, but also waits for the copies when compute runs on its own queue,
+    // which is not ordered behind graphics submissions.
+    Ticket publish();
+
+    bool isComplete(Ticket ticket);
+    void wait(Ticket ticket);
+    void waitIdle();
+    // Retires finished submissions and recycles their ring space.
+    void collect();
+
+private:
+    struct PendingCopy {
+        VkBuffer srcBuffer = VK_NULL_HANDLE;
+        VkBuffer dstBuffer = VK_NULL_HANDLE;
+        VkBufferCopy region{};
+    };
+
+    struct OverflowBuffer {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+    };
+
+    struct Submission {
+        Ticket ticket = 0;
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        VkFence fence = VK_NULL_HANDLE;
+        uint64_t ringEnd = 0;
+        std::vector<OverflowBuffer> overflowBuffers;
+        // Never reached the queue; retires as soon as it is the oldest entry
+        bool dropped = false;
+    };
+
+    static constexpr VkDeviceSize RING_ALIGNMENT = 16;
+
+    bool ensureResources();
+    bool reserveRing(VkDeviceSize size, uint64_t& outCursor);
+    bool stageOverflow(const void* data, VkDeviceSize size, OverflowBuffer& outBuffer);
+    Ticket flushLocked();
+    Ticket dropLocked(Submission& submission);
+    void retireLocked(bool waitForOldest);
+    void waitLocked(Ticket ticket);
+    void destroyOverflow(const OverflowBuffer& overflow);
+
+    VulkanDevice& vulkanDevice;
+    std::mutex mutex;
+
+    VkCommandPool commandPool = VK_NULL_HANDLE;
+    VkBuffer ringBuffer = VK_NULL_HANDLE;
+    VkDeviceMemory ringMemory = VK_NULL_HANDLE;
+    uint8_t* ringData = nullptr;
+    VkDeviceSize ringSize = 0;
+
+    // Monotonic byte cursors; the physical offset is cursor % ringSize
+    uint64_t writeCursor = 0;
+    uint64_t retireCursor = 0;
+
+    std::vector<PendingCopy> pendingCopies;
+    std::vector<OverflowBuffer> pendingOverflow;
+    std::deque<Submission> inFlight;
+    std::vector<VkCommandBuffer> freeCommandBuffers;
+    std::vector<VkFence> freeFences;
+
+    Ticket nextTicket = 1;
+    Ticket completedTicket = 0;
+};